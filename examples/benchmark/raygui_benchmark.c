@@ -0,0 +1,499 @@
+/*******************************************************************************************
+*
+*   raygui - headless controls benchmark
+*
+*   DESCRIPTION:
+*       Runs every raygui control with scripted input on a null (counting) backend, measuring
+*       the per-frame cost of every control and of synthetic screens of 100 to 100000 controls
+*
+*       Results are printed to stdout, one record per line, as JSON (default) or CSV (--csv):
+*           suite        : "control" (single control) or "screen" (grid of controls)
+*           control      : Control name, "*" for the full screen totals
+*           count        : Number of control instances per frame
+*           frames       : Number of frames measured
+*           ns_per_frame : Time spent per frame (nanoseconds)
+*           draw_calls   : Estimated draw calls per frame (batch breaks on texture change)
+*           quads        : Quads requested per frame (rectangles + gradients + textures + glyphs)
+*           rects        : Rectangles requested per frame
+*           glyphs       : Glyphs requested per frame
+*           icon_pixels  : Icon pixels drawn per frame (GuiGetFrameStats())
+*           style_reads  : GuiGetStyle() calls per frame (GuiGetFrameStats())
+*           text_measures: Text measurements per frame (GuiGetFrameStats())
+*           text_splits  : GuiTextSplit() calls per frame (GuiGetFrameStats())
+*           buffer_bytes : Bytes written to raygui static buffers per frame (GuiGetFrameStats())
+*
+*       NOTE: On "screen" suite, per-control records are measured on a separate pass timing every
+*       control call, so they include the timer overhead, use the "*" record for total frame time
+*
+*       Library config flags can be enabled at compilation to compare costs, i.e. -DRAYGUI_INPUT_STATE,
+*       -DRAYGUI_HITTEST (one hovered control per frame, skipping non-hovered controls updates)
+*
+*       When compiled with RAYGUI_PROFILE, "control" suite profile scopes can be written to a trace
+*       file (--trace), to be opened with chrome://tracing or ui.perfetto.dev, use a low --frames
+*       value to keep the trace file size reasonable
+*
+*   USAGE:
+*       raygui_benchmark [--csv] [--frames <count>] [--max-controls <count>] [--trace <file.json>]
+*
+*   DEPENDENCIES:
+*       raygui 5.0          - Immediate-mode GUI controls with custom styling and icons
+*
+*   COMPILATION (Linux/macOS - GCC/Clang):
+*       gcc -o raygui_benchmark raygui_benchmark.c -I../../src -std=c99 -O2 -lm
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 199309L     // Required for: clock_gettime()
+#endif
+
+#include <stdio.h>                  // Required for: printf()
+#include <stdlib.h>                 // Required for: calloc(), free(), atoi()
+#include <string.h>                 // Required for: strcmp(), strcpy()
+
+#if defined(_WIN32)
+    // NOTE: Avoid including windows.h, just declaring required functions
+    __declspec(dllimport) int __stdcall QueryPerformanceCounter(long long *count);
+    __declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long *frequency);
+#else
+    #include <time.h>               // Required for: clock_gettime()
+#endif
+
+#define RAYGUI_IMPLEMENTATION
+#define RAYGUI_STANDALONE
+#define RAYGUI_FRAME_STATS
+#include "raygui.h"
+
+#include "raygui_null_backend.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_DEFAULT_FRAMES         1000   // Frames measured per single control
+#define BENCH_SCREEN_CALLS        1000000   // Approximate control calls measured per screen
+#define BENCH_SCREEN_CELL_WIDTH       200
+#define BENCH_SCREEN_CELL_HEIGHT      120
+#define BENCH_SCREEN_COLUMNS            9
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Per-instance control state
+typedef struct BenchState {
+    bool active;
+    bool editMode;
+    int value;
+    int scrollIndex;
+    int focus;
+    float fvalue;
+    Color color;
+    Vector3 hsv;
+    Vector2 scroll;
+    char text[64];
+} BenchState;
+
+typedef void (*BenchControlFunc)(Rectangle bounds, BenchState *state);
+
+// Control benchmark entry
+typedef struct BenchControl {
+    const char *name;
+    BenchControlFunc func;
+    float width;
+    float height;
+} BenchControl;
+
+// Benchmark results for one record
+typedef struct BenchResult {
+    const char *suite;
+    const char *control;
+    int count;
+    int frames;
+    double nanoseconds;
+    NullCounters counters;
+    long long iconPixels;
+    long long styleReads;
+    long long textMeasures;
+    long long textSplits;
+    long long bufferBytes;
+} BenchResult;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static bool outputCsv = false;
+
+static char *listItems[8] = { "ONE", "TWO", "THREE", "FOUR", "FIVE", "SIX", "SEVEN", "EIGHT" };
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static long long GetTimeNanoseconds(void);
+#if defined(RAYGUI_PROFILE)
+static double GetTime(void) { return (double)GetTimeNanoseconds()/1000000000.0; }   // Required by raygui trace collector
+#endif
+static NullInput GetScriptedInput(int frame, Rectangle area);
+static void AddFrameStats(BenchResult *result);
+static void PrintResult(BenchResult result);
+
+//----------------------------------------------------------------------------------
+// Controls drawing functions
+//----------------------------------------------------------------------------------
+static void BenchWindowBox(Rectangle bounds, BenchState *state) { (void)state; GuiWindowBox(bounds, "#198#WINDOW BOX"); }
+static void BenchGroupBox(Rectangle bounds, BenchState *state) { (void)state; GuiGroupBox(bounds, "GROUP BOX"); }
+static void BenchLine(Rectangle bounds, BenchState *state) { (void)state; GuiLine(bounds, "LINE"); }
+static void BenchPanel(Rectangle bounds, BenchState *state) { (void)state; GuiPanel(bounds, "PANEL"); }
+static void BenchScrollPanel(Rectangle bounds, BenchState *state)
+{
+    Rectangle view = { 0 };
+    GuiScrollPanel(bounds, NULL, (Rectangle){ 0, 0, bounds.width*2, bounds.height*3 }, &state->scroll, &view);
+}
+static void BenchLabel(Rectangle bounds, BenchState *state) { (void)state; GuiLabel(bounds, "Label text"); }
+static void BenchButton(Rectangle bounds, BenchState *state) { (void)state; GuiButton(bounds, "#191#BUTTON"); }
+static void BenchLabelButton(Rectangle bounds, BenchState *state) { (void)state; GuiLabelButton(bounds, "LABEL BUTTON"); }
+static void BenchToggle(Rectangle bounds, BenchState *state) { GuiToggle(bounds, "TOGGLE", &state->active); }
+static void BenchToggleGroup(Rectangle bounds, BenchState *state) { GuiToggleGroup((Rectangle){ bounds.x, bounds.y, bounds.width/3 - 2, bounds.height }, "ONE;TWO;THREE", &state->value); }
+static void BenchToggleSlider(Rectangle bounds, BenchState *state) { GuiToggleSlider(bounds, "OFF;ON", &state->value); }
+static void BenchCheckBox(Rectangle bounds, BenchState *state) { GuiCheckBox((Rectangle){ bounds.x, bounds.y, bounds.height, bounds.height }, "CHECKBOX", &state->active); }
+static void BenchComboBox(Rectangle bounds, BenchState *state) { GuiComboBox(bounds, "ONE;TWO;THREE;FOUR", &state->value); }
+static void BenchDropdownBox(Rectangle bounds, BenchState *state)
+{
+    if (GuiDropdownBox(bounds, "ONE;TWO;THREE;FOUR", &state->value, state->editMode)) state->editMode = !state->editMode;
+}
+static void BenchTextBox(Rectangle bounds, BenchState *state)
+{
+    if (GuiTextBox(bounds, state->text, 64, state->editMode)) state->editMode = !state->editMode;
+}
+static void BenchSpinner(Rectangle bounds, BenchState *state)
+{
+    if (GuiSpinner(bounds, NULL, &state->value, 0, 100, state->editMode)) state->editMode = !state->editMode;
+}
+static void BenchValueBox(Rectangle bounds, BenchState *state)
+{
+    if (GuiValueBox(bounds, NULL, &state->value, 0, 100, state->editMode)) state->editMode = !state->editMode;
+}
+static void BenchValueBoxFloat(Rectangle bounds, BenchState *state)
+{
+    if (GuiValueBoxFloat(bounds, NULL, state->text, &state->fvalue, state->editMode)) state->editMode = !state->editMode;
+}
+static void BenchSlider(Rectangle bounds, BenchState *state) { GuiSlider(bounds, "MIN", "MAX", &state->fvalue, 0.0f, 100.0f); }
+static void BenchSliderBar(Rectangle bounds, BenchState *state) { GuiSliderBar(bounds, "MIN", "MAX", &state->fvalue, 0.0f, 100.0f); }
+static void BenchProgressBar(Rectangle bounds, BenchState *state) { GuiProgressBar(bounds, NULL, NULL, &state->fvalue, 0.0f, 100.0f); }
+static void BenchStatusBar(Rectangle bounds, BenchState *state) { (void)state; GuiStatusBar(bounds, "STATUS BAR"); }
+static void BenchDummyRec(Rectangle bounds, BenchState *state) { (void)state; GuiDummyRec(bounds, "DUMMY REC"); }
+static void BenchGrid(Rectangle bounds, BenchState *state)
+{
+    (void)state;
+    Vector2 mouseCell = { 0 };
+    GuiGrid(bounds, NULL, 20, 2, &mouseCell);
+}
+static void BenchListView(Rectangle bounds, BenchState *state) { GuiListView(bounds, "ONE;TWO;THREE;FOUR;FIVE;SIX;SEVEN;EIGHT", &state->scrollIndex, &state->value); }
+static void BenchListViewEx(Rectangle bounds, BenchState *state) { GuiListViewEx(bounds, listItems, 8, &state->scrollIndex, &state->value, &state->focus); }
+static void BenchTabBar(Rectangle bounds, BenchState *state) { GuiTabBar(bounds, "ONE;TWO;THREE;FOUR", &state->scrollIndex, &state->value); }
+static void BenchTabBarEx(Rectangle bounds, BenchState *state) { GuiTabBarEx(bounds, listItems, 8, &state->scrollIndex, &state->value, &state->focus); }
+static void BenchColorPicker(Rectangle bounds, BenchState *state) { GuiColorPicker((Rectangle){ bounds.x, bounds.y, bounds.width - 30, bounds.height }, NULL, &state->color); }
+static void BenchColorPanel(Rectangle bounds, BenchState *state) { GuiColorPanel(bounds, NULL, &state->color); }
+static void BenchColorBarAlpha(Rectangle bounds, BenchState *state) { GuiColorBarAlpha(bounds, NULL, &state->fvalue); }
+static void BenchColorBarHue(Rectangle bounds, BenchState *state) { GuiColorBarHue(bounds, NULL, &state->fvalue); }
+static void BenchColorPickerHSV(Rectangle bounds, BenchState *state) { GuiColorPickerHSV((Rectangle){ bounds.x, bounds.y, bounds.width - 30, bounds.height }, NULL, &state->hsv); }
+static void BenchColorPanelHSV(Rectangle bounds, BenchState *state) { GuiColorPanelHSV(bounds, NULL, &state->hsv); }
+static void BenchMessageBox(Rectangle bounds, BenchState *state) { GuiMessageBox(bounds, "#191#MESSAGE", "Message text", "OK;CANCEL", &state->value); }
+static void BenchTextInputBox(Rectangle bounds, BenchState *state) { GuiTextInputBox(bounds, "#12#INPUT", "Input text", state->text, 64, "OK;CANCEL", &state->value, &state->active); }
+
+static const BenchControl benchControls[] = {
+    { "GuiWindowBox", BenchWindowBox, 180, 110 },
+    { "GuiGroupBox", BenchGroupBox, 180, 110 },
+    { "GuiLine", BenchLine, 180, 20 },
+    { "GuiPanel", BenchPanel, 180, 110 },
+    { "GuiScrollPanel", BenchScrollPanel, 180, 110 },
+    { "GuiLabel", BenchLabel, 180, 24 },
+    { "GuiButton", BenchButton, 180, 30 },
+    { "GuiLabelButton", BenchLabelButton, 180, 24 },
+    { "GuiToggle", BenchToggle, 180, 30 },
+    { "GuiToggleGroup", BenchToggleGroup, 180, 30 },
+    { "GuiToggleSlider", BenchToggleSlider, 180, 30 },
+    { "GuiCheckBox", BenchCheckBox, 180, 20 },
+    { "GuiComboBox", BenchComboBox, 180, 30 },
+    { "GuiDropdownBox", BenchDropdownBox, 180, 30 },
+    { "GuiTextBox", BenchTextBox, 180, 30 },
+    { "GuiSpinner", BenchSpinner, 180, 30 },
+    { "GuiValueBox", BenchValueBox, 180, 30 },
+    { "GuiValueBoxFloat", BenchValueBoxFloat, 180, 30 },
+    { "GuiSlider", BenchSlider, 120, 20 },
+    { "GuiSliderBar", BenchSliderBar, 120, 20 },
+    { "GuiProgressBar", BenchProgressBar, 180, 20 },
+    { "GuiStatusBar", BenchStatusBar, 180, 24 },
+    { "GuiDummyRec", BenchDummyRec, 180, 60 },
+    { "GuiGrid", BenchGrid, 180, 110 },
+    { "GuiListView", BenchListView, 180, 110 },
+    { "GuiListViewEx", BenchListViewEx, 180, 110 },
+    { "GuiTabBar", BenchTabBar, 180, 24 },
+    { "GuiTabBarEx", BenchTabBarEx, 180, 24 },
+    { "GuiColorPicker", BenchColorPicker, 180, 110 },
+    { "GuiColorPanel", BenchColorPanel, 180, 110 },
+    { "GuiColorBarAlpha", BenchColorBarAlpha, 180, 20 },
+    { "GuiColorBarHue", BenchColorBarHue, 20, 110 },
+    { "GuiColorPickerHSV", BenchColorPickerHSV, 180, 110 },
+    { "GuiColorPanelHSV", BenchColorPanelHSV, 180, 110 },
+    { "GuiMessageBox", BenchMessageBox, 180, 110 },
+    { "GuiTextInputBox", BenchTextInputBox, 180, 110 },
+};
+
+#define BENCH_CONTROLS_COUNT    (int)(sizeof(benchControls)/sizeof(benchControls[0]))
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    int frameCount = BENCH_DEFAULT_FRAMES;
+    int maxControls = 100000;
+    const char *traceFileName = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--csv") == 0) outputCsv = true;
+        else if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc)) frameCount = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--max-controls") == 0) && (i + 1 < argc)) maxControls = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--trace") == 0) && (i + 1 < argc)) traceFileName = argv[++i];
+        else
+        {
+            fprintf(stderr, "USAGE: %s [--csv] [--frames <count>] [--max-controls <count>] [--trace <file.json>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (frameCount < 1) frameCount = 1;
+
+    GuiLoadStyleDefault();
+
+    BenchState *states = (BenchState *)calloc((maxControls > 0)? maxControls : 1, sizeof(BenchState));
+
+    if (outputCsv) printf("suite,control,count,frames,ns_per_frame,draw_calls,quads,rects,glyphs,icon_pixels,style_reads,text_measures,text_splits,buffer_bytes\n");
+    //--------------------------------------------------------------------------------------
+
+    // Suite: single controls
+    //--------------------------------------------------------------------------------------
+    if (traceFileName != NULL)
+    {
+#if defined(RAYGUI_PROFILE)
+        if (!GuiTraceBegin(traceFileName)) fprintf(stderr, "WARNING: Trace file could not be opened: %s\n", traceFileName);
+#else
+        fprintf(stderr, "WARNING: Trace requires compiling with RAYGUI_PROFILE\n");
+#endif
+    }
+
+    for (int c = 0; c < BENCH_CONTROLS_COUNT; c++)
+    {
+        Rectangle bounds = { 20, 20, benchControls[c].width, benchControls[c].height };
+        BenchState *state = &states[0];
+        memset(state, 0, sizeof(BenchState));
+
+        GuiLoadStyleDefault();
+        NullResetCounters();
+
+        BenchResult result = { "control", benchControls[c].name, 1, frameCount, 0.0, { 0 }, 0, 0, 0, 0, 0 };
+        long long startTime = GetTimeNanoseconds();
+
+        for (int frame = 0; frame < frameCount; frame++)
+        {
+            NullBeginFrame(GetScriptedInput(frame, bounds));
+            GuiBeginFrame();
+            GuiResetFrameStats();
+            benchControls[c].func(bounds, state);
+            AddFrameStats(&result);
+        }
+
+        result.nanoseconds = (double)(GetTimeNanoseconds() - startTime);
+        result.counters = nullCounters;
+        PrintResult(result);
+    }
+
+    GuiTraceEnd();
+    //--------------------------------------------------------------------------------------
+
+    // Suite: synthetic screens, mixing all controls on a grid layout
+    //--------------------------------------------------------------------------------------
+    for (int count = 100; count <= maxControls; count *= 10)
+    {
+        int frames = BENCH_SCREEN_CALLS/count;
+        if (frames < 3) frames = 3;
+
+        Rectangle screen = { 0, 0, NULL_SCREEN_WIDTH, NULL_SCREEN_HEIGHT };
+
+        // Pass 1: total frame time
+        memset(states, 0, count*sizeof(BenchState));
+        GuiLoadStyleDefault();
+        NullResetCounters();
+
+        BenchResult total = { "screen", "*", count, frames, 0.0, { 0 }, 0, 0, 0, 0, 0 };
+        long long startTime = GetTimeNanoseconds();
+
+        for (int frame = 0; frame < frames; frame++)
+        {
+            NullBeginFrame(GetScriptedInput(frame, screen));
+            GuiBeginFrame();
+            GuiResetFrameStats();
+
+            for (int i = 0; i < count; i++)
+            {
+                const BenchControl *control = &benchControls[i%BENCH_CONTROLS_COUNT];
+                Rectangle bounds = { (float)((i%BENCH_SCREEN_COLUMNS)*BENCH_SCREEN_CELL_WIDTH + 10), (float)((i/BENCH_SCREEN_COLUMNS)*BENCH_SCREEN_CELL_HEIGHT + 5), control->width, control->height };
+                control->func(bounds, &states[i]);
+            }
+
+            AddFrameStats(&total);
+        }
+
+        total.nanoseconds = (double)(GetTimeNanoseconds() - startTime);
+        total.counters = nullCounters;
+        PrintResult(total);
+
+        // Pass 2: per-control attribution, same input script and initial state
+        BenchResult results[BENCH_CONTROLS_COUNT] = { 0 };
+        for (int c = 0; c < BENCH_CONTROLS_COUNT; c++)
+        {
+            results[c] = (BenchResult){ "screen", benchControls[c].name, 0, frames, 0.0, { 0 }, 0, 0, 0, 0, 0 };
+            results[c].count = count/BENCH_CONTROLS_COUNT + (((count%BENCH_CONTROLS_COUNT) > c)? 1 : 0);
+        }
+
+        memset(states, 0, count*sizeof(BenchState));
+        GuiLoadStyleDefault();
+
+        for (int frame = 0; frame < frames; frame++)
+        {
+            NullBeginFrame(GetScriptedInput(frame, screen));
+            GuiBeginFrame();
+
+            for (int i = 0; i < count; i++)
+            {
+                int c = i%BENCH_CONTROLS_COUNT;
+                Rectangle bounds = { (float)((i%BENCH_SCREEN_COLUMNS)*BENCH_SCREEN_CELL_WIDTH + 10), (float)((i/BENCH_SCREEN_COLUMNS)*BENCH_SCREEN_CELL_HEIGHT + 5), benchControls[c].width, benchControls[c].height };
+
+                NullResetCounters();
+                GuiResetFrameStats();
+                long long controlStartTime = GetTimeNanoseconds();
+                benchControls[c].func(bounds, &states[i]);
+                results[c].nanoseconds += (double)(GetTimeNanoseconds() - controlStartTime);
+
+                AddFrameStats(&results[c]);
+                results[c].counters.drawCalls += nullCounters.drawCalls;
+                results[c].counters.quads += nullCounters.quads;
+                results[c].counters.rectangles += nullCounters.rectangles;
+                results[c].counters.gradients += nullCounters.gradients;
+                results[c].counters.textures += nullCounters.textures;
+                results[c].counters.glyphs += nullCounters.glyphs;
+            }
+        }
+
+        for (int c = 0; c < BENCH_CONTROLS_COUNT; c++) if (results[c].count > 0) PrintResult(results[c]);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(states);
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Get monotonic time in nanoseconds
+static long long GetTimeNanoseconds(void)
+{
+#if defined(_WIN32)
+    static long long frequency = 0;
+    long long counter = 0;
+
+    if (frequency == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (long long)((double)counter*1000000000.0/(double)frequency);
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (long long)now.tv_sec*1000000000LL + (long long)now.tv_nsec;
+#endif
+}
+
+// Get deterministic input for a frame, pointer moves around provided area
+// NOTE: Script includes hover/leave, clicks, drags, wheel, text input and keys
+static NullInput GetScriptedInput(int frame, Rectangle area)
+{
+    NullInput input = { 0 };
+
+    // Pointer path covers area and a small margin around it
+    int rangeX = (int)area.width + 40;
+    int rangeY = (int)area.height + 40;
+    input.mousePosition.x = area.x - 20 + (float)((frame*37)%rangeX);
+    input.mousePosition.y = area.y - 20 + (float)((frame*23)%rangeY);
+
+    // Left button: pressed, held 4 frames (drag), released, every 16 frames
+    int phase = frame%16;
+    input.buttonPressed[MOUSE_LEFT_BUTTON] = (phase == 0);
+    input.buttonDown[MOUSE_LEFT_BUTTON] = (phase < 5);
+    input.buttonReleased[MOUSE_LEFT_BUTTON] = (phase == 5);
+
+    // Mouse wheel movement
+    if ((frame%32) == 10) input.mouseWheel = 1.0f;
+    else if ((frame%32) == 26) input.mouseWheel = -1.0f;
+
+    // Text input and editing keys
+    if ((frame%4) == 0)
+    {
+        input.chars[0] = ((frame/4)%3 == 0)? '0' + (frame/4)%10 : 'a' + (frame/4)%26;
+        input.charCount = 1;
+    }
+
+    if ((frame%24) == 23) { input.keyPressed[KEY_BACKSPACE] = true; input.keyDown[KEY_BACKSPACE] = true; }
+    if ((frame%48) == 47) { input.keyPressed[KEY_LEFT] = true; input.keyDown[KEY_LEFT] = true; }
+    if ((frame%64) == 63) { input.keyPressed[KEY_ENTER] = true; input.keyDown[KEY_ENTER] = true; }
+
+    return input;
+}
+
+// Accumulate raygui frame stats into result
+static void AddFrameStats(BenchResult *result)
+{
+    GuiFrameStats stats = GuiGetFrameStats();
+
+    result->iconPixels += stats.iconPixels;
+    result->styleReads += stats.styleReads;
+    result->textMeasures += stats.textMeasures;
+    result->textSplits += stats.textSplits;
+    result->bufferBytes += stats.bufferBytes;
+}
+
+// Print one result record, values are averaged per frame
+static void PrintResult(BenchResult result)
+{
+    double frames = (double)result.frames;
+
+    if (outputCsv)
+    {
+        printf("%s,%s,%i,%i,%.1f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n", result.suite, result.control, result.count, result.frames,
+            result.nanoseconds/frames, result.counters.drawCalls/frames, result.counters.quads/frames,
+            result.counters.rectangles/frames, result.counters.glyphs/frames, result.iconPixels/frames,
+            result.styleReads/frames, result.textMeasures/frames, result.textSplits/frames, result.bufferBytes/frames);
+    }
+    else
+    {
+        printf("{ \"suite\": \"%s\", \"control\": \"%s\", \"count\": %i, \"frames\": %i, \"ns_per_frame\": %.1f, "
+            "\"draw_calls\": %.2f, \"quads\": %.2f, \"rects\": %.2f, \"glyphs\": %.2f, \"icon_pixels\": %.2f, "
+            "\"style_reads\": %.2f, \"text_measures\": %.2f, \"text_splits\": %.2f, \"buffer_bytes\": %.2f }\n",
+            result.suite, result.control, result.count, result.frames, result.nanoseconds/frames, result.counters.drawCalls/frames,
+            result.counters.quads/frames, result.counters.rectangles/frames, result.counters.glyphs/frames, result.iconPixels/frames,
+            result.styleReads/frames, result.textMeasures/frames, result.textSplits/frames, result.bufferBytes/frames);
+    }
+
+    fflush(stdout);
+}
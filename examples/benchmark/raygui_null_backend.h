@@ -0,0 +1,327 @@
+/*******************************************************************************************
+*
+*   raygui - Standalone mode null backend with draw counters
+*
+*   DESCRIPTION:
+*       Backend for RAYGUI_STANDALONE mode that does not draw anything, it just counts the
+*       drawing work requested by raygui (quads, glyphs, batch breaks) and reads input from
+*       a user-provided NullInput state, useful for headless benchmarking and testing
+*
+*       Draw calls are estimated like a batched renderer would issue them: a new draw call
+*       is counted every time the required texture changes (shapes texture vs font texture)
+*
+*       If RAYGUI_INPUT_STATE is defined, input is provided to raygui as a GuiInputState
+*       snapshot on NullBeginFrame() and backend input functions are not defined
+*
+*       If NULL_DRAW_HASH is defined, every drawing call and its parameters are hashed into
+*       nullDrawHash (FNV-1a 64-bit, reset with counters), so two draw streams can be compared
+*       for exact equality, useful to test drawing optimizations do not change the output
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#ifndef RAYGUI_NULL_BACKEND_H
+#define RAYGUI_NULL_BACKEND_H
+
+#include <string.h>             // Required for: memset()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define NULL_SCREEN_WIDTH       1920
+#define NULL_SCREEN_HEIGHT      1080
+
+#define NULL_MAX_KEYS            512
+#define NULL_MAX_CHARS            16
+
+#define NULL_FONT_GLYPHS         224    // Characters from 32 to 255
+#define NULL_FONT_TEXTURE_ID       1
+#define NULL_SHAPES_TEXTURE_ID     2
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Input state for current frame, filled by the application
+typedef struct NullInput {
+    Vector2 mousePosition;
+    float mouseWheel;
+    bool buttonDown[3];
+    bool buttonPressed[3];
+    bool buttonReleased[3];
+    bool keyDown[NULL_MAX_KEYS];
+    bool keyPressed[NULL_MAX_KEYS];
+    int chars[NULL_MAX_CHARS];
+    int charCount;
+} NullInput;
+
+// Drawing work counters, accumulated until reset
+typedef struct NullCounters {
+    long long drawCalls;        // Batch breaks (texture changes)
+    long long quads;            // Total quads requested
+    long long rectangles;       // DrawRectangle() calls
+    long long gradients;        // DrawRectangleGradientEx() calls
+    long long textures;         // DrawTexturePro() calls
+    long long glyphs;           // DrawTextCodepoint() calls
+} NullCounters;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static NullInput nullInput = { 0 };
+static NullCounters nullCounters = { 0 };
+static unsigned int nullCurrentTexture = 0;
+static unsigned int nullShapesTexture = NULL_SHAPES_TEXTURE_ID;
+static int nullCharIndex = 0;
+
+static Rectangle nullFontRecs[NULL_FONT_GLYPHS] = { 0 };
+static GlyphInfo nullFontGlyphs[NULL_FONT_GLYPHS] = { 0 };
+
+#if defined(NULL_DRAW_HASH)
+static unsigned long long nullDrawHash = 14695981039346656037ull;   // Draw stream hash (FNV-1a 64-bit)
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Backend control
+//----------------------------------------------------------------------------------
+// Begin a new frame with provided input state
+// NOTE: Every frame starts a new batch, so at least one draw call is required
+static void NullBeginFrame(NullInput input)
+{
+    nullInput = input;
+    nullCharIndex = 0;
+    nullCurrentTexture = 0;
+
+#if defined(RAYGUI_INPUT_STATE)
+    GuiInputState state = { 0 };
+
+    state.pointer = input.mousePosition;
+    state.scrollDelta = input.mouseWheel;
+    state.buttonDown = input.buttonDown[MOUSE_LEFT_BUTTON];
+    state.buttonDownAlt = input.buttonDown[MOUSE_RIGHT_BUTTON];
+    state.buttonPressed = input.buttonPressed[MOUSE_LEFT_BUTTON];
+    state.buttonPressedMid = input.buttonPressed[MOUSE_MIDDLE_BUTTON];
+    state.buttonReleased = input.buttonReleased[MOUSE_LEFT_BUTTON];
+
+    // NOTE: Only editing keys used by benchmark scripted input are mapped
+    if (input.keyDown[KEY_BACKSPACE]) state.keysDown |= INPUT_KEY_BACKSPACE;
+    if (input.keyDown[KEY_LEFT]) state.keysDown |= INPUT_KEY_LEFT;
+    if (input.keyDown[KEY_ENTER]) state.keysDown |= INPUT_KEY_ENTER;
+    if (input.keyPressed[KEY_BACKSPACE]) state.keysPressed |= INPUT_KEY_BACKSPACE;
+    if (input.keyPressed[KEY_LEFT]) state.keysPressed |= INPUT_KEY_LEFT;
+    if (input.keyPressed[KEY_ENTER]) state.keysPressed |= INPUT_KEY_ENTER;
+
+    for (int i = 0; (i < input.charCount) && (i < RAYGUI_INPUT_MAX_CHARS); i++) state.chars[state.charCount++] = input.chars[i];
+
+    GuiSetInputState(state);
+#endif
+}
+
+// Reset drawing counters
+static void NullResetCounters(void)
+{
+    memset(&nullCounters, 0, sizeof(NullCounters));
+
+#if defined(NULL_DRAW_HASH)
+    nullDrawHash = 14695981039346656037ull;
+#endif
+}
+
+#if defined(NULL_DRAW_HASH)
+// Hash drawing call data into draw stream hash
+static void NullHashDraw(const void *data, int size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (int i = 0; i < size; i++)
+    {
+        nullDrawHash ^= bytes[i];
+        nullDrawHash *= 1099511628211ull;
+    }
+}
+#endif
+
+// Register one quad using provided texture
+static void NullDrawQuad(unsigned int textureId)
+{
+    if (textureId != nullCurrentTexture)
+    {
+        nullCounters.drawCalls++;
+        nullCurrentTexture = textureId;
+    }
+
+    nullCounters.quads++;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: raygui required functions
+//----------------------------------------------------------------------------------
+// Input required functions
+//-------------------------------------------------------------------------------
+#if !defined(RAYGUI_INPUT_STATE)
+static Vector2 GetMousePosition(void) { return nullInput.mousePosition; }
+static float GetMouseWheelMove(void) { return nullInput.mouseWheel; }
+static bool IsMouseButtonDown(int button) { return ((button >= 0) && (button < 3))? nullInput.buttonDown[button] : false; }
+static bool IsMouseButtonPressed(int button) { return ((button >= 0) && (button < 3))? nullInput.buttonPressed[button] : false; }
+static bool IsMouseButtonReleased(int button) { return ((button >= 0) && (button < 3))? nullInput.buttonReleased[button] : false; }
+static bool IsKeyDown(int key) { return ((key >= 0) && (key < NULL_MAX_KEYS))? nullInput.keyDown[key] : false; }
+static bool IsKeyPressed(int key) { return ((key >= 0) && (key < NULL_MAX_KEYS))? nullInput.keyPressed[key] : false; }
+static int GetCharPressed(void) { return (nullCharIndex < nullInput.charCount)? nullInput.chars[nullCharIndex++] : 0; }
+#endif
+static const char *GetClipboardText(void) { return "clipboard"; }
+
+// Window required functions
+//-------------------------------------------------------------------------------
+static int GetScreenWidth(void) { return NULL_SCREEN_WIDTH; }
+static int GetScreenHeight(void) { return NULL_SCREEN_HEIGHT; }
+
+// Drawing required functions
+//-------------------------------------------------------------------------------
+static void DrawRectangle(int x, int y, int width, int height, Color color)
+{
+    nullCounters.rectangles++;
+    NullDrawQuad(nullShapesTexture);
+
+#if defined(NULL_DRAW_HASH)
+    int rec[4] = { x, y, width, height };
+    NullHashDraw(rec, sizeof(rec));
+    NullHashDraw(&color, sizeof(Color));
+#else
+    (void)x;
+    (void)y;
+    (void)width;
+    (void)height;
+    (void)color;
+#endif
+}
+
+static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
+{
+    nullCounters.gradients++;
+    NullDrawQuad(nullShapesTexture);
+
+#if defined(NULL_DRAW_HASH)
+    NullHashDraw(&rec, sizeof(Rectangle));
+    NullHashDraw(&col1, sizeof(Color));
+    NullHashDraw(&col2, sizeof(Color));
+    NullHashDraw(&col3, sizeof(Color));
+    NullHashDraw(&col4, sizeof(Color));
+#else
+    (void)rec;
+    (void)col1;
+    (void)col2;
+    (void)col3;
+    (void)col4;
+#endif
+}
+
+static void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    nullCounters.textures++;
+    NullDrawQuad(texture.id);
+
+    // NOTE: raygui always draws textures with no origin and rotation
+    (void)origin;
+    (void)rotation;
+
+#if defined(NULL_DRAW_HASH)
+    NullHashDraw(&source, sizeof(Rectangle));
+    NullHashDraw(&dest, sizeof(Rectangle));
+    NullHashDraw(&tint, sizeof(Color));
+#else
+    (void)source;
+    (void)dest;
+    (void)tint;
+#endif
+}
+
+// NOTE: Scissor changes require a new batch, next quad starts a new draw call
+static void BeginScissorMode(int x, int y, int width, int height)
+{
+    nullCurrentTexture = 0;
+
+#if defined(NULL_DRAW_HASH)
+    int scissor[5] = { 7, x, y, width, height };    // Tagged, not mistaken for a rectangle
+    NullHashDraw(scissor, sizeof(scissor));
+#else
+    (void)x;
+    (void)y;
+    (void)width;
+    (void)height;
+#endif
+}
+
+static void EndScissorMode(void)
+{
+    nullCurrentTexture = 0;
+
+#if defined(NULL_DRAW_HASH)
+    int tag = 9;
+    NullHashDraw(&tag, sizeof(int));
+#endif
+}
+
+// Text required functions
+//-------------------------------------------------------------------------------
+// Get a fixed-size synthetic font, every glyph is 6x10 pixels
+static Font GetFontDefault(void)
+{
+    Font font = { 0 };
+
+    if (nullFontGlyphs[1].value == 0)
+    {
+        for (int i = 0; i < NULL_FONT_GLYPHS; i++)
+        {
+            nullFontRecs[i] = (Rectangle){ (float)((i%16)*8), (float)((i/16)*12), 6, 10 };
+            nullFontGlyphs[i].value = 32 + i;
+        }
+
+        // Last rec is used by raygui as the white rectangle for shapes drawing
+        nullFontRecs[95] = (Rectangle){ 0, 180, 1, 1 };
+    }
+
+    font.baseSize = 10;
+    font.glyphCount = NULL_FONT_GLYPHS;
+    font.texture = (Texture2D){ NULL_FONT_TEXTURE_ID, 128, 192, 1, 0 };
+    font.recs = nullFontRecs;
+    font.glyphs = nullFontGlyphs;
+
+    return font;
+}
+
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
+{
+    nullCounters.glyphs++;
+    NullDrawQuad(font.texture.id);
+
+#if defined(NULL_DRAW_HASH)
+    NullHashDraw(&codepoint, sizeof(int));
+    NullHashDraw(&position, sizeof(Vector2));
+    NullHashDraw(&fontSize, sizeof(float));
+    NullHashDraw(&tint, sizeof(Color));
+#else
+    (void)codepoint;
+    (void)position;
+    (void)fontSize;
+    (void)tint;
+#endif
+}
+
+static Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount) { (void)fileName; (void)fontSize; (void)codepoints; (void)codepointCount; return GetFontDefault(); }
+static Texture2D LoadTextureFromImage(Image image) { return (Texture2D){ NULL_FONT_TEXTURE_ID + 2, image.width, image.height, 1, image.format }; }
+static void UnloadTexture(Texture2D texture) { (void)texture; }
+static void SetShapesTexture(Texture2D texture, Rectangle rec) { (void)rec; nullShapesTexture = texture.id; }
+
+// File and data required functions
+//-------------------------------------------------------------------------------
+static char *LoadFileText(const char *fileName) { (void)fileName; return NULL; }
+static void UnloadFileText(char *text) { (void)text; }
+static const char *GetDirectoryPath(const char *filePath) { (void)filePath; return ""; }
+static int *LoadCodepoints(const char *text, int *count) { (void)text; *count = 0; return NULL; }
+static void UnloadCodepoints(int *codepoints) { (void)codepoints; }
+static unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize) { (void)compData; (void)compDataSize; *dataSize = 0; return NULL; }
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing) { (void)font; (void)text; (void)fontSize; (void)spacing; return (Vector2){ 0 }; }
+
+#endif // RAYGUI_NULL_BACKEND_H
@@ -0,0 +1,237 @@
+/*******************************************************************************************
+*
+*   raygui - headless text drawing hash tests
+*
+*   DESCRIPTION:
+*       Draws text scenes on a null backend for several frames, hashing every drawing call
+*       (NULL_DRAW_HASH), and compares every frame hash with the expected one, recorded with
+*       the plain text drawing path (no text caches or fast paths)
+*
+*       Text caches and fast paths must not change the drawn output, any change on glyphs,
+*       positions or colors changes the frame hash; scenes are drawn for several frames so
+*       cached results (later frames) are compared as well as first frame results
+*
+*       Returns 0 if all hashes match, 1 otherwise
+*
+*   USAGE:
+*       raygui_text_hash [--print]
+*
+*       --print : Print computed hashes as an expected hashes table, to update it
+*                 when drawn output is changed on purpose
+*
+*   DEPENDENCIES:
+*       raygui 5.0          - Immediate-mode GUI controls with custom styling and icons
+*
+*   COMPILATION (Linux/macOS - GCC/Clang):
+*       gcc -o raygui_text_hash raygui_text_hash.c -I../../src -std=c99 -O2 -lm
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include <stdio.h>                  // Required for: printf()
+#include <string.h>                 // Required for: strcmp()
+
+#define RAYGUI_IMPLEMENTATION
+#define RAYGUI_STANDALONE
+#include "raygui.h"
+
+#define NULL_DRAW_HASH
+#include "raygui_null_backend.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define TEXT_HASH_FRAMES        4       // Frames drawn per scene
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Text scene, drawn with frame index to change some text parameters between frames
+typedef struct TextScene {
+    const char *name;
+    void (*Draw)(int frame);
+    unsigned long long expected[TEXT_HASH_FRAMES];  // Expected frame hashes
+} TextScene;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void DrawSceneLabels(int frame);         // Labels: overflow, icons, alignment, multiline, UTF-8
+static void DrawSceneStatic(int frame);         // Labels and buttons not changing between frames
+static void DrawSceneEncoding(int frame);       // Text widths and labels: ASCII, multibyte, invalid bytes, line breaks, wrap modes
+static void DrawSceneFontSDF(int frame);        // Labels scene with SDF font type, font shader begin/end hashed
+static void BeginFontShaderHashed(void);        // Font shader begin callback, hashed into draw stream
+static void EndFontShaderHashed(void);          // Font shader end callback, hashed into draw stream
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static TextScene scenes[] = {
+    { "labels", DrawSceneLabels, { 0x65886f376cf20e51ull, 0xa0897f5bfb72ea94ull, 0x29a84d06fb02b0faull, 0x2b15b1116da79995ull } },
+    { "static", DrawSceneStatic, { 0x1b7b52147b79743dull, 0x1b7b52147b79743dull, 0x1b7b52147b79743dull, 0x1b7b52147b79743dull } },
+    { "encoding", DrawSceneEncoding, { 0xafc93e2b541a1870ull, 0x4fbdb07514b16b24ull, 0x831d8465387cd20dull, 0xafc93e2b541a1870ull } },
+    { "sdf", DrawSceneFontSDF, { 0x2bf455619d6180d1ull, 0xc8b3cb9205aa7a04ull, 0xfee7a73123049c26ull, 0xfbe000369973a8b1ull } },
+};
+
+// Texts with different encodings and line breaks
+static const char *encodingTexts[] = {
+    "", "a", "hello world", "abcdefgh", "abcdefghi",
+    "\xc3\xa9t\xc3\xa9 caf\xc3\xa9", "mixed \xe2\x82\xac euro and more ascii after it", "bad \xff\xfe bytes",
+    "#12#icon", "#12#", "line1\nline2 longer\nl3", "trail\n", "\n\nlead", "a\rb\nc", "tabs\tand spaces",
+    "\xf0\x9f\x98\x80 emoji", "0123456789012345678901234567890123456789", NULL
+};
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    bool print = ((argc > 1) && (strcmp(argv[1], "--print") == 0));
+    int sceneCount = sizeof(scenes)/sizeof(TextScene);
+    int failed = 0;
+
+    GuiLoadStyleDefault();
+
+    for (int i = 0; i < sceneCount; i++)
+    {
+        unsigned long long hashes[TEXT_HASH_FRAMES] = { 0 };
+        int sceneFailed = failed;
+
+        for (int frame = 0; frame < TEXT_HASH_FRAMES; frame++)
+        {
+            NullBeginFrame((NullInput){ 0 });
+            NullResetCounters();
+            GuiBeginFrame();
+
+            scenes[i].Draw(frame);
+
+            hashes[frame] = nullDrawHash;
+            if (!print && (hashes[frame] != scenes[i].expected[frame]))
+            {
+                printf("FAIL: %s frame %i hash 0x%016llx, expected 0x%016llx\n", scenes[i].name, frame, hashes[frame], scenes[i].expected[frame]);
+                failed++;
+            }
+        }
+
+        if (print) printf("%s: { 0x%016llxull, 0x%016llxull, 0x%016llxull, 0x%016llxull }\n", scenes[i].name, hashes[0], hashes[1], hashes[2], hashes[3]);
+        else printf("%s: %s\n", scenes[i].name, (sceneFailed == failed)? "PASS" : "FAIL");
+    }
+
+    return (failed > 0)? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Labels: overflow, icons, alignment, multiline, UTF-8
+// NOTE: Some widths and text size change between frames
+static void DrawSceneLabels(int frame)
+{
+    GuiLabel((Rectangle){ 10, 10, 200, 20 }, "Hello world label");
+    GuiLabel((Rectangle){ 10, 40, 60, 20 }, "This label is far too long to fit here");
+    GuiLabel((Rectangle){ 10, 70, 90, 20 }, "#12#Icon label overflowing");
+    GuiButton((Rectangle){ 10, 100, 120, 24 }, "#5#Save");
+
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_RIGHT);
+    GuiLabel((Rectangle){ 10, 130, 200, 20 }, "Right aligned");
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+
+    GuiLabel((Rectangle){ 10, 160, 200, 60 }, "Line one\nLine two is much longer than the bounds for sure\n#3#Third");
+    GuiLabel((Rectangle){ 10, 230, 100.0f + frame*10, 20 }, "Width changes each frame abcdefghijkl");
+    GuiLabel((Rectangle){ 10, 260, 200, 20 }, "Vary\xc3\xa9 chars \xe2\x82\xac utf8");
+
+    char longText[121] = { 0 };
+    for (int i = 0; i < 120; i++) longText[i] = 'a' + i%26;
+    GuiLabel((Rectangle){ 10, 290, 2000, 20 }, longText);
+
+    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_WORD);
+    GuiLabel((Rectangle){ 10, 320, 100, 80 }, "Wrapped words text in a small box");
+    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_NONE);
+
+    int active = frame%3;
+    GuiToggleGroup((Rectangle){ 10, 420, 60, 20 }, "ONE;TWO;THREE", &active);
+
+    if (frame == 2) GuiSetStyle(DEFAULT, TEXT_SIZE, 14);
+    GuiLabel((Rectangle){ 10, 450, 100, 20 }, "Size change label");
+    if (frame == 2) GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
+
+    bool checked = true;
+    GuiCheckBox((Rectangle){ 10, 480, 16, 16 }, "Checked", &checked);
+    GuiLabel((Rectangle){ 10, 500, 6, 20 }, "tiny");
+}
+
+// Labels and buttons not changing between frames
+// NOTE: All frames are expected to be equal, first frame fills text caches, next ones use them
+static void DrawSceneStatic(int frame)
+{
+    (void)frame;
+
+    GuiLabel((Rectangle){ 10, 10, 200, 20 }, "Static label");
+    GuiLabel((Rectangle){ 10, 40, 50, 20 }, "Static label overflowing its bounds");
+    GuiLabel((Rectangle){ 10, 70, 200, 20 }, "#15#Static icon label");
+    GuiButton((Rectangle){ 10, 100, 80, 24 }, "Button");
+    GuiButton((Rectangle){ 10, 130, 40, 24 }, "Long button text");
+
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiLabel((Rectangle){ 10, 160, 200, 20 }, "Centered \xc3\xa9t\xc3\xa9");
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+
+    const char *items[] = { "First row", "Second row, longer than the list view", "Third \xe2\x82\xac row" };
+    int scrollIndex = 0;
+    int active = 1;
+    GuiListViewEx((Rectangle){ 10, 190, 120, 100 }, (char **)items, 3, &scrollIndex, &active, NULL);
+}
+
+// Text widths and labels: ASCII, multibyte, invalid bytes, line breaks, wrap modes
+// NOTE: Measured widths are hashed too, wrap mode changes every frame (last frame repeats first one)
+static void DrawSceneEncoding(int frame)
+{
+    for (int i = 0; encodingTexts[i] != NULL; i++)
+    {
+        int width = GuiGetTextWidth(encodingTexts[i]);
+        NullHashDraw(&width, sizeof(int));
+    }
+
+    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, frame%3);
+
+    for (int i = 0; encodingTexts[i] != NULL; i++)
+    {
+        GuiLabel((Rectangle){ 10, (float)(i*30), 60.0f + i*7, 60 }, encodingTexts[i]);
+        GuiButton((Rectangle){ 300, (float)(i*30), 80, 24 }, encodingTexts[i]);
+    }
+
+    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_NONE);
+}
+
+// Labels scene with SDF font type, font shader begin/end hashed
+// NOTE: Shader is expected to be begun on first glyph after non-text drawing and kept active for
+// consecutive texts, so shader changes placement on draw stream is compared too; without shader
+// changes, draw stream is the same one drawn with normal font type (labels scene)
+static void DrawSceneFontSDF(int frame)
+{
+    GuiSetFontType(FONT_TYPE_SDF);
+    GuiSetFontShaderCallbacks(BeginFontShaderHashed, EndFontShaderHashed);
+
+    DrawSceneLabels(frame);
+    GuiEndFrame();
+
+    GuiSetFontShaderCallbacks(NULL, NULL);
+    GuiSetFontType(FONT_TYPE_NORMAL);
+}
+
+// Font shader begin callback, hashed into draw stream
+static void BeginFontShaderHashed(void)
+{
+    int tag = 11;
+    NullHashDraw(&tag, sizeof(int));
+}
+
+// Font shader end callback, hashed into draw stream
+static void EndFontShaderHashed(void)
+{
+    int tag = 13;
+    NullHashDraw(&tag, sizeof(int));
+}
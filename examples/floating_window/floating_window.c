@@ -137,8 +137,10 @@ int main(void) {
     while(!WindowShouldClose()) {
         BeginDrawing();
             ClearBackground(DARKGREEN);
+            GuiBeginFrame();    // Required for stable controls ids, windows controls move while dragged
             GuiWindowFloating(&window_position, &window_size, &minimized, &moving, &resizing, &DrawContent, (Vector2) { 140, 320 }, &scroll, "Movable & Scalable Window");
             GuiWindowFloating(&window2_position, &window2_size, &minimized2, &moving2, &resizing2, &DrawContent, (Vector2) { 140, 320 }, &scroll2, "Another window");
+            GuiEndFrame();
         EndDrawing();
     }
 
@@ -69,9 +69,9 @@ int main()
 
             GuiScrollPanel(panelRec, NULL, panelContentRec, &panelScroll, &panelView);
 
-            BeginScissorMode(panelView.x, panelView.y, panelView.width, panelView.height);
+            GuiPushClip(panelView);
                 GuiGrid((Rectangle){panelRec.x + panelScroll.x, panelRec.y + panelScroll.y, panelContentRec.width, panelContentRec.height}, NULL, 16, 3, NULL);
-            EndScissorMode();
+            GuiPopClip();
 
             if (showContentArea) DrawRectangle(panelRec.x + panelScroll.x, panelRec.y + panelScroll.y, panelContentRec.width, panelContentRec.height, Fade(RED, 0.1));
 
@@ -0,0 +1,844 @@
+/*******************************************************************************************
+*
+*   raygui - style converter to indexed .rgs
+*
+*   DESCRIPTION:
+*       Converts a raygui style into the indexed binary style format (.rgs version 700),
+*       supported inputs:
+*           - Binary style file (.rgs version 200, 400, 600), including custom font
+*           - Text style file (.rgs), only properties, font must be generated from its charset
+*           - Style as code header (style_<name>.h), exported by rGuiStyler, including custom font
+*
+*       Indexed style data contains a table of contents with 16-byte aligned sections, the full
+*       style table already resolved (default style + style properties, DEFAULT propagated),
+*       the font parameters, atlas, recs and glyphs, and a checksum of the data; it can be loaded
+*       with GuiLoadStyle()/GuiLoadStyleFromMemory() locating its sections, no sequential parsing
+*
+*       Font atlas is written uncompressed by default, so it can be uploaded from file data,
+*       use --keep-compressed to keep the source atlas compressed (DEFLATE) for smaller files
+*
+*   USAGE:
+*       style_converter <input.rgs|style_name.h> <output.rgs> [--keep-compressed]
+*
+*   DEPENDENCIES:
+*       raygui 5.0          - Immediate-mode GUI controls with custom styling and icons
+*
+*   COMPILATION (Linux/macOS - GCC/Clang):
+*       gcc -o style_converter style_converter.c -I../../src -std=c99 -O2 -lm
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include <stdio.h>                  // Required for: printf(), fopen(), fread(), fwrite()
+#include <stdlib.h>                 // Required for: calloc(), realloc(), free()
+#include <string.h>                 // Required for: strcmp(), strstr(), memcpy()
+
+#define RAYGUI_IMPLEMENTATION
+#define RAYGUI_STANDALONE
+#define RAYGUI_INPUT_STATE          // No input functions required
+#include "raygui.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define STYLE_INDEXED_VERSION          700
+#define STYLE_MAX_PROPS                 (RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED))
+#define STYLE_MAX_LINE_SIZE           1024
+
+// Indexed style sections types
+#define STYLE_SECTION_STYLE              1
+#define STYLE_SECTION_FONT               2
+#define STYLE_SECTION_ATLAS              3
+#define STYLE_SECTION_RECS               4
+#define STYLE_SECTION_GLYPHS             5
+
+#define STYLE_ALIGN16(size)     (((size) + 15) & ~15)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Style data to be converted
+typedef struct StyleData {
+    bool fontAvailable;         // Custom font available
+    char fontName[32];          // Font filename (with extension)
+    int fontBaseSize;           // Font base size
+    int fontGlyphCount;         // Font glyph count
+    int fontType;               // Font type (0-NORMAL, 1-SDF)
+    Rectangle fontWhiteRec;     // Font white rectangle
+    int atlasWidth;             // Atlas image width
+    int atlasHeight;            // Atlas image height
+    int atlasFormat;            // Atlas image format
+    int atlasDataSize;          // Atlas image data size (uncompressed)
+    int atlasStoredSize;        // Atlas image data size stored (compressed if different from atlasDataSize)
+    unsigned char *atlasData;   // Atlas image data stored
+    Rectangle *recs;            // Glyphs rectangles in atlas
+    int *glyphs;                // Glyphs info: value, offsetX, offsetY, advanceX
+} StyleData;
+
+// Raw DEFLATE decoder state
+typedef struct InflateState {
+    const unsigned char *input;
+    int inputSize;
+    int inputPosition;
+    unsigned int bitBuffer;
+    int bitCount;
+    unsigned char *output;
+    int outputSize;
+    int outputCapacity;
+    bool error;
+} InflateState;
+
+// Canonical huffman decoding table
+typedef struct InflateHuffman {
+    short counts[16];           // Number of symbols per code length
+    short symbols[288];         // Symbols ordered by code
+} InflateHuffman;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static bool LoadStyleBinary(const char *fileName, StyleData *style, bool keepCompressed); // Load binary style file (.rgs)
+static bool LoadStyleText(const char *fileName, StyleData *style);  // Load text style file (.rgs), only properties
+static bool LoadStyleCode(const char *fileName, StyleData *style, bool keepCompressed); // Load style as code header (.h)
+static bool SaveStyleIndexed(const char *fileName, const StyleData *style); // Save indexed style file (.rgs version 700)
+static void UnloadStyleData(StyleData *style);                      // Unload style font data
+
+static void SetStyleProperty(int control, int property, unsigned int value); // Set style property as style loaders do
+static unsigned char *LoadFileData(const char *fileName, int *dataSize);     // Load file data into memory
+static int GetPixelDataSize(int width, int height, int format);              // Get uncompressed image data size
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        printf("USAGE: style_converter <input.rgs|style_name.h> <output.rgs> [--keep-compressed]\n");
+        return 1;
+    }
+
+    bool keepCompressed = ((argc > 3) && (strcmp(argv[3], "--keep-compressed") == 0));
+
+    // Style properties are applied over default style, so the full style table is resolved
+    GuiLoadStyleDefault();
+
+    StyleData style = { 0 };
+    bool loaded = false;
+
+    const char *extension = strrchr(argv[1], '.');
+
+    if ((extension != NULL) && (strcmp(extension, ".h") == 0)) loaded = LoadStyleCode(argv[1], &style, keepCompressed);
+    else
+    {
+        // Binary style files start with "rGS " signature, text style files otherwise
+        FILE *file = fopen(argv[1], "rb");
+        char signature[4] = { 0 };
+
+        if (file != NULL)
+        {
+            if (fread(signature, 1, 4, file) != 4) memset(signature, 0, 4);
+            fclose(file);
+
+            if (memcmp(signature, "rGS ", 4) == 0) loaded = LoadStyleBinary(argv[1], &style, keepCompressed);
+            else loaded = LoadStyleText(argv[1], &style);
+        }
+        else printf("ERROR: Input file could not be opened: %s\n", argv[1]);
+    }
+
+    bool saved = false;
+
+    if (loaded)
+    {
+        saved = SaveStyleIndexed(argv[2], &style);
+
+        if (saved) printf("INFO: Style converted: %s -> %s (font: %s, glyphs: %i, atlas: %s)\n", argv[1], argv[2],
+            style.fontAvailable? style.fontName : "none", style.fontGlyphCount,
+            (style.atlasStoredSize != style.atlasDataSize)? "compressed" : "uncompressed");
+    }
+
+    UnloadStyleData(&style);
+
+    return saved? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Style loading/saving
+//----------------------------------------------------------------------------------
+// Load binary style file (.rgs)
+// NOTE: Same data layout than GuiLoadStyleFromMemory(), font data is decompressed if required
+static bool LoadStyleBinary(const char *fileName, StyleData *style, bool keepCompressed)
+{
+    #define READ_DATA(dst, size) do { \
+        if ((size) <= (int)(fileDataEnd - fileDataPtr)) { memcpy(dst, fileDataPtr, size); fileDataPtr += (size); } \
+        else valid = false; } while (0)
+
+    bool valid = true;
+    int fileDataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileDataSize);
+
+    if (fileData == NULL) return false;
+
+    unsigned char *fileDataPtr = fileData;
+    unsigned char *fileDataEnd = fileData + fileDataSize;
+
+    char signature[4] = { 0 };
+    short version = 0;
+    short reserved = 0;
+    int propertyCount = 0;
+
+    READ_DATA(signature, 4);
+    READ_DATA(&version, 2);
+    READ_DATA(&reserved, 2);
+    READ_DATA(&propertyCount, 4);
+
+    if (valid && (version >= STYLE_INDEXED_VERSION))
+    {
+        printf("ERROR: Style file is already indexed (version %i): %s\n", version, fileName);
+        valid = false;
+    }
+
+    for (int i = 0; valid && (i < propertyCount); i++)
+    {
+        short controlId = 0;
+        short propertyId = 0;
+        unsigned int propertyValue = 0;
+
+        READ_DATA(&controlId, 2);
+        READ_DATA(&propertyId, 2);
+        READ_DATA(&propertyValue, 4);
+
+        if (valid) SetStyleProperty(controlId, propertyId, propertyValue);
+    }
+
+    int fontDataSize = 0;
+    if (valid) READ_DATA(&fontDataSize, 4);
+
+    if (valid && (fontDataSize > 0))
+    {
+        if (version >= 600) READ_DATA(style->fontName, 32);
+
+        READ_DATA(&style->fontBaseSize, 4);
+        READ_DATA(&style->fontGlyphCount, 4);
+        READ_DATA(&style->fontType, 4);
+        READ_DATA(&style->fontWhiteRec, 16);
+
+        int atlasCompSize = 0;
+        READ_DATA(&style->atlasDataSize, 4);
+        READ_DATA(&atlasCompSize, 4);
+        READ_DATA(&style->atlasWidth, 4);
+        READ_DATA(&style->atlasHeight, 4);
+        READ_DATA(&style->atlasFormat, 4);
+
+        if ((atlasCompSize <= 0) || (atlasCompSize == style->atlasDataSize)) atlasCompSize = style->atlasDataSize;
+
+        if (valid && (atlasCompSize > 0) && (atlasCompSize <= (int)(fileDataEnd - fileDataPtr)))
+        {
+            if ((atlasCompSize != style->atlasDataSize) && !keepCompressed)
+            {
+                style->atlasData = DecompressData(fileDataPtr, atlasCompSize, &style->atlasStoredSize);
+                if (style->atlasStoredSize != style->atlasDataSize) valid = false;
+            }
+            else
+            {
+                style->atlasData = (unsigned char *)calloc(atlasCompSize, 1);
+                memcpy(style->atlasData, fileDataPtr, atlasCompSize);
+                style->atlasStoredSize = atlasCompSize;
+            }
+
+            fileDataPtr += atlasCompSize;
+        }
+        else valid = false;
+
+        // Glyphs count is bounded before computing recs and glyphs data size
+        if ((style->fontGlyphCount <= 0) || (style->fontGlyphCount > 0x110000)) valid = false;
+
+        // Recs and glyphs data can be compressed (VERSION: >=400)
+        for (int k = 0; valid && (k < 2); k++)
+        {
+            int dataSize = style->fontGlyphCount*16;
+            int compSize = 0;
+
+            if (version >= 400) READ_DATA(&compSize, 4);
+            if ((compSize <= 0) || (compSize == dataSize)) compSize = dataSize;
+
+            unsigned char *data = NULL;
+
+            if (valid && (compSize <= (int)(fileDataEnd - fileDataPtr)))
+            {
+                if (compSize != dataSize)
+                {
+                    int uncompSize = 0;
+                    data = DecompressData(fileDataPtr, compSize, &uncompSize);
+                    if (uncompSize != dataSize) valid = false;
+                }
+                else
+                {
+                    data = (unsigned char *)calloc(dataSize, 1);
+                    memcpy(data, fileDataPtr, dataSize);
+                }
+
+                fileDataPtr += compSize;
+            }
+            else valid = false;
+
+            if (k == 0) style->recs = (Rectangle *)data;
+            else style->glyphs = (int *)data;
+        }
+
+        style->fontAvailable = valid;
+    }
+
+    if (!valid) printf("ERROR: Style file data could not be read: %s\n", fileName);
+
+    free(fileData);
+
+    return valid;
+}
+
+// Load text style file (.rgs)
+// NOTE: Only style properties are loaded, text style fonts are generated by raylib from charset
+static bool LoadStyleText(const char *fileName, StyleData *style)
+{
+    FILE *file = fopen(fileName, "rt");
+    char buffer[STYLE_MAX_LINE_SIZE] = { 0 };
+
+    if (file == NULL) return false;
+
+    while (fgets(buffer, STYLE_MAX_LINE_SIZE, file) != NULL)
+    {
+        int controlId = 0;
+        int propertyId = 0;
+        unsigned int propertyValue = 0;
+
+        // Style property: p <control_id> <property_id> <property_value> <property_name>
+        if ((buffer[0] == 'p') && (sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue) == 3)) SetStyleProperty(controlId, propertyId, propertyValue);
+        else if (buffer[0] == 'f') printf("WARNING: Text style font not converted, it requires font generation: %s", buffer);
+    }
+
+    fclose(file);
+
+    style->fontAvailable = false;   // Text style font is not converted
+
+    return true;
+}
+
+// Load style as code header (.h)
+// NOTE: Header data arrays are parsed line by line, as exported by StyleAsCode exporter v2.0
+static bool LoadStyleCode(const char *fileName, StyleData *style, bool keepCompressed)
+{
+    enum { CODE_NONE = 0, CODE_PROPS, CODE_FONT_DATA, CODE_FONT_RECS, CODE_FONT_GLYPHS };
+
+    FILE *file = fopen(fileName, "rt");
+    char buffer[STYLE_MAX_LINE_SIZE] = { 0 };
+
+    if (file == NULL) return false;
+
+    int array = CODE_NONE;
+    int compDataSize = 0;
+    int compDataCapacity = 0;
+    unsigned char *compData = NULL;
+    int recsCount = 0;
+    int glyphsCount = 0;
+
+    while (fgets(buffer, STYLE_MAX_LINE_SIZE, file) != NULL)
+    {
+        char *start = NULL;
+
+        // NOTE: Arrays are detected from their declaration, arrays are also used on style loading function
+        bool declaration = (strncmp(buffer, "static ", 7) == 0);
+
+        if (declaration && (strstr(buffer, "StyleProps[") != NULL)) array = CODE_PROPS;
+        else if (declaration && (strstr(buffer, "FontData[") != NULL)) array = CODE_FONT_DATA;
+        else if (declaration && ((start = strstr(buffer, "FontRecs[")) != NULL))
+        {
+            sscanf(start, "FontRecs[%d]", &style->fontGlyphCount);
+            style->recs = (Rectangle *)calloc(style->fontGlyphCount, sizeof(Rectangle));
+            style->glyphs = (int *)calloc(style->fontGlyphCount*4, sizeof(int));
+            array = CODE_FONT_RECS;
+        }
+        else if (declaration && (strstr(buffer, "FontGlyphs[") != NULL)) array = CODE_FONT_GLYPHS;
+        else if (array == CODE_PROPS)
+        {
+            int controlId = 0;
+            int propertyId = 0;
+            unsigned int propertyValue = 0;
+
+            if (sscanf(buffer, " { %d, %d, (int)0x%x }", &controlId, &propertyId, &propertyValue) == 3) SetStyleProperty(controlId, propertyId, propertyValue);
+        }
+        else if ((array == CODE_FONT_RECS) && (recsCount < style->fontGlyphCount))
+        {
+            Rectangle *rec = &style->recs[recsCount];
+            if (sscanf(buffer, " { %f, %f, %f , %f }", &rec->x, &rec->y, &rec->width, &rec->height) == 4) recsCount++;
+        }
+        else if ((array == CODE_FONT_GLYPHS) && (glyphsCount < style->fontGlyphCount))
+        {
+            int *glyph = &style->glyphs[glyphsCount*4];
+            if (sscanf(buffer, " { %d, %d, %d, %d,", &glyph[0], &glyph[1], &glyph[2], &glyph[3]) == 4) glyphsCount++;
+        }
+        else if ((start = strstr(buffer, "Image imFont = { data,")) != NULL)
+        {
+            sscanf(start, "Image imFont = { data, %d, %d, 1, %d }", &style->atlasWidth, &style->atlasHeight, &style->atlasFormat);
+        }
+        else if ((start = strstr(buffer, "font.baseSize =")) != NULL) sscanf(start, "font.baseSize = %d;", &style->fontBaseSize);
+        else if ((start = strstr(buffer, "Rectangle fontWhiteRec =")) != NULL)
+        {
+            Rectangle *rec = &style->fontWhiteRec;
+            sscanf(start, "Rectangle fontWhiteRec = { %f, %f, %f, %f }", &rec->x, &rec->y, &rec->width, &rec->height);
+        }
+        else if (((start = strstr(buffer, "guiFontName")) != NULL) && (strstr(buffer, "snprintf") != NULL))
+        {
+            // Font name is the last quoted string: snprintf(guiFontName, 32, "%s", "<fontName>");
+            char *end = strrchr(start, '"');
+            if (end != NULL)
+            {
+                *end = '\0';
+                char *name = strrchr(start, '"');
+                if (name != NULL) snprintf(style->fontName, 32, "%s", name + 1);
+            }
+        }
+
+        // NOTE: Font data array first values are provided on its declaration line
+        if (array == CODE_FONT_DATA)
+        {
+            unsigned int value = 0;
+
+            for (start = strstr(buffer, "0x"); start != NULL; start = strstr(start + 2, "0x"))
+            {
+                if (sscanf(start, "0x%x", &value) != 1) continue;
+
+                if (compDataSize >= compDataCapacity)
+                {
+                    compDataCapacity = (compDataCapacity > 0)? compDataCapacity*2 : 4096;
+                    compData = (unsigned char *)realloc(compData, compDataCapacity);
+                }
+
+                compData[compDataSize++] = (unsigned char)value;
+            }
+        }
+
+        if ((array != CODE_NONE) && (strstr(buffer, "};") != NULL)) array = CODE_NONE;
+    }
+
+    fclose(file);
+
+    bool valid = true;
+
+    if ((compDataSize > 0) && (style->fontGlyphCount > 0))
+    {
+        style->atlasDataSize = GetPixelDataSize(style->atlasWidth, style->atlasHeight, style->atlasFormat);
+
+        if (keepCompressed)
+        {
+            style->atlasData = compData;
+            style->atlasStoredSize = compDataSize;
+            compData = NULL;
+        }
+        else style->atlasData = DecompressData(compData, compDataSize, &style->atlasStoredSize);
+
+        valid = ((style->atlasData != NULL) && (style->atlasDataSize > 0) &&
+                 (keepCompressed || (style->atlasStoredSize == style->atlasDataSize)) &&
+                 (recsCount == style->fontGlyphCount) && (glyphsCount == style->fontGlyphCount));
+
+        style->fontAvailable = valid;
+    }
+
+    if (!valid) printf("ERROR: Style code font data could not be read: %s\n", fileName);
+
+    free(compData);
+
+    return valid;
+}
+
+// Save indexed style file (.rgs version 700)
+// NOTE: Data layout is described on GuiLoadStyleFromMemory()
+static bool SaveStyleIndexed(const char *fileName, const StyleData *style)
+{
+    int sectionCount = style->fontAvailable? 5 : 1;
+    int sectionTypes[5] = { STYLE_SECTION_STYLE, STYLE_SECTION_FONT, STYLE_SECTION_ATLAS, STYLE_SECTION_RECS, STYLE_SECTION_GLYPHS };
+    int sectionSizes[5] = { STYLE_MAX_PROPS*4, 80, style->atlasStoredSize, style->fontGlyphCount*16, style->fontGlyphCount*16 };
+    int sectionParams[5] = { RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED, 0, style->atlasDataSize, style->fontGlyphCount, style->fontGlyphCount };
+    int sectionOffsets[5] = { 0 };
+
+    // Compute sections offsets, aligned to 16 bytes
+    int dataSize = STYLE_ALIGN16(16 + sectionCount*16);
+    for (int i = 0; i < sectionCount; i++)
+    {
+        sectionOffsets[i] = dataSize;
+        dataSize += STYLE_ALIGN16(sectionSizes[i]);
+    }
+
+    unsigned char *data = (unsigned char *)calloc(dataSize, 1);
+
+    // Header and table of contents
+    short version = STYLE_INDEXED_VERSION;
+    short count = (short)sectionCount;
+    memcpy(data, "rGS ", 4);
+    memcpy(data + 4, &version, 2);
+    memcpy(data + 6, &count, 2);
+    memcpy(data + 8, &dataSize, 4);
+
+    for (int i = 0; i < sectionCount; i++)
+    {
+        int entry[4] = { sectionTypes[i], sectionOffsets[i], sectionSizes[i], sectionParams[i] };
+        memcpy(data + 16 + i*16, entry, 16);
+    }
+
+    // Section STYLE: Full style table, unscaled
+    for (int i = 0; i < STYLE_MAX_PROPS; i++)
+    {
+        unsigned int value = (unsigned int)GuiGetStyle(i/(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED), i%(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED));
+        memcpy(data + sectionOffsets[0] + i*4, &value, 4);
+    }
+
+    if (style->fontAvailable)
+    {
+        // Section FONT: Font parameters
+        unsigned char *fontInfo = data + sectionOffsets[1];
+        memcpy(fontInfo, style->fontName, 32);
+        memcpy(fontInfo + 32, &style->fontBaseSize, 4);
+        memcpy(fontInfo + 36, &style->fontGlyphCount, 4);
+        memcpy(fontInfo + 40, &style->fontType, 4);
+        memcpy(fontInfo + 44, &style->atlasWidth, 4);
+        memcpy(fontInfo + 48, &style->atlasHeight, 4);
+        memcpy(fontInfo + 52, &style->atlasFormat, 4);
+        memcpy(fontInfo + 64, &style->fontWhiteRec, 16);
+
+        // Sections ATLAS, RECS and GLYPHS
+        memcpy(data + sectionOffsets[2], style->atlasData, style->atlasStoredSize);
+        memcpy(data + sectionOffsets[3], style->recs, style->fontGlyphCount*16);
+        memcpy(data + sectionOffsets[4], style->glyphs, style->fontGlyphCount*16);
+    }
+
+    // Checksum (FNV-1a 32-bit) of data after header
+    unsigned int checksum = 2166136261u;
+    for (int i = 16; i < dataSize; i++)
+    {
+        checksum ^= data[i];
+        checksum *= 16777619u;
+    }
+    memcpy(data + 12, &checksum, 4);
+
+    bool saved = false;
+    FILE *file = fopen(fileName, "wb");
+
+    if (file != NULL)
+    {
+        saved = (fwrite(data, 1, dataSize, file) == (size_t)dataSize);
+        fclose(file);
+    }
+
+    if (!saved) printf("ERROR: Output file could not be written: %s\n", fileName);
+
+    free(data);
+
+    return saved;
+}
+
+// Unload style font data
+static void UnloadStyleData(StyleData *style)
+{
+    free(style->atlasData);
+    free(style->recs);
+    free(style->glyphs);
+}
+
+// Set style property as style loaders do
+// NOTE: DEFAULT base properties are propagated to all controls
+static void SetStyleProperty(int control, int property, unsigned int value)
+{
+    if ((control < 0) || (control >= RAYGUI_MAX_CONTROLS) ||
+        (property < 0) || (property >= (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED))) return;
+
+    GuiSetStyle(control, property, (int)value);
+
+    if ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))
+    {
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) GuiSetStyle(i, property, (int)value);
+    }
+}
+
+// Load file data into memory
+static unsigned char *LoadFileData(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    FILE *file = fopen(fileName, "rb");
+    *dataSize = 0;
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        int size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            data = (unsigned char *)calloc(size, 1);
+            *dataSize = (int)fread(data, 1, size, file);
+        }
+
+        fclose(file);
+    }
+    else printf("ERROR: Input file could not be opened: %s\n", fileName);
+
+    return data;
+}
+
+// Get uncompressed image data size
+// NOTE: Only formats expected for font atlas: grayscale, gray-alpha and R8G8B8A8
+static int GetPixelDataSize(int width, int height, int format)
+{
+    int bytesPerPixel = 0;
+
+    if (format == 1) bytesPerPixel = 1;         // PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+    else if (format == 2) bytesPerPixel = 2;    // PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+    else if (format == 7) bytesPerPixel = 4;    // PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+
+    return width*height*bytesPerPixel;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Raw DEFLATE decoder
+//----------------------------------------------------------------------------------
+// Get bits from input stream, least significant bit first
+static int InflateBits(InflateState *state, int count)
+{
+    unsigned int value = state->bitBuffer;
+
+    while (state->bitCount < count)
+    {
+        if (state->inputPosition >= state->inputSize)
+        {
+            state->error = true;
+            return 0;
+        }
+
+        value |= (unsigned int)state->input[state->inputPosition++] << state->bitCount;
+        state->bitCount += 8;
+    }
+
+    state->bitBuffer = value >> count;
+    state->bitCount -= count;
+
+    return (int)(value & ((1u << count) - 1));
+}
+
+// Add byte to output stream, growing it if required
+static void InflateOutput(InflateState *state, unsigned char value)
+{
+    if (state->outputSize >= state->outputCapacity)
+    {
+        state->outputCapacity = (state->outputCapacity > 0)? state->outputCapacity*2 : 4096;
+        state->output = (unsigned char *)realloc(state->output, state->outputCapacity);
+    }
+
+    state->output[state->outputSize++] = value;
+}
+
+// Build canonical huffman decoding table from code lengths
+static void InflateBuild(InflateHuffman *huffman, const short *lengths, int count)
+{
+    short offsets[16] = { 0 };
+
+    memset(huffman->counts, 0, sizeof(huffman->counts));
+    for (int i = 0; i < count; i++) huffman->counts[lengths[i]]++;
+    huffman->counts[0] = 0;
+
+    for (int length = 1; length < 15; length++) offsets[length + 1] = offsets[length] + huffman->counts[length];
+    for (int i = 0; i < count; i++) if (lengths[i] != 0) huffman->symbols[offsets[lengths[i]]++] = (short)i;
+}
+
+// Decode one symbol using huffman table
+static int InflateDecode(InflateState *state, const InflateHuffman *huffman)
+{
+    int code = 0;
+    int first = 0;
+    int index = 0;
+
+    for (int length = 1; length < 16; length++)
+    {
+        code |= InflateBits(state, 1);
+        int count = huffman->counts[length];
+
+        if ((code - count) < first) return huffman->symbols[index + (code - first)];
+
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    state->error = true;
+    return -1;
+}
+
+// Decode compressed block data with provided literal/length and distance tables
+static void InflateCodes(InflateState *state, const InflateHuffman *lengthCodes, const InflateHuffman *distanceCodes)
+{
+    static const short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const short lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const short distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const short distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    while (!state->error)
+    {
+        int symbol = InflateDecode(state, lengthCodes);
+
+        if ((symbol < 0) || (symbol == 256)) break;
+        else if (symbol < 256) InflateOutput(state, (unsigned char)symbol);
+        else
+        {
+            symbol -= 257;
+            if (symbol >= 29) { state->error = true; break; }
+
+            int length = lengthBase[symbol] + InflateBits(state, lengthExtra[symbol]);
+            int distanceSymbol = InflateDecode(state, distanceCodes);
+            if ((distanceSymbol < 0) || (distanceSymbol >= 30)) { state->error = true; break; }
+
+            int distance = distanceBase[distanceSymbol] + InflateBits(state, distanceExtra[distanceSymbol]);
+            if (distance > state->outputSize) { state->error = true; break; }
+
+            for (int i = 0; i < length; i++) InflateOutput(state, state->output[state->outputSize - distance]);
+        }
+    }
+}
+
+// Decompress raw DEFLATE data, same as raylib DecompressData()
+static unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    static const short codeLengthsOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    InflateState state = { 0 };
+    state.input = compData;
+    state.inputSize = compDataSize;
+
+    InflateHuffman lengthCodes = { 0 };
+    InflateHuffman distanceCodes = { 0 };
+    int lastBlock = 0;
+
+    while (!lastBlock && !state.error)
+    {
+        lastBlock = InflateBits(&state, 1);
+        int type = InflateBits(&state, 2);
+
+        if (type == 0)
+        {
+            // Stored block, aligned to byte boundary
+            state.bitBuffer = 0;
+            state.bitCount = 0;
+
+            if ((state.inputPosition + 4) > state.inputSize) { state.error = true; break; }
+
+            int length = state.input[state.inputPosition] | (state.input[state.inputPosition + 1] << 8);
+            state.inputPosition += 4;
+
+            if ((state.inputPosition + length) > state.inputSize) { state.error = true; break; }
+
+            for (int i = 0; i < length; i++) InflateOutput(&state, state.input[state.inputPosition++]);
+        }
+        else if (type == 1)
+        {
+            // Fixed huffman codes block
+            short lengths[288] = { 0 };
+
+            for (int i = 0; i < 288; i++) lengths[i] = (i < 144)? 8 : (i < 256)? 9 : (i < 280)? 7 : 8;
+            InflateBuild(&lengthCodes, lengths, 288);
+
+            for (int i = 0; i < 30; i++) lengths[i] = 5;
+            InflateBuild(&distanceCodes, lengths, 30);
+
+            InflateCodes(&state, &lengthCodes, &distanceCodes);
+        }
+        else if (type == 2)
+        {
+            // Dynamic huffman codes block
+            short lengths[320] = { 0 };
+            int lengthCount = InflateBits(&state, 5) + 257;
+            int distanceCount = InflateBits(&state, 5) + 1;
+            int codeCount = InflateBits(&state, 4) + 4;
+
+            for (int i = 0; i < codeCount; i++) lengths[codeLengthsOrder[i]] = (short)InflateBits(&state, 3);
+            InflateBuild(&lengthCodes, lengths, 19);
+
+            for (int index = 0; (index < (lengthCount + distanceCount)) && !state.error; )
+            {
+                int symbol = InflateDecode(&state, &lengthCodes);
+                int repeat = 0;
+                short length = 0;
+
+                if (symbol < 0) break;
+                else if (symbol < 16) { lengths[index++] = (short)symbol; continue; }
+                else if (symbol == 16)
+                {
+                    if (index == 0) { state.error = true; break; }
+                    length = lengths[index - 1];
+                    repeat = 3 + InflateBits(&state, 2);
+                }
+                else if (symbol == 17) repeat = 3 + InflateBits(&state, 3);
+                else repeat = 11 + InflateBits(&state, 7);
+
+                if ((index + repeat) > (lengthCount + distanceCount)) { state.error = true; break; }
+                while (repeat-- > 0) lengths[index++] = length;
+            }
+
+            InflateBuild(&lengthCodes, lengths, lengthCount);
+            InflateBuild(&distanceCodes, lengths + lengthCount, distanceCount);
+
+            InflateCodes(&state, &lengthCodes, &distanceCodes);
+        }
+        else state.error = true;
+    }
+
+    if (state.error)
+    {
+        free(state.output);
+        state.output = NULL;
+        state.outputSize = 0;
+    }
+
+    *dataSize = state.outputSize;
+
+    return state.output;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: raygui required functions (no drawing)
+//----------------------------------------------------------------------------------
+static const char *GetClipboardText(void) { return NULL; }
+static int GetScreenWidth(void) { return 0; }
+static int GetScreenHeight(void) { return 0; }
+
+static void DrawRectangle(int x, int y, int width, int height, Color color) { (void)x; (void)y; (void)width; (void)height; (void)color; }
+static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4) { (void)rec; (void)col1; (void)col2; (void)col3; (void)col4; }
+static void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) { (void)texture; (void)source; (void)dest; (void)origin; (void)rotation; (void)tint; }
+static void BeginScissorMode(int x, int y, int width, int height) { (void)x; (void)y; (void)width; (void)height; }
+static void EndScissorMode(void) { }
+
+// NOTE: Default font recs are required by GuiLoadStyleDefault(), white rectangle from rec 95
+static Font GetFontDefault(void)
+{
+    static Rectangle recs[96] = { 0 };
+    static GlyphInfo glyphs[96] = { 0 };
+
+    Font font = { 0 };
+    font.glyphCount = 96;
+    font.texture.id = 1;
+    font.recs = recs;
+    font.glyphs = glyphs;
+
+    return font;
+}
+
+static Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount) { (void)fileName; (void)fontSize; (void)codepoints; (void)codepointCount; return GetFontDefault(); }
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) { (void)font; (void)codepoint; (void)position; (void)fontSize; (void)tint; }
+static Texture2D LoadTextureFromImage(Image image) { (void)image; Texture2D texture = { 0 }; return texture; }
+static void UnloadTexture(Texture2D texture) { (void)texture; }
+static void SetShapesTexture(Texture2D texture, Rectangle rec) { (void)texture; (void)rec; }
+static char *LoadFileText(const char *fileName) { (void)fileName; return NULL; }
+static void UnloadFileText(char *text) { (void)text; }
+static const char *GetDirectoryPath(const char *filePath) { (void)filePath; return ""; }
+static int *LoadCodepoints(const char *text, int *count) { (void)text; *count = 0; return NULL; }
+static void UnloadCodepoints(int *codepoints) { (void)codepoints; }
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing) { (void)font; (void)text; (void)fontSize; (void)spacing; Vector2 size = { 0 }; return size; }
@@ -89,6 +89,16 @@
 *
 *       Custom control properties can be defined using the EXTENDED properties for each independent control.
 *
+*       Metric properties (border widths, paddings, text size/spacing, items sizes...) are resolved for the
+*       gui scale set with GuiSetScale(), loaded styles define them in unscaled units and values stored in
+*       guiStyle are already scaled, so controls read them with no extra operations; values set with
+*       GuiSetStyle() are considered already scaled (screen pixels) and kept as value/scale, values set with
+*       GuiSetStyleUnscaled() are kept exactly, so they never drift with fractional scales changes
+*
+*       NOTE: Gui scale applies to style metrics, icons and text style fonts (.rgs font files are generated
+*       again at new scale, embedded font atlases are scaled, SDF fonts keep sharp); controls bounds and
+*       pointer position are not scaled, bounds are provided in screen pixels (i.e. multiplied by GuiGetScale())
+*
 *       TOOL: rGuiStyler is a visual tool to customize raygui style: github.com/raysan5/rguistyler
 *
 *
@@ -111,11 +121,65 @@
 *       TOOL: rGuiIcons is a visual tool to customize/create raygui icons: github.com/raysan5/rguiicons
 *
 *   RAYGUI LAYOUT:
-*       raygui currently does not provide an auto-layout mechanism like other libraries,
-*       layouts must be defined manually on controls drawing, providing the right bounds Rectangle for it
+*       raygui provides a simple auto-layout mechanism with row, column and grid containers,
+*       GuiLayoutBegin() receives container bounds and items sizes (fixed, percent, fill or text measured)
+*       and every GuiLayoutNext() call returns next item bounds, to be provided to controls:
+*
+*           GuiLayoutItem items[3] = { { LAYOUT_SIZE_TEXT, 8, "Name:" }, { LAYOUT_SIZE_FILL, 1 }, { LAYOUT_SIZE_FIXED, 24 } };
+*           GuiLayoutBegin(bounds, LAYOUT_ROW, items, 3, 4);
+*               GuiLabel(GuiLayoutNext(), "Name:");
+*               GuiTextBox(GuiLayoutNext(), name, 64, editMode);
+*               GuiButton(GuiLayoutNext(), "#9#");
+*           GuiLayoutEnd();
+*
+*       Containers can be nested, computed items bounds are cached (relative to container position)
+*       and only recomputed when container size, items or text style change
 *
 *       TOOL: rGuiLayout is a visual tool to create raygui layouts: github.com/raysan5/rguilayout
 *
+*   RAYGUI CONTROLS IDS:
+*       Every control takes a 64-bit id (GuiID), hashed from current id scope and controls sequence,
+*       sequence is restarted on every GuiBeginFrame() call, ids identify the control processing inputs
+*       in exclusive mode (i.e. a slider being dragged)
+*
+*       WARNING: GuiBeginFrame() is required for stable ids, frames can not be detected otherwise; if it is
+*       not called, control bounds are hashed instead (previous raygui behaviour), so a control moving while
+*       dragged (i.e. inside a window being moved) or two controls sharing bounds are not told apart
+*
+*       GuiPushID()/GuiPushIDInt() and GuiPopID() define id scopes, useful to keep ids stable when some
+*       controls are conditionally drawn; controls containing other controls scope their child controls ids
+*
+*   RAYGUI CONTEXTS:
+*       All gui state (style, font, controls state, ids, caches and internal buffers) is kept in a GuiContext,
+*       a default context is used if none is set; GuiCreateContext() creates additional contexts and
+*       GuiSetCurrentContext() selects the context used by following calls on the calling thread, so
+*       independent guis (i.e. multiple windows or worker threads rendering offscreen) do not share state
+*
+*       NOTE: Contexts should be created on rendering thread, they copy current context style and font,
+*       default style is loaded first if required (backend resources), never lazily on worker threads;
+*       context caches are allocated on first use, so every context only pays for the features used
+*
+*       NOTE: Icons data is not part of the context, it is shared by all contexts
+*
+*   RAYGUI COMMAND LISTS:
+*       With RAYGUI_COMMAND_LISTS defined, drawing can be recorded into a GuiCommandList instead of being
+*       submitted to the backend, independent windows can be built in parallel (one context per thread)
+*       and recorded lists merged by z-order (ties keep lists order) on the rendering thread:
+*
+*           // Worker thread, window i, context style copied from main context
+*           GuiSetCurrentContext(windowContext[i]);
+*           GuiBeginCommandList(&windowCommands[i], windowOrder[i]);
+*               GuiWindowBox(windowBounds[i], "#198#WINDOW");
+*               ...
+*           GuiEndCommandList();
+*
+*           // Rendering thread, once all workers finished
+*           GuiDrawCommandLists(windowCommands, windowCount);
+*
+*       Drawing output is the same as building the windows one after another in z-order
+*       NOTE: Every context processes its own inputs, use RAYGUI_INPUT_STATE to provide them per context,
+*       hit-testing and exclusive mode are also resolved per context (windows should not overlap)
+*
 *   CONFIGURATION:
 *       #define RAYGUI_IMPLEMENTATION
 *           Generates the implementation of the library into the included file
@@ -138,12 +202,69 @@
 *           On gui font loading from style file, append the icons to font atlas image, so,
 *           icons can be drawn along the text as a texture, instead of using shapes to draw them
 *
+*       #define RAYGUI_NO_FONT_SHADER
+*           Do not use the default SDF font shader (raylib), SDF fonts from style files are evaluated on CPU
+*           into a coverage atlas for current text size on loading, unless shader callbacks are set with
+*           GuiSetFontShaderCallbacks(), default shader is GLSL 330, RAYGUI_FONT_SHADER_FS can redefine it
+*           NOTE: Evaluated atlas is baked for DEFAULT TEXT_SIZE at loading time, later TEXT_SIZE or gui scale
+*           changes are not re-evaluated (text is scaled from baked atlas), style must be reloaded for them
+*           NOTE: With font shader, shader is kept active between consecutive texts and ended before next
+*           non-text drawing, GuiEndFrame() must be called after controls (before any other drawing)
+*
+*       #define RAYGUI_NO_PATTERN_TEXTURE
+*           Draw patterns (GuiColorBarAlpha() checkerboard) with one rectangle per cell instead of tiling
+*           a small pattern texture, more quads but no texture switch (batch break) when drawing them
+*
 *       #define RAYGUI_DEBUG_RECS_BOUNDS
 *           Draw control bounds rectangles for debug
 *
 *       #define RAYGUI_DEBUG_TEXT_BOUNDS
 *           Draw text bounds rectangles for debug
 *
+*       #define RAYGUI_FRAME_STATS
+*           Enable hot-path counters (rectangles, glyphs, icon pixels, style reads, text measurements,
+*           text splits, static buffers usage), retrieved with GuiGetFrameStats() and reset per frame
+*           with GuiResetFrameStats(), counters are compiled out when not defined
+*
+*       #define RAYGUI_PROFILE
+*           Enable profiling scopes (RAYGUI_PROFILE_BEGIN/RAYGUI_PROFILE_END) around all controls and
+*           main internal functions, scopes call user callbacks set with GuiSetProfileCallbacks() or
+*           can be written to a trace file (chrome://tracing, Perfetto) with GuiTraceBegin()/GuiTraceEnd()
+*           NOTE: RAYGUI_PROFILE_BEGIN(name)/RAYGUI_PROFILE_END(name) can also be defined by user
+*           to redirect scopes to a custom profiler (i.e. Tracy), compiled out when not defined
+*
+*       #define RAYGUI_INPUT_STATE
+*           Read all controls inputs from a per-frame input snapshot (GuiInputState) instead of polling
+*           the backend on every use, snapshot must be captured once per frame with GuiUpdateInputState()
+*           (uses GUI_* input mapping macros) or provided by user with GuiSetInputState()
+*           NOTE: In RAYGUI_STANDALONE mode, backend input functions are not required, GuiSetInputState() must be used
+*           Input state can be recorded to a file (.rgi) and replayed later in place of live input, for
+*           deterministic testing and benchmarking, using GuiInputRecordBegin() and GuiInputReplayBegin()
+*
+*       #define RAYGUI_HITTEST
+*           Resolve a single hovered control per frame (topmost, last drawn) instead of every control
+*           checking the pointer on its own, overlapping controls do not react together and non-hovered
+*           controls skip their update logic; controls bounds are registered into a uniform grid while
+*           drawn and hovered control is resolved on GuiBeginFrame(), required to be called once per frame,
+*           containers (panel, window box, group box, scroll panel) are registered too, occluding controls below
+*           NOTE: Controls are identified by drawing order and bounds, so hover resolution is delayed one frame
+*
+*       #define RAYGUI_THREAD_LOCAL
+*           Storage qualifier for current context pointer, by default thread-local (thread_local, _Thread_local,
+*           __thread or __declspec(thread) depending on compiler), define it empty to share current context
+*           between all threads
+*
+*       #define RAYGUI_COMMAND_LISTS
+*           Allow recording drawing into command lists (GuiBeginCommandList()/GuiEndCommandList()),
+*           drawn later on any thread with GuiDrawCommandLists(), merged by z-order
+*
+*       #define RAYGUI_STYLE_HOT_RELOAD
+*           Allow watching a style file (.rgs) with GuiWatchStyle(), its modification time is checked on
+*           GuiBeginFrame() every RAYGUI_STYLE_WATCH_FRAMES frames and, when modified (and unchanged on next check,
+*           so it is not reloaded while being written), only properties that differ from current style are applied,
+*           font is only reloaded if its data hash changed, truncated style files are not applied
+*           NOTE: In RAYGUI_STANDALONE mode, GetFileModTime() must be provided by user
+*
 *   VERSIONS HISTORY:
 *       5.0 (20-Jul-2026) ADDED: NEW control: GuiTabBar()
 *                         ADDED: Support up to 512 icons (v500)
@@ -292,6 +413,7 @@
 *       with the config flag RAYGUI_STANDALONE. In that case is up to the user to provide another backend to cover library needs
 *
 *       The following functions should be redefined for a custom backend:
+*       NOTE: Input functions are not required if RAYGUI_INPUT_STATE is defined, use GuiSetInputState()
 *
 *           - Vector2 GetMousePosition(void);
 *           - float GetMouseWheelMove(void);
@@ -301,13 +423,22 @@
 *           - bool IsKeyDown(int key);
 *           - bool IsKeyPressed(int key);
 *           - int GetCharPressed(void);         // -- GuiTextBox(), GuiValueBox()
+*           - const char *GetClipboardText(void);   // -- GuiTextBox()
+*
+*           - int GetScreenWidth(void);         // -- GuiTooltip()
+*           - int GetScreenHeight(void);        // -- GuiTooltip()
 *
 *           - void DrawRectangle(int x, int y, int width, int height, Color color); // -- GuiDrawRectangle()
 *           - void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4); // -- GuiColorPicker()
+*           - void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // -- GuiDrawIcon(), GuiColorBarAlpha() (tiled, wrap repeat)
+*           - void BeginScissorMode(int x, int y, int width, int height); // -- GuiPushClip()
+*           - void EndScissorMode(void);        // -- GuiPopClip()
 *
 *           - Font GetFontDefault(void);                            // -- GuiLoadStyleDefault()
 *           - Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // -- GuiLoadStyle()
-*           - Texture2D LoadTextureFromImage(Image image);          // -- GuiLoadStyle(), required to load texture from embedded font atlas image
+*           - void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // -- GuiDrawText()
+*           - Texture2D LoadTextureFromImage(Image image);          // -- GuiLoadStyle(), GuiColorBarAlpha(), required to load font atlas and pattern textures
+*           - void UnloadTexture(Texture2D texture);                // -- GuiLoadStyle(), required to unload previous font atlas texture
 *           - void SetShapesTexture(Texture2D tex, Rectangle rec);  // -- GuiLoadStyle(), required to set shapes rec to font white rec (optimization)
 *           - char *LoadFileText(const char *fileName);             // -- GuiLoadStyle(), required to load charset data
 *           - void UnloadFileText(char *text);                      // -- GuiLoadStyle(), required to unload charset data
@@ -316,6 +447,8 @@
 *           - void UnloadCodepoints(int *codepoints);               // -- GuiLoadStyle(), required to unload codepoints list
 *           - unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize); // -- GuiLoadStyle()
 *
+*           - double GetTime(void);             // -- GuiTraceBegin(), only required with RAYGUI_PROFILE
+*
 *   CONTRIBUTORS:
 *       Ramon Santamaria:   Supervision, review, redesign, update and maintenance
 *       Vlad Adrian:        Complete rewrite of GuiTextBox() to support extended features (2019)
@@ -395,6 +528,16 @@
     #define RAYGUI_LOG(...)
 #endif
 
+// Maximum number of unicode codepoints stored per frame on input state
+#if !defined(RAYGUI_INPUT_MAX_CHARS)
+    #define RAYGUI_INPUT_MAX_CHARS      16
+#endif
+
+// Maximum clipboard text size stored per frame on input record/replay
+#if !defined(RAYGUI_INPUT_MAX_CLIPBOARD_SIZE)
+    #define RAYGUI_INPUT_MAX_CLIPBOARD_SIZE   1024
+#endif
+
 #if !defined(RAYGUI_STANDALONE)
 // Macros to define required UI inputs, including mapping to gamepad controls
 #if !defined(GUI_BUTTON_DOWN)
@@ -435,17 +578,45 @@
 #if !defined(GUI_INPUT_KEY)
     #define GUI_INPUT_KEY           GetCharPressed()
 #endif
+#if !defined(GUI_CLIPBOARD_TEXT)
+    #define GUI_CLIPBOARD_TEXT      GetClipboardText()
+#endif
 #else
-    #define GUI_BUTTON_DOWN         0
-    #define GUI_BUTTON_DOWN_ALT     0
-    #define GUI_BUTTON_PRESSED      0
-    #define GUI_BUTTON_PRESSED_MID  0
-    #define GUI_BUTTON_RELEASED     0
-    #define GUI_SCROLL_DELTA        0
-    #define GUI_POINTER_POSITION    (Vector2){ 0 }
-    #define GUI_KEY_DOWN(key)       0
-    #define GUI_KEY_PRESSED(key)    0
-    #define GUI_INPUT_KEY           0
+// Macros to define required UI inputs, mapped to the backend functions provided by the user
+// NOTE: No gamepad mapping is done in standalone mode, backend can redefine any of them
+#if !defined(GUI_BUTTON_DOWN)
+    #define GUI_BUTTON_DOWN         IsMouseButtonDown(MOUSE_LEFT_BUTTON)
+#endif
+#if !defined(GUI_BUTTON_DOWN_ALT)
+    #define GUI_BUTTON_DOWN_ALT     IsMouseButtonDown(MOUSE_RIGHT_BUTTON)
+#endif
+#if !defined(GUI_BUTTON_PRESSED)
+    #define GUI_BUTTON_PRESSED      IsMouseButtonPressed(MOUSE_LEFT_BUTTON)
+#endif
+#if !defined(GUI_BUTTON_PRESSED_MID)
+    #define GUI_BUTTON_PRESSED_MID  IsMouseButtonPressed(MOUSE_MIDDLE_BUTTON)
+#endif
+#if !defined(GUI_BUTTON_RELEASED)
+    #define GUI_BUTTON_RELEASED     IsMouseButtonReleased(MOUSE_LEFT_BUTTON)
+#endif
+#if !defined(GUI_SCROLL_DELTA)
+    #define GUI_SCROLL_DELTA        GetMouseWheelMove()
+#endif
+#if !defined(GUI_POINTER_POSITION)
+    #define GUI_POINTER_POSITION    GetMousePosition()
+#endif
+#if !defined(GUI_KEY_DOWN)
+    #define GUI_KEY_DOWN(key)       IsKeyDown(key)
+#endif
+#if !defined(GUI_KEY_PRESSED)
+    #define GUI_KEY_PRESSED(key)    IsKeyPressed(key)
+#endif
+#if !defined(GUI_INPUT_KEY)
+    #define GUI_INPUT_KEY           GetCharPressed()
+#endif
+#if !defined(GUI_CLIPBOARD_TEXT)
+    #define GUI_CLIPBOARD_TEXT      GetClipboardText()
+#endif
 #endif
 
 //----------------------------------------------------------------------------------
@@ -542,6 +713,118 @@ typedef struct GuiStyleProp {
     int propertyValue;          // Property value
 } GuiStyleProp;
 
+// Gui control id, 64-bit hash identifying a control along frames
+typedef unsigned long long GuiID;
+
+// Gui context, opaque type containing all gui state
+typedef struct GuiContext GuiContext;
+
+// Gui frame stats, hot-path counters
+// NOTE: Only updated if RAYGUI_FRAME_STATS is defined, reset with GuiResetFrameStats()
+typedef struct GuiFrameStats {
+    int rectangles;             // Rectangles issued (including borders and icon pixels)
+    int glyphs;                 // Glyphs drawn
+    int iconPixels;             // Icon pixels drawn (one rectangle per pixel)
+    int styleReads;             // GuiGetStyle() calls
+    int textMeasures;           // Text measurements (line width and word width computations)
+    int textSplits;             // GuiTextSplit() calls
+    int bufferBytes;            // Bytes written into static/temporary buffers
+} GuiFrameStats;
+
+// Gui input keys, tracked as flags on input state
+// NOTE: Only keys required by raygui controls are tracked
+typedef enum {
+    INPUT_KEY_ENTER         = 0x0001,
+    INPUT_KEY_KP_ENTER      = 0x0002,
+    INPUT_KEY_BACKSPACE     = 0x0004,
+    INPUT_KEY_DELETE        = 0x0008,
+    INPUT_KEY_RIGHT         = 0x0010,
+    INPUT_KEY_LEFT          = 0x0020,
+    INPUT_KEY_DOWN          = 0x0040,
+    INPUT_KEY_UP            = 0x0080,
+    INPUT_KEY_HOME          = 0x0100,
+    INPUT_KEY_END           = 0x0200,
+    INPUT_KEY_MINUS         = 0x0400,
+    INPUT_KEY_V             = 0x0800,
+    INPUT_KEY_LEFT_SHIFT    = 0x1000,
+    INPUT_KEY_LEFT_CONTROL  = 0x2000,
+    INPUT_KEY_RIGHT_CONTROL = 0x4000
+} GuiInputKey;
+
+// Gui input state, inputs snapshot for current frame
+// NOTE: Only used if RAYGUI_INPUT_STATE is defined
+typedef struct GuiInputState {
+    Vector2 pointer;            // Pointer position
+    float scrollDelta;          // Scroll delta (mouse wheel + gamepad triggers)
+    bool buttonDown;            // Primary button down
+    bool buttonDownAlt;         // Alternative button down
+    bool buttonPressed;         // Primary button pressed
+    bool buttonPressedMid;      // Middle button pressed
+    bool buttonReleased;        // Primary button released
+    unsigned int keysDown;      // Keys down (GuiInputKey flags)
+    unsigned int keysPressed;   // Keys pressed (GuiInputKey flags)
+    int chars[RAYGUI_INPUT_MAX_CHARS]; // Unicode codepoints pressed (queue)
+    int charCount;              // Unicode codepoints pressed count
+} GuiInputState;
+
+// Gui profile callback, called on scope begin/end with a static scope name
+typedef void (*GuiProfileCallback)(const char *name, void *userData);
+
+// Gui layout container type
+typedef enum {
+    LAYOUT_ROW = 0,             // Items placed left to right, sizes along width
+    LAYOUT_COLUMN,              // Items placed top to bottom, sizes along height
+    LAYOUT_GRID                 // Items placed on equal width columns, sizes along rows height
+} GuiLayoutType;
+
+// Gui layout item size mode
+typedef enum {
+    LAYOUT_SIZE_FIXED = 0,      // Size in pixels (unscaled, gui scale applied)
+    LAYOUT_SIZE_PERCENT,        // Size as percentage [0..100] of container size
+    LAYOUT_SIZE_FILL,           // Share of remaining size, proportional to size value (weight)
+    LAYOUT_SIZE_TEXT            // Measured text size, size value added as padding (unscaled, gui scale applied)
+} GuiLayoutSizeMode;
+
+// Gui layout item, defines one item size on a layout container
+typedef struct GuiLayoutItem {
+    int mode;                   // Size mode (GuiLayoutSizeMode)
+    float size;                 // Size value, depends on mode: pixels, percentage, weight or padding
+    const char *text;           // Text to measure (LAYOUT_SIZE_TEXT only)
+} GuiLayoutItem;
+
+// Gui drawing command type
+typedef enum {
+    COMMAND_RECTANGLE = 0,      // Rectangle, DrawRectangle()
+    COMMAND_RECTANGLE_GRADIENT, // Rectangle with vertex colors, DrawRectangleGradientEx()
+    COMMAND_TEXTURE,            // Texture rectangle, DrawTexturePro()
+    COMMAND_CODEPOINT,          // Font codepoint, DrawTextCodepoint()
+    COMMAND_SCISSOR_BEGIN,      // Scissor area begin, BeginScissorMode()
+    COMMAND_SCISSOR_END,        // Scissor area end, EndScissorMode()
+    COMMAND_FONT_SHADER_BEGIN,  // SDF font shader begin, font shader begin callback
+    COMMAND_FONT_SHADER_END     // SDF font shader end, font shader end callback
+} GuiCommandType;
+
+// Gui drawing command, one backend drawing call
+// NOTE: Only used if RAYGUI_COMMAND_LISTS is defined
+typedef struct GuiCommand {
+    int type;                   // Command type (GuiCommandType)
+    Rectangle bounds;           // Rectangle, texture destination or scissor area (codepoint position on x, y)
+    Rectangle source;           // Texture source rectangle
+    Color colors[4];            // Colors, only gradient rectangle uses all of them (DrawRectangleGradientEx() order)
+    Texture2D texture;          // Texture (COMMAND_TEXTURE)
+    Font font;                  // Font (COMMAND_CODEPOINT)
+    int codepoint;              // Codepoint (COMMAND_CODEPOINT)
+    float fontSize;             // Font size (COMMAND_CODEPOINT)
+} GuiCommand;
+
+// Gui drawing commands list, recorded by a context, drawn by z-order
+typedef struct GuiCommandList {
+    GuiCommand *commands;       // Commands array
+    int count;                  // Commands recorded
+    int capacity;               // Commands allocated, array grows on recording if required
+    int order;                  // Z-order, lists with lower order are drawn first
+} GuiCommandList;
+
 /*
 // Controls text style -NOT USED-
 // NOTE: Text style is defined by control
@@ -595,6 +878,13 @@ typedef enum {
     TEXT_WRAP_WORD
 } GuiTextWrapMode;
 
+// Gui font type, font atlas content
+// NOTE: SDF font atlas is valid for any text size, drawn with font shader
+typedef enum {
+    FONT_TYPE_NORMAL = 0,       // Font atlas with glyphs coverage, rasterized for base size
+    FONT_TYPE_SDF               // Font atlas with glyphs signed distance field
+} GuiFontType;
+
 // Gui controls
 // NOTE: Up to 16 controls supported or 32 controls (v500)
 typedef enum {
@@ -725,7 +1015,8 @@ typedef enum {
     ARROW_PADDING = 16,         // DropdownBox arrow separation from border and items
     DROPDOWN_ITEMS_SPACING,     // DropdownBox items separation
     DROPDOWN_ARROW_HIDDEN,      // DropdownBox arrow hidden
-    DROPDOWN_ROLL_UP            // DropdownBox roll up flag: 0-Roll down, 1-Roll up
+    DROPDOWN_ROLL_UP,           // DropdownBox roll up flag: 0-Roll down, 1-Roll up
+    DROPDOWN_MAX_VISIBLE_ITEMS  // DropdownBox maximum visible items when open: 0-No limit, scroll bar shown if exceeded
 } GuiDropdownBoxProperty;
 
 // TextBox/TextBoxMulti/ValueBox/Spinner
@@ -768,6 +1059,12 @@ typedef enum {
     HUEBAR_SELECTOR_OVERFLOW    // ColorPicker right hue bar selector overflow
 } GuiColorPickerProperty;
 
+// ColorPalette sort modes
+typedef enum {
+    PALETTE_SORT_HUE = 0,       // Sort by hue, then by value
+    PALETTE_SORT_VALUE          // Sort by value, then by hue
+} GuiColorPaletteSortMode;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -788,22 +1085,91 @@ RAYGUIAPI void GuiLock(void);                                   // Lock gui cont
 RAYGUIAPI void GuiUnlock(void);                                 // Unlock gui controls (global state)
 RAYGUIAPI bool GuiIsLocked(void);                               // Check if gui is locked (global state)
 RAYGUIAPI void GuiSetAlpha(float alpha);                        // Set gui controls alpha (global state), alpha goes from 0.0f to 1.0f
+RAYGUIAPI void GuiSetScale(float scale);                        // Set gui scale (global state), metric style properties, icons and text style font resolved for it (not bounds or pointer)
+RAYGUIAPI float GuiGetScale(void);                              // Get gui scale (global state)
 RAYGUIAPI void GuiSetState(int state);                          // Set gui state (global state)
 RAYGUIAPI int GuiGetState(void);                                // Get gui state (global state)
+RAYGUIAPI void GuiBeginFrame(void);                             // Begin gui frame, call it once per frame before controls (after input update), required for stable controls ids
+RAYGUIAPI void GuiEndFrame(void);                               // End gui frame, call it once per frame after controls (before any other drawing)
+
+// Context functions
+RAYGUIAPI GuiContext *GuiCreateContext(void);                   // Create gui context, style and font copied from current context
+RAYGUIAPI void GuiDestroyContext(GuiContext *context);          // Destroy gui context, if current, default context is set
+RAYGUIAPI void GuiSetCurrentContext(GuiContext *context);       // Set current gui context for calling thread (NULL for default context)
+RAYGUIAPI GuiContext *GuiGetCurrentContext(void);               // Get current gui context for calling thread
+RAYGUIAPI void GuiCopyContextStyle(GuiContext *context, GuiContext *source); // Copy style and font from source context (NULL for default context)
+
+#if defined(RAYGUI_COMMAND_LISTS)
+// Command lists functions
+RAYGUIAPI GuiCommandList GuiLoadCommandList(int capacity);      // Load command list with initial capacity (commands)
+RAYGUIAPI void GuiUnloadCommandList(GuiCommandList list);       // Unload command list
+RAYGUIAPI void GuiBeginCommandList(GuiCommandList *list, int order); // Begin recording current context drawing into command list (list cleared)
+RAYGUIAPI void GuiEndCommandList(void);                         // End recording, drawing goes to backend again
+RAYGUIAPI void GuiDrawCommandLists(const GuiCommandList *lists, int count); // Draw command lists, merged by z-order (same order keeps lists order)
+#endif
+
+// Clipping functions
+RAYGUIAPI void GuiPushClip(Rectangle bounds);                   // Push clip region (intersected with current one), controls outside it are culled
+RAYGUIAPI void GuiPopClip(void);                                // Pop clip region, restoring previous one
+RAYGUIAPI Rectangle GuiGetClip(void);                           // Get current clip region, screen rectangle if no clip region pushed
+
+// Control id functions
+RAYGUIAPI void GuiPushID(const char *strId);                    // Push string id scope, following controls ids are hashed with it
+RAYGUIAPI void GuiPushIDInt(int intId);                         // Push integer id scope, following controls ids are hashed with it
+RAYGUIAPI void GuiPopID(void);                                  // Pop id scope, restoring previous one
+RAYGUIAPI GuiID GuiGetID(const char *strId);                    // Get id for string on current id scope
+
+// Layout functions
+RAYGUIAPI void GuiLayoutBegin(Rectangle bounds, int type, const GuiLayoutItem *items, int count, float spacing); // Begin layout container (row/column), computing items bounds (cached)
+RAYGUIAPI void GuiLayoutGridBegin(Rectangle bounds, int columns, const GuiLayoutItem *items, int count, float spacing); // Begin layout grid container, items sizes define rows height (cached)
+RAYGUIAPI Rectangle GuiLayoutNext(void);                        // Get next item bounds on current layout container
+RAYGUIAPI void GuiLayoutEnd(void);                              // End layout container, restoring parent container (if any)
 
 // Font set/get functions
 RAYGUIAPI void GuiSetFont(Font font);                           // Set gui custom font (global state)
 RAYGUIAPI Font GuiGetFont(void);                                // Get gui custom font (global state)
+RAYGUIAPI void GuiSetFontType(int type);                        // Set gui custom font type (GuiFontType), reset to normal on GuiSetFont()
+RAYGUIAPI int GuiGetFontType(void);                             // Get gui custom font type (GuiFontType)
+RAYGUIAPI void GuiSetFontShaderCallbacks(void (*begin)(void), void (*end)(void)); // Set SDF font shader callbacks, NULL for default shader (requires raylib)
+RAYGUIAPI void GuiEvalFontSDF(Image *image, float scale);       // Evaluate SDF font atlas image into glyphs coverage for a text scale (CPU path)
+RAYGUIAPI bool GuiLoadFontLazy(const char *fileName, int fontSize); // Load font with glyphs rasterized on first use into atlas pages, set as gui font (requires raylib)
+RAYGUIAPI void GuiUnloadFontLazy(void);                         // Unload lazy font (atlas, glyphs and font data), default font set if it was gui font
 
 // Style set/get functions
-RAYGUIAPI void GuiSetStyle(int control, int property, int value); // Set one style property
+RAYGUIAPI void GuiSetStyle(int control, int property, int value); // Set one style property, metric values in scaled pixels
+RAYGUIAPI void GuiSetStyleUnscaled(int control, int property, int value); // Set one style property, metric values unscaled (resolved for gui scale)
 RAYGUIAPI int GuiGetStyle(int control, int property);           // Get one style property
 
+// Frame stats functions (requires RAYGUI_FRAME_STATS, zeroed otherwise)
+RAYGUIAPI GuiFrameStats GuiGetFrameStats(void);                 // Get frame stats, counters accumulated since last reset
+RAYGUIAPI void GuiResetFrameStats(void);                        // Reset frame stats, call it once per frame
+
+// Profiling functions (requires RAYGUI_PROFILE, no effect otherwise)
+RAYGUIAPI void GuiSetProfileCallbacks(GuiProfileCallback begin, GuiProfileCallback end, void *userData); // Set profile scopes callbacks
+RAYGUIAPI bool GuiTraceBegin(const char *fileName);             // Begin writing profile scopes to a trace file (.json)
+RAYGUIAPI void GuiTraceEnd(void);                               // End writing profile scopes, close trace file
+
+// Input state functions (requires RAYGUI_INPUT_STATE, no effect otherwise)
+#if !defined(RAYGUI_STANDALONE)
+RAYGUIAPI void GuiUpdateInputState(void);                       // Update input state from backend, call it once per frame before controls
+#endif
+RAYGUIAPI void GuiSetInputState(GuiInputState state);           // Set input state provided by user, call it once per frame before controls
+RAYGUIAPI GuiInputState GuiGetInputState(void);                 // Get current input state
+RAYGUIAPI bool GuiInputRecordBegin(const char *fileName);       // Begin recording input state per frame into a file (.rgi)
+RAYGUIAPI void GuiInputRecordEnd(void);                         // End recording input state, close file
+RAYGUIAPI bool GuiInputReplayBegin(const char *fileName);       // Begin replaying input state from a file (.rgi), replaces live input
+RAYGUIAPI void GuiInputReplayEnd(void);                         // End replaying input state, close file
+RAYGUIAPI bool GuiIsInputReplaying(void);                       // Check if input is being replayed, false once all frames are replayed
+
 // Styles loading functions
 RAYGUIAPI void GuiLoadStyle(const char *fileName);              // Load style file over global style variable (.rgs)
 RAYGUIAPI void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize); // Load style from memory (binary only)
 RAYGUIAPI void GuiLoadStyleDefault(void);                       // Load style default over global style
 
+// Style hot-reload functions (requires RAYGUI_STYLE_HOT_RELOAD, no effect otherwise)
+RAYGUIAPI bool GuiWatchStyle(const char *fileName);             // Load style file (.rgs) and watch it for changes, NULL to stop watching
+RAYGUIAPI int GuiUpdateStyleWatch(void);                        // Check watched style file, apply changed properties (called by GuiBeginFrame())
+
 // Tooltips management functions
 RAYGUIAPI void GuiEnableTooltip(void);                          // Enable gui tooltips (global state)
 RAYGUIAPI void GuiDisableTooltip(void);                         // Disable gui tooltips (global state)
@@ -830,6 +1196,9 @@ RAYGUIAPI int GuiGroupBox(Rectangle bounds, const char *text);
 RAYGUIAPI int GuiLine(Rectangle bounds, const char *text);                                             // Line separator control, could contain text
 RAYGUIAPI int GuiPanel(Rectangle bounds, const char *text);                                            // Panel control, useful to group controls
 RAYGUIAPI int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector2 *scroll, Rectangle *view); // Scroll Panel control
+RAYGUIAPI int GuiScrollPanelEx(Rectangle bounds, const char *text, double contentWidth, double contentHeight, double *scrollX, double *scrollY, Rectangle *view); // Scroll Panel control with double precision scroll (large content)
+RAYGUIAPI int GuiGetVisibleRange(double scroll, float viewHeight, float itemHeight, int itemCount, int *first, int *last); // Get visible items range for fixed height items, returns visible count
+RAYGUIAPI int GuiGetVisibleRangeEx(double scroll, float viewHeight, const double *offsets, int itemCount, int *first, int *last); // Get visible items range for prefix-summed heights, returns visible count
 
 // Basic controls set
 RAYGUIAPI int GuiLabel(Rectangle bounds, const char *text);                                            // Label control
@@ -853,6 +1222,7 @@ RAYGUIAPI int GuiProgressBar(Rectangle bounds, const char *textLeft, const char
 RAYGUIAPI int GuiStatusBar(Rectangle bounds, const char *text);                                        // Status Bar control, shows info text
 RAYGUIAPI int GuiDummyRec(Rectangle bounds, const char *text);                                         // Dummy control for placeholders
 RAYGUIAPI int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vector2 *mouseCell); // Grid control
+RAYGUIAPI int GuiGridEx(Rectangle bounds, const char *text, float spacing, int subdivs, Vector2 *offset, float *zoom, Vector2 *mouseCell); // Grid control, infinite canvas with pan/zoom and level-of-detail lines
 
 // Advance controls set
 RAYGUIAPI int GuiListView(Rectangle bounds, const char *text, int *scrollIndex, int *active);          // List View control
@@ -867,6 +1237,10 @@ RAYGUIAPI int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
 RAYGUIAPI int GuiColorBarHue(Rectangle bounds, const char *text, float *value);                        // Color Bar Hue control
 RAYGUIAPI int GuiColorPickerHSV(Rectangle bounds, const char *text, Vector3 *colorHsv);                // Color Picker control, using Hue-Saturation-Value color data, includes Color bar controls
 RAYGUIAPI int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv);                 // Color Panel control, using Hue-Saturation-Value color data
+RAYGUIAPI int GuiColorPalette(Rectangle bounds, const char *text, const Color *colors, int count, int columns, int *active); // Color Palette control, grid of color swatches, returns selected swatch
+RAYGUIAPI void GuiColorPaletteSort(Color *colors, int count, int mode);                               // Sort color palette by hue or value (GuiColorPaletteSortMode), stable
+RAYGUIAPI void GuiColorsToHSV(const Color *colors, Vector3 *hsv, int count);                          // Convert colors array to Hue-Saturation-Value (hue in degrees)
+RAYGUIAPI void GuiColorsFromHSV(const Vector3 *hsv, Color *colors, int count);                        // Convert Hue-Saturation-Value array to colors (opaque)
 //----------------------------------------------------------------------------------------------------------
 
 #if !defined(RAYGUI_NO_ICONS)
@@ -1153,9 +1527,9 @@ typedef enum {
 #if defined(RAYGUI_IMPLEMENTATION)
 
 #include <stdio.h>              // Required for: FILE, fopen(), fclose(), fprintf(), feof(), fscanf(), snprintf(), vsprintf() [GuiLoadStyle(), GuiLoadIcons()]
-#include <string.h>             // Required for: strlen() [GuiTextBox(), GuiValueBox()], memset(), memcpy()
+#include <string.h>             // Required for: strlen() [GuiTextBox(), GuiValueBox()], memset(), memcpy(), memmove(), memchr(), strcspn()
 #include <stdarg.h>             // Required for: va_list, va_start(), vfprintf(), va_end() [TextFormat()]
-#include <math.h>               // Required for: roundf() [GuiColorPicker()]
+#include <math.h>               // Required for: roundf() [GuiColorPicker()], floor(), ceil() [GuiGetVisibleRange()], powf() [GuiGridEx()]
 #include <ctype.h>              // Required for: isspace() [GuiTextBox()]
 
 // Allow custom memory allocators
@@ -1177,9 +1551,27 @@ typedef enum {
     #define RAYGUI_CLITERAL(name) (name)
 #endif
 
-// Check if two rectangles are equal, used to validate a slider bounds as an id
-#ifndef CHECK_BOUNDS_ID
-    #define CHECK_BOUNDS_ID(src, dst) (((int)src.x == (int)dst.x) && ((int)src.y == (int)dst.y) && ((int)src.width == (int)dst.width) && ((int)src.height == (int)dst.height))
+// Frame stats counters, compiled out if not required
+#if defined(RAYGUI_FRAME_STATS)
+    #define RAYGUI_STATS_ADD(counter, value) guiFrameStats.counter += (value)
+#else
+    #define RAYGUI_STATS_ADD(counter, value)
+#endif
+
+// Profile scopes, compiled out if not required
+#if !defined(RAYGUI_PROFILE_BEGIN)
+    #if defined(RAYGUI_PROFILE)
+        #define RAYGUI_PROFILE_BEGIN(name) if (guiProfileBegin != NULL) guiProfileBegin(name, guiProfileUserData)
+    #else
+        #define RAYGUI_PROFILE_BEGIN(name)
+    #endif
+#endif
+#if !defined(RAYGUI_PROFILE_END)
+    #if defined(RAYGUI_PROFILE)
+        #define RAYGUI_PROFILE_END(name) if (guiProfileEnd != NULL) guiProfileEnd(name, guiProfileUserData)
+    #else
+        #define RAYGUI_PROFILE_END(name)
+    #endif
 #endif
 
 #if !defined(RAYGUI_NO_ICONS) && !defined(RAYGUI_CUSTOM_ICONS)
@@ -1485,50 +1877,567 @@ static unsigned int *guiIconsPtr = guiIcons;
 #define RAYGUI_MAX_PROPS_BASE           16      // Maximum number of base properties
 #define RAYGUI_MAX_PROPS_EXTENDED        8      // Maximum number of extended properties
 
+#if !defined(RAYGUI_MAX_SCROLLBAR_STEPS)
+    #define RAYGUI_MAX_SCROLLBAR_STEPS  1000000     // Maximum scroll bar steps, larger scroll ranges are mapped to steps
+#endif
+
+// Current context pointer storage, thread-local by default
+#if !defined(RAYGUI_THREAD_LOCAL)
+    #if defined(__cplusplus) && (__cplusplus >= 201103L)
+        #define RAYGUI_THREAD_LOCAL     thread_local
+    #elif defined(_MSC_VER)
+        #define RAYGUI_THREAD_LOCAL     __declspec(thread)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+        #define RAYGUI_THREAD_LOCAL     _Thread_local
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define RAYGUI_THREAD_LOCAL     __thread
+    #else
+        #define RAYGUI_THREAD_LOCAL
+    #endif
+#endif
+
+// Default SDF font shader, fragment shader (GLSL 330) using raylib default vertex shader
+// NOTE: Distance is read from texture alpha, shapes drawn in between (white texel) keep full coverage
+#if !defined(RAYGUI_STANDALONE) && !defined(RAYGUI_NO_FONT_SHADER) && !defined(RAYGUI_FONT_SHADER_FS)
+    #define RAYGUI_FONT_SHADER_FS \
+        "#version 330\n" \
+        "in vec2 fragTexCoord;\n" \
+        "in vec4 fragColor;\n" \
+        "uniform sampler2D texture0;\n" \
+        "uniform vec4 colDiffuse;\n" \
+        "out vec4 finalColor;\n" \
+        "void main()\n" \
+        "{\n" \
+        "    float distance = texture(texture0, fragTexCoord).a - 0.5;\n" \
+        "    float distanceChange = length(vec2(dFdx(distance), dFdy(distance)));\n" \
+        "    float alpha = smoothstep(-distanceChange, distanceChange, distance);\n" \
+        "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;\n" \
+        "}\n"
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
 //----------------------------------------------------------------------------------
+#if !defined(RAYGUI_CONTROL_CACHE_SIZE)
+    #define RAYGUI_CONTROL_CACHE_SIZE         512   // Maximum controls with retained data (power of two)
+#endif
+#if !defined(RAYGUI_CONTROL_CACHE_DATA_SIZE)
+    #define RAYGUI_CONTROL_CACHE_DATA_SIZE     32   // Retained data size per control, in bytes
+#endif
+#if !defined(RAYGUI_CONTROL_CACHE_FRAMES)
+    #define RAYGUI_CONTROL_CACHE_FRAMES       120   // Frames a control retained data is kept without being used
+#endif
+#define RAYGUI_CONTROL_CACHE_PROBES             8   // Entries probed on control data lookup
+
+#if !defined(RAYGUI_TEXT_RUN_CACHE_SIZE)
+    #define RAYGUI_TEXT_RUN_CACHE_SIZE        256   // Maximum shaped text lines retained (power of two)
+#endif
+#if !defined(RAYGUI_TEXT_RUN_MAX_GLYPHS)
+    #define RAYGUI_TEXT_RUN_MAX_GLYPHS         48   // Maximum glyphs drawn by a retained text line, longer lines are not retained
+#endif
+#define RAYGUI_TEXT_RUN_CACHE_PROBES            8   // Entries probed on text line lookup
+
+#if !defined(RAYGUI_GLYPH_CACHE_ATLAS_SIZE)
+    #define RAYGUI_GLYPH_CACHE_ATLAS_SIZE    1024   // Lazy font atlas texture size (width and height), split in pages
+#endif
+#if !defined(RAYGUI_GLYPH_CACHE_PAGES)
+    #define RAYGUI_GLYPH_CACHE_PAGES            8   // Lazy font atlas pages (horizontal bands), least recently used page reused when full
+#endif
+#if !defined(RAYGUI_GLYPH_CACHE_MAX_GLYPHS)
+    #define RAYGUI_GLYPH_CACHE_MAX_GLYPHS    2048   // Lazy font maximum glyphs resident (power of two)
+#endif
+#if !defined(RAYGUI_GLYPH_CACHE_FRAME_BUDGET)
+    #define RAYGUI_GLYPH_CACHE_FRAME_BUDGET    16   // Lazy font maximum glyphs rasterized per frame, '?' drawn for pending glyphs
+#endif
+#if !defined(RAYGUI_GLYPH_CACHE_MIN_CODEPOINTS)
+    #define RAYGUI_GLYPH_CACHE_MIN_CODEPOINTS 512   // GuiLoadStyle() charset codepoints to load style font lazily
+#endif
+#define RAYGUI_GLYPH_CACHE_PADDING              2   // Lazy font glyphs padding in atlas
+
+#if !defined(RAYGUI_STYLE_WATCH_FRAMES)
+    #define RAYGUI_STYLE_WATCH_FRAMES          30   // Frames between watched style file modification checks
+#endif
+#if !defined(RAYGUI_STYLE_WATCH_PATH_SIZE)
+    #define RAYGUI_STYLE_WATCH_PATH_SIZE      256   // Watched style file name maximum size
+#endif
+
+#if !defined(RAYGUI_STYLE_FONT_PATH_SIZE)
+    #define RAYGUI_STYLE_FONT_PATH_SIZE       256   // Text style font and charset file names maximum size, font generated again on scale changes
+#endif
+
+#if !defined(RAYGUI_CLIP_STACK_SIZE)
+    #define RAYGUI_CLIP_STACK_SIZE     16       // Maximum clip regions pushed
+#endif
+#if !defined(RAYGUI_ID_STACK_SIZE)
+    #define RAYGUI_ID_STACK_SIZE        32      // Maximum id scopes pushed (including controls scopes)
+#endif
+#if !defined(RAYGUI_LAYOUT_STACK_SIZE)
+    #define RAYGUI_LAYOUT_STACK_SIZE     8      // Maximum nested layout containers
+#endif
+#if !defined(RAYGUI_LAYOUT_CACHE_SIZE)
+    #define RAYGUI_LAYOUT_CACHE_SIZE  1024      // Maximum layout containers cached (power of two)
+#endif
+#if !defined(RAYGUI_LAYOUT_CACHE_ITEMS)
+    #define RAYGUI_LAYOUT_CACHE_ITEMS 4096      // Maximum layout items bounds cached, inactive entries are evicted when full
+#endif
+#if !defined(RAYGUI_TABBAR_CACHE_SIZE)
+    #define RAYGUI_TABBAR_CACHE_SIZE    64      // Maximum tab bars with tabs measures retained, least recently used is replaced
+#endif
+#define RAYGUI_TABBAR_TAB_SPACING        4      // Tab bar spacing between tabs
+#define RAYGUI_TABBAR_TAB_PADDING        8      // Tab bar tab text padding
+#define RAYGUI_TABBAR_CLOSE_SIZE        14      // Tab bar tab close button size
+#define RAYGUI_TABBAR_CLOSE_MARGIN       5      // Tab bar tab close button margin to tab border
+#if !defined(RAYGUI_DROPDOWN_TYPEAHEAD_FRAMES)
+    #define RAYGUI_DROPDOWN_TYPEAHEAD_FRAMES 60 // Frames without typing to reset dropdown box type-ahead prefix
+#endif
+#define RAYGUI_DROPDOWN_TYPEAHEAD_SIZE  32      // Dropdown box type-ahead prefix maximum size
+
+#if defined(RAYGUI_HITTEST)
+// Hit-testing uniform grid, only cells around pointer are kept (grid window), controls out of it are only counted
+// NOTE: If pointer moves out of grid window between frames, controls check pointer directly on that frame
+#if !defined(RAYGUI_HITTEST_MAX_CONTROLS)
+    #define RAYGUI_HITTEST_MAX_CONTROLS      4096       // Maximum controls registered per frame, exceeding controls use direct pointer check
+#endif
+#if !defined(RAYGUI_HITTEST_MAX_ENTRIES)
+    #define RAYGUI_HITTEST_MAX_ENTRIES       4096       // Maximum grid entries (control-cell pairs) per frame
+#endif
+#if !defined(RAYGUI_HITTEST_CELL_SIZE)
+    #define RAYGUI_HITTEST_CELL_SIZE           64       // Grid cell size in pixels
+#endif
+#define RAYGUI_HITTEST_WINDOW_CELLS             3       // Grid window cells per side, centered on pointer cell
+#endif
+
+// Internal text buffers sizes, buffers are kept in gui context
+#if !defined(RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE)
+    #define RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE       256
+#endif
+#if !defined(RAYGUI_DROPDOWN_MAX_ITEM_TEXT_SIZE)
+    #define RAYGUI_DROPDOWN_MAX_ITEM_TEXT_SIZE          256
+#endif
+#if !defined(RAYGUI_TEXTSPLIT_MAX_ITEMS)
+    #define RAYGUI_TEXTSPLIT_MAX_ITEMS          128
+#endif
+#if !defined(RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE)
+    #define RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE     1024     // WARNING: Max expected size for all concat items
+#endif
+#if !defined(RAYGUI_TEXTFORMAT_MAX_SIZE)
+    #define RAYGUI_TEXTFORMAT_MAX_SIZE   256
+#endif
+#define RAYGUI_MAX_TEXT_LINES   128
+
 // Gui control property style color element
 typedef enum { BORDER = 0, BASE, TEXT, OTHER } GuiPropertyElement;
 
+// Gui id scope, controls automatic ids are generated from scope seed and controls counter
+typedef struct GuiIDScope {
+    GuiID seed;                 // Scope seed, hashed id of the scope
+    unsigned int counter;       // Controls taking an automatic id on this scope
+} GuiIDScope;
+
+// Gui control cache entry, small data blob retained for a control along frames
+typedef struct GuiControlCacheEntry {
+    GuiID id;                   // Control id (0 for empty entry)
+    unsigned int frame;         // Last frame used (caches clock), entries not used for RAYGUI_CONTROL_CACHE_FRAMES are evicted
+    unsigned int key;           // Control inputs hash, data is only valid if inputs did not change
+    unsigned char data[RAYGUI_CONTROL_CACHE_DATA_SIZE]; // Control data, accessed with memcpy()
+} GuiControlCacheEntry;
+
+// Gui text run, shaped text line retained along frames (glyphs to draw and their positions)
+// NOTE: Ellipsis dots for overflowing lines are stored as glyphs, starting at cutIndex
+typedef struct GuiTextRun {
+    GuiID hash;                 // Line text, text style and available width hash (0 for empty entry)
+    unsigned int frame;         // Last frame used (caches clock), least recently used entry is replaced first
+    int length;                 // Line length in bytes
+    int lineWidth;              // Line width, as measured by GetLineWidth()
+    int glyphCount;             // Glyphs to draw
+    int cutIndex;               // Overflow cut glyph index (first ellipsis dot), glyphCount if line fits
+    int codepoints[RAYGUI_TEXT_RUN_MAX_GLYPHS]; // Glyphs codepoints
+    float offsets[RAYGUI_TEXT_RUN_MAX_GLYPHS]; // Glyphs horizontal offsets from line position
+} GuiTextRun;
+
+// Gui font glyphs table for ASCII codepoints, rebuilt when font changes
+typedef struct GuiGlyphTable {
+    const GlyphInfo *glyphs;    // Font glyphs the table was built for
+    int glyphCount;             // Font glyphs count the table was built for
+    unsigned int textureId;     // Font texture id the table was built for
+    int indices[128];           // Glyph index for every ASCII codepoint, as returned by GetGlyphIndex()
+} GuiGlyphTable;
+
+// Gui lazy font glyphs cache, glyphs rasterized on first use into atlas pages
+// NOTE: Atlas texture is split in horizontal pages filled with rows of glyphs, pages holding
+// ASCII glyphs are pinned, when atlas is full the least recently used page is cleared and reused
+typedef struct GuiGlyphCache {
+    unsigned char *fileData;    // Font file data, kept loaded for glyphs rasterization
+    int fileDataSize;           // Font file data size
+    int fontSize;               // Font size glyphs are rasterized at
+    Texture2D texture;          // Atlas texture (GRAY_ALPHA)
+    GlyphInfo *glyphs;          // Glyphs info, shared with gui font (no images)
+    Rectangle *recs;            // Glyphs rectangles in atlas, shared with gui font
+    int pages[RAYGUI_GLYPH_CACHE_MAX_GLYPHS]; // Glyph atlas page, -1 for free glyph slot
+    int map[RAYGUI_GLYPH_CACHE_MAX_GLYPHS*2]; // Codepoints to glyph slot + 1 map (open addressing), 0 for empty entry
+    int page;                   // Page being filled
+    int pageRowX[RAYGUI_GLYPH_CACHE_PAGES]; // Page current row position
+    int pageRowY[RAYGUI_GLYPH_CACHE_PAGES]; // Page current row position, relative to page
+    int pageRowHeight[RAYGUI_GLYPH_CACHE_PAGES]; // Page current row height
+    unsigned int pageFrame[RAYGUI_GLYPH_CACHE_PAGES]; // Page last used frame (cache frame)
+    bool pagePinned[RAYGUI_GLYPH_CACHE_PAGES]; // Page holds pinned glyphs, never reused
+    const GuiContext *owner;    // Context loading the cache, its frames advance cache frame
+    unsigned int frame;         // Cache frame, advanced by owner context GuiBeginFrame()
+    unsigned int budgetFrame;   // Cache frame rasterized glyphs budget refers to
+    int budgetUsed;             // Glyphs rasterized on budget frame
+    bool added;                 // Glyphs added since last generation increase
+    unsigned int generation;    // Increased once per frame if glyphs were added, invalidates retained text measures
+} GuiGlyphCache;
+
+// Gui layout cached item inputs, stored next to item bounds to verify cache hits
+typedef struct GuiLayoutCacheInput {
+    int mode;                   // Item size mode
+    float size;                 // Item size value
+    int textLength;             // Item text length (LAYOUT_SIZE_TEXT only, -1 if no text)
+    unsigned int textHash;      // Item text hash (LAYOUT_SIZE_TEXT only)
+} GuiLayoutCacheInput;
+
+// Gui layout cached text measure inputs, only set if some item is measured from text
+typedef struct GuiLayoutCacheText {
+    int textSize;               // Text size style
+    int textSpacing;            // Text spacing style
+    int textLineSpacing;        // Text line spacing style
+    int iconScale;              // Icons scale
+    unsigned int fontId;        // Font texture id
+    int fontBaseSize;           // Font base size
+    unsigned int generation;    // Font glyphs generation (lazy font)
+} GuiLayoutCacheText;
+
+// Gui layout cache entry, items bounds stored relative to container position
+// NOTE: Inputs are stored and compared on hash match, items inputs are stored at entry offset
+typedef struct GuiLayoutCacheEntry {
+    unsigned int hash;          // Layout inputs hash (0 for empty entry)
+    unsigned int stamp;         // Last use stamp, oldest entry is replaced first
+    int offset;                 // Items bounds offset in layout items cache
+    int count;                  // Items bounds count
+    bool active;                // Entry in use by an active container (not replaceable)
+    int type;                   // Layout type
+    int columns;                // Layout grid columns
+    float spacing;              // Layout items spacing
+    float width;                // Layout container width
+    float height;               // Layout container height
+    float scale;                // Gui scale
+    GuiLayoutCacheText text;    // Text measure inputs
+} GuiLayoutCacheEntry;
+
+// Gui layout active container
+typedef struct GuiLayoutContainer {
+    Rectangle bounds;           // Container bounds
+    int entry;                  // Layout cache entry index
+    int next;                   // Next item index
+} GuiLayoutContainer;
+
+// Gui tab bar tabs measures, retained by control
+// NOTE: Tabs offsets are prefix sums over measured tabs widths (including tabs spacing)
+typedef struct GuiTabBarCacheEntry {
+    GuiID id;                   // Tab bar control id (0 for empty entry)
+    unsigned int key;           // Tabs measures inputs key: tabs count, tab bar style, text style and font
+    unsigned int frame;         // Last used frame (caches clock), least recently used entry is replaced first
+    int count;                  // Tabs measured
+    int capacity;               // Tabs allocated
+    float *offsets;             // Tabs offsets (count + 1), relative to first tab
+    unsigned int *hashes;       // Tabs text hash, verified for visible tabs every frame
+    int active;                 // Active tab on last frame, scrolled into view when changed
+    int scroll;                 // Tab bar scroll, used if no hscroll provided by user
+} GuiTabBarCacheEntry;
+
+// Gui dropdown box items index, retained for the open dropdown box
+// NOTE: Items are not copied, indexed by their offsets on dropdown box text
+typedef struct GuiDropdownIndex {
+    GuiID id;                   // Open dropdown box control id (0 if no dropdown box open)
+    unsigned int key;           // Items text hash
+    int count;                  // Items indexed
+    int capacity;               // Items allocated
+    int *offsets;               // Items offsets on text (count + 1), item length is next offset minus one (separator)
+    int *sorted;                // Items sorted by text (case-insensitive, icons ignored), type-ahead index (2*capacity, sorting)
+    int scroll;                 // First visible item
+    int typedItem;              // Type-ahead matched item, -1 if none
+    char typed[RAYGUI_DROPDOWN_TYPEAHEAD_SIZE]; // Type-ahead prefix typed (lowercase)
+    int typedLength;            // Type-ahead prefix length
+    unsigned int typedFrame;    // Type-ahead last typed frame (open frames), prefix reset after RAYGUI_DROPDOWN_TYPEAHEAD_FRAMES
+    unsigned int frames;        // Frames open, counted by dropdown box (not depending on GuiBeginFrame())
+} GuiDropdownIndex;
+
+// Gui context, all gui state
+// NOTE: Members with non-zero default values are placed first, initialized on context creation
+// and positionally on default context (C++)
+struct GuiContext {
+    float alpha;                // Gui controls transparency
+    float scale;                // Gui scale, metric style properties are resolved for it
+    unsigned int iconScale;     // Gui icon default scale (if icons enabled), resolved for gui scale
+    float iconScaleBase;        // Gui icon default scale, unscaled
+    int idCount;                // Gui id scopes pushed (could be bigger than stack size, ignored)
+    GuiIDScope idStack[RAYGUI_ID_STACK_SIZE]; // Gui id scopes stack, first scope is the root one
+#if defined(RAYGUI_HITTEST)
+    int hitTestHovered;         // Hovered control index, resolved from previous frame
+#endif
+#if defined(RAYGUI_INPUT_STATE)
+    int inputClipboardSize;     // Gui input clipboard text size, -1 if no clipboard text read in current frame
+#endif
+
+    GuiState state;             // Gui global state, if !STATE_NORMAL, forces defined state
+
+    Font font;                  // Gui current font (WARNING: highly coupled to raylib)
+    char fontName[32];          // Gui font filename, can be loaded from .rgs (Version: >=600)
+    char styleFontFile[RAYGUI_STYLE_FONT_PATH_SIZE]; // Gui text style font file, font generated again on scale changes (empty if none)
+    char styleFontCharset[RAYGUI_STYLE_FONT_PATH_SIZE]; // Gui text style font charset file (empty if none)
+    int styleFontSize;          // Gui text style font size, unscaled
+    unsigned int styleFontTextureId; // Gui text style font generated texture id, generated again only while it is gui font
+    int fontType;               // Gui font type (GuiFontType)
+    bool locked;                // Gui lock state (no inputs processed)
+    unsigned int iconFontOffsetY; // Gui icon font atlas offset (if icons backed)
+
+    bool tooltip;               // Tooltip enabled/disabled
+    const char *tooltipPtr;     // Tooltip string pointer (string provided by user)
+
+    bool controlExclusiveMode;  // Gui control exclusive mode (no inputs processed except current control)
+    GuiID controlExclusiveId;   // Gui control exclusive id, control processing inputs in exclusive mode
+
+    int textBoxCursorIndex;     // Cursor index, shared by all GuiTextBox*()
+    int autoCursorCounter;      // Frame counter for automatic repeated cursor movement on key-down (cooldown and delay)
+
+    unsigned int frameCounter;  // Gui frames counter, increased on GuiBeginFrame()
+    unsigned int cacheUses;     // Gui retained caches uses counter, caches clock if GuiBeginFrame() is not used
+
+    Rectangle clipStack[RAYGUI_CLIP_STACK_SIZE]; // Gui clip regions stack, intersected with previous ones
+    int clipCount;              // Gui clip regions pushed (could be bigger than stack size, ignored)
+
+    // NOTE: Caches are allocated on first use, contexts only pay for the features used
+    GuiControlCacheEntry *controlCache; // Gui controls retained data (open addressing), RAYGUI_CONTROL_CACHE_SIZE entries
+    GuiTextRun *textRuns;       // Gui shaped text lines retained (open addressing), RAYGUI_TEXT_RUN_CACHE_SIZE entries
+    GuiGlyphTable glyphTable;   // Gui font glyphs table for ASCII codepoints
+    GuiGlyphCache *glyphCache;  // Gui lazy font glyphs cache (NULL if no lazy font loaded)
+
+    GuiLayoutContainer layoutStack[RAYGUI_LAYOUT_STACK_SIZE]; // Gui layout active containers stack
+    int layoutCount;            // Gui layout containers begun (could be bigger than stack size, ignored)
+    GuiLayoutCacheEntry *layoutCache; // Gui layout cache entries (open addressing), RAYGUI_LAYOUT_CACHE_SIZE entries
+    Rectangle *layoutItems;     // Gui layout cached items bounds, RAYGUI_LAYOUT_CACHE_ITEMS items
+    GuiLayoutCacheInput *layoutInputs; // Gui layout cached items inputs, RAYGUI_LAYOUT_CACHE_ITEMS items
+    int layoutItemsUsed;        // Gui layout cached items bounds used
+    unsigned int layoutStamp;   // Gui layout use stamp, increased on every container begin
+    GuiTabBarCacheEntry tabBarCache[RAYGUI_TABBAR_CACHE_SIZE]; // Gui tab bars tabs measures retained
+    GuiDropdownIndex dropdownIndex; // Gui open dropdown box items index
+    bool hoverLast;             // Gui last hover check result, last registered control hovered
+    bool fontShaderActive;      // Gui SDF font shader active, kept between text drawings, ended on next non-text drawing
+
+#if defined(RAYGUI_FRAME_STATS)
+    GuiFrameStats frameStats;   // Gui frame stats, hot-path counters
+#endif
+
+#if defined(RAYGUI_HITTEST)
+    Rectangle hitTestBounds[RAYGUI_HITTEST_MAX_CONTROLS]; // Controls bounds registered on current frame (grid window controls only)
+    int hitTestCount;           // Controls registered on current frame
+    int hitTestCells[RAYGUI_HITTEST_WINDOW_CELLS*RAYGUI_HITTEST_WINDOW_CELLS]; // Grid window cells first entry (+1)
+    Rectangle hitTestWindow;    // Grid window area, around pointer position when frame began
+    int hitTestEntryControl[RAYGUI_HITTEST_MAX_ENTRIES]; // Entry control index
+    int hitTestEntryNext[RAYGUI_HITTEST_MAX_ENTRIES]; // Entry next on bucket list (+1)
+    int hitTestEntryCount;      // Entries registered on current frame
+    Rectangle hitTestHoveredBounds; // Hovered control bounds, resolved from previous frame
+    bool hitTestResolved;       // Hovered control resolved, pointer inside previous frame grid window
+#endif
+
+#if defined(RAYGUI_INPUT_STATE)
+    GuiInputState inputState;   // Gui input state, snapshot for current frame
+    int inputCharIndex;         // Gui input state next codepoint to be read
+
+    FILE *inputRecordFile;      // Gui input record file
+    FILE *inputReplayFile;      // Gui input replay file
+    GuiInputState inputRecordFrame; // Gui input record frame, pending to be written
+    GuiInputState inputRecordPrev; // Gui input record previous frame written, used for delta encoding
+    bool inputRecordPending;    // Gui input record frame pending to be written (waiting for clipboard reads)
+    char inputClipboard[RAYGUI_INPUT_MAX_CLIPBOARD_SIZE]; // Gui input clipboard text, recorded or replayed for current frame
+#endif
+
+#if defined(RAYGUI_COMMAND_LISTS)
+    GuiCommandList *commandList; // Gui command list recording drawing (NULL for backend drawing)
+#endif
+
+#if defined(RAYGUI_PROFILE)
+    GuiProfileCallback profileBegin; // Gui profile scope begin callback
+    GuiProfileCallback profileEnd; // Gui profile scope end callback
+    void *profileUserData;      // Gui profile callbacks user data
+
+    FILE *traceFile;            // Gui trace file, written by bundled trace collector
+    double traceStartTime;      // Gui trace start time (seconds)
+    int traceEventCount;        // Gui trace events written
+#endif
+
+#if defined(RAYGUI_STYLE_HOT_RELOAD)
+    char styleWatchFileName[RAYGUI_STYLE_WATCH_PATH_SIZE]; // Gui watched style file name (empty if not watching)
+    long styleWatchModTime;     // Gui watched style file last modification time
+    long styleWatchPendingTime; // Gui watched style file modification time found on last check, pending reload
+    long styleWatchPendingSize; // Gui watched style file size found on last check, pending reload
+    unsigned int styleWatchFontHash; // Gui watched style font data hash, font only reloaded if changed
+#endif
+
+    // Style data array for all gui style properties
+    // NOTE 1: First set of BASE properties are generic to all controls but could be individually
+    // overwritten per control, first set of EXTENDED properties are generic to all controls and
+    // can not be overwritten individually but custom EXTENDED properties can be used by control
+    // NOTE 2: A new style set could be loaded over this array using GuiLoadStyle(),
+    // but default gui style could always be recovered with GuiLoadStyleDefault()
+    // style size is by default: 16*(16 + 8) = 384*4 = 1536 bytes = 1.5 KB
+    unsigned int style[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)];
+    float styleBase[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)]; // Metric properties unscaled values
+    bool styleLoaded;           // Style loaded flag for lazy style initialization
+
+    // Internal buffers, returned strings are valid until next call on same context
+    char toggleGroupItemText[RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE]; // GuiToggleGroup() item text
+    char dropdownItemText[RAYGUI_DROPDOWN_MAX_ITEM_TEXT_SIZE]; // GuiDropdownBox() item text
+    bool textInputBoxEditMode;  // GuiTextInputBox() text edit mode
+    char iconTextBuffer[1024];  // GuiIconText() text with icon
+    char iconTextIconBuffer[16]; // GuiIconText() icon only text
+    const char *textLines[RAYGUI_MAX_TEXT_LINES]; // GetTextLines() lines pointers
+    char *textSplitItems[RAYGUI_TEXTSPLIT_MAX_ITEMS]; // GuiTextSplit() string pointers array (points to buffer data)
+    char textSplitBuffer[RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE]; // GuiTextSplit() buffer data (text input copy with '\0' added)
+#if defined(RAYGUI_STANDALONE)
+    char textFormatBuffer[RAYGUI_TEXTFORMAT_MAX_SIZE]; // TextFormat() buffer
+    char utf8Buffer[6];         // CodepointToUTF8() buffer
+#endif
+};
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-static GuiState guiState = STATE_NORMAL;        // Gui global state, if !STATE_NORMAL, forces defined state
+// Gui default context, used if no context set, remaining members zero-initialized
+// NOTE: Designated initializers not available on C++ (before C++20)
+#if defined(__cplusplus)
+static GuiContext guiDefaultContext = { 1.0f, 1.0f, 1, 1.0f, 1, { { 14695981039346656037ull, 0 } }
+    #if defined(RAYGUI_HITTEST)
+    , -1
+    #endif
+    #if defined(RAYGUI_INPUT_STATE)
+    , -1
+    #endif
+};
+#else
+static GuiContext guiDefaultContext = {
+    .alpha = 1.0f, .scale = 1.0f, .iconScale = 1, .iconScaleBase = 1.0f, .idCount = 1, .idStack = { { 14695981039346656037ull, 0 } },
+    #if defined(RAYGUI_HITTEST)
+    .hitTestHovered = -1,
+    #endif
+    #if defined(RAYGUI_INPUT_STATE)
+    .inputClipboardSize = -1,
+    #endif
+};
+#endif
+
+static RAYGUI_THREAD_LOCAL GuiContext *guiContext = &guiDefaultContext; // Gui current context, all state accessed through it
+
+// Gui state access, mapped to current context members
+#define guiState                    (guiContext->state)
+#define guiFont                     (guiContext->font)
+#define guiFontName                 (guiContext->fontName)
+#define guiStyleFontFile            (guiContext->styleFontFile)
+#define guiStyleFontCharset         (guiContext->styleFontCharset)
+#define guiStyleFontSize            (guiContext->styleFontSize)
+#define guiStyleFontTextureId       (guiContext->styleFontTextureId)
+#define guiFontType                 (guiContext->fontType)
+#define guiLocked                   (guiContext->locked)
+#define guiAlpha                    (guiContext->alpha)
+#define guiScale                    (guiContext->scale)
+#define guiIconScale                (guiContext->iconScale)
+#define guiIconScaleBase            (guiContext->iconScaleBase)
+#define guiIconFontOffsetY          (guiContext->iconFontOffsetY)
+#define guiTooltip                  (guiContext->tooltip)
+#define guiTooltipPtr               (guiContext->tooltipPtr)
+#define guiControlExclusiveMode     (guiContext->controlExclusiveMode)
+#define guiControlExclusiveId       (guiContext->controlExclusiveId)
+#define textBoxCursorIndex          (guiContext->textBoxCursorIndex)
+#define autoCursorCounter           (guiContext->autoCursorCounter)
+#define guiFrameCounter             (guiContext->frameCounter)
+#define guiCacheUses                (guiContext->cacheUses)
+#define guiClipStack                (guiContext->clipStack)
+#define guiClipCount                (guiContext->clipCount)
+#define guiIdStack                  (guiContext->idStack)
+#define guiIdCount                  (guiContext->idCount)
+#define guiControlCache             (guiContext->controlCache)
+#define guiTextRuns                 (guiContext->textRuns)
+#define guiGlyphTable               (guiContext->glyphTable)
+#define guiGlyphCache               (guiContext->glyphCache)
+#define guiLayoutStack              (guiContext->layoutStack)
+#define guiLayoutCount              (guiContext->layoutCount)
+#define guiLayoutCache              (guiContext->layoutCache)
+#define guiLayoutItems              (guiContext->layoutItems)
+#define guiLayoutInputs             (guiContext->layoutInputs)
+#define guiLayoutItemsUsed          (guiContext->layoutItemsUsed)
+#define guiLayoutStamp              (guiContext->layoutStamp)
+#define guiTabBarCache              (guiContext->tabBarCache)
+#define guiDropdownIndex            (guiContext->dropdownIndex)
+#define guiHoverLast                (guiContext->hoverLast)
+#define guiFontShaderActive         (guiContext->fontShaderActive)
+#define guiStyle                    (guiContext->style)
+#define guiStyleBase                (guiContext->styleBase)
+#define guiStyleLoaded              (guiContext->styleLoaded)
+
+#if defined(RAYGUI_FRAME_STATS)
+#define guiFrameStats               (guiContext->frameStats)
+#endif
 
-static Font guiFont = { 0 };                    // Gui current font (WARNING: highly coupled to raylib)
-static char guiFontName[32] = { 0 };            // Gui font filename, can be loaded from .rgs (Version: >=600)
-static bool guiLocked = false;                  // Gui lock state (no inputs processed)
-static float guiAlpha = 1.0f;                   // Gui controls transparency
+#if defined(RAYGUI_HITTEST)
+#define guiHitTestBounds            (guiContext->hitTestBounds)
+#define guiHitTestCount             (guiContext->hitTestCount)
+#define guiHitTestCells             (guiContext->hitTestCells)
+#define guiHitTestWindow            (guiContext->hitTestWindow)
+#define guiHitTestEntryControl      (guiContext->hitTestEntryControl)
+#define guiHitTestEntryNext         (guiContext->hitTestEntryNext)
+#define guiHitTestEntryCount        (guiContext->hitTestEntryCount)
+#define guiHitTestHovered           (guiContext->hitTestHovered)
+#define guiHitTestHoveredBounds     (guiContext->hitTestHoveredBounds)
+#define guiHitTestResolved          (guiContext->hitTestResolved)
+#endif
 
-static unsigned int guiIconScale = 1;           // Gui icon default scale (if icons enabled)
-static unsigned int guiIconFontOffsetY = 0;     // Gui icon font atlas offset (if icons backed)
+#if defined(RAYGUI_INPUT_STATE)
+#define guiInputState               (guiContext->inputState)
+#define guiInputCharIndex           (guiContext->inputCharIndex)
+#define guiInputRecordFile          (guiContext->inputRecordFile)
+#define guiInputReplayFile          (guiContext->inputReplayFile)
+#define guiInputRecordFrame         (guiContext->inputRecordFrame)
+#define guiInputRecordPrev          (guiContext->inputRecordPrev)
+#define guiInputRecordPending       (guiContext->inputRecordPending)
+#define guiInputClipboard           (guiContext->inputClipboard)
+#define guiInputClipboardSize       (guiContext->inputClipboardSize)
+#endif
 
-static bool guiTooltip = false;                 // Tooltip enabled/disabled
-static const char *guiTooltipPtr = NULL;        // Tooltip string pointer (string provided by user)
+#if defined(RAYGUI_COMMAND_LISTS)
+#define guiCommandList              (guiContext->commandList)
+#endif
 
-static bool guiControlExclusiveMode = false;    // Gui control exclusive mode (no inputs processed except current control)
-static Rectangle guiControlExclusiveRec = { 0 }; // Gui control exclusive bounds rectangle, used as an unique identifier
+#if defined(RAYGUI_PROFILE)
+#define guiProfileBegin             (guiContext->profileBegin)
+#define guiProfileEnd               (guiContext->profileEnd)
+#define guiProfileUserData          (guiContext->profileUserData)
+#define guiTraceFile                (guiContext->traceFile)
+#define guiTraceStartTime           (guiContext->traceStartTime)
+#define guiTraceEventCount          (guiContext->traceEventCount)
+#endif
 
-static int textBoxCursorIndex = 0;              // Cursor index, shared by all GuiTextBox*()
-//static int blinkCursorFrameCounter = 0;       // Frame counter for cursor blinking
-static int autoCursorCounter = 0;               // Frame counter for automatic repeated cursor movement on key-down (cooldown and delay)
+#if defined(RAYGUI_STYLE_HOT_RELOAD)
+#define guiStyleWatchFileName       (guiContext->styleWatchFileName)
+#define guiStyleWatchModTime        (guiContext->styleWatchModTime)
+#define guiStyleWatchPendingTime    (guiContext->styleWatchPendingTime)
+#define guiStyleWatchPendingSize    (guiContext->styleWatchPendingSize)
+#define guiStyleWatchFontHash       (guiContext->styleWatchFontHash)
+#endif
 
-//----------------------------------------------------------------------------------
-// Style data array for all gui style properties (allocated on data segment by default)
-//
-// NOTE 1: First set of BASE properties are generic to all controls but could be individually
-// overwritten per control, first set of EXTENDED properties are generic to all controls and
-// can not be overwritten individually but custom EXTENDED properties can be used by control
-//
-// NOTE 2: A new style set could be loaded over this array using GuiLoadStyle(),
-// but default gui style could always be recovered with GuiLoadStyleDefault()
-//
-// guiStyle size is by default: 16*(16 + 8) = 384*4 = 1536 bytes = 1.5 KB
-//----------------------------------------------------------------------------------
-static unsigned int guiStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
+// Gui pattern texture, shared by all contexts (like icons), loaded on first use
+// NOTE: 2x2 pixels checkerboard (white and transparent), drawn tiled (texture wrap repeat required)
+static Texture2D guiPatternTexture = { 0 };
+#if !defined(RAYGUI_NO_PATTERN_TEXTURE)
+static bool guiPatternFailed = false;           // Pattern texture loading failed, patterns drawn with rectangles
+#endif
 
-static bool guiStyleLoaded = false;         // Style loaded flag for lazy style initialization
+// Gui font shader callbacks, shared by all contexts, called around text drawing with SDF fonts
+static void (*guiFontShaderBegin)(void) = NULL;
+static void (*guiFontShaderEnd)(void) = NULL;
+#if !defined(RAYGUI_STANDALONE) && !defined(RAYGUI_NO_FONT_SHADER)
+static Shader guiFontShader = { 0 };            // Default SDF font shader, loaded on first use
+#endif
 
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
@@ -1538,17 +2447,39 @@ static bool guiStyleLoaded = false;         // Style loaded flag for lazy style
 //----------------------------------------------------------------------------------
 #if defined(RAYGUI_STANDALONE)
 
+// NOTE: Keys and buttons values are aligned with raylib (GLFW) values
+#define KEY_MINUS            45
+#define KEY_V                86
+#define KEY_ENTER           257
+#define KEY_BACKSPACE       259
+#define KEY_DELETE          261
 #define KEY_RIGHT           262
 #define KEY_LEFT            263
 #define KEY_DOWN            264
 #define KEY_UP              265
-#define KEY_BACKSPACE       259
-#define KEY_ENTER           257
+#define KEY_HOME            268
+#define KEY_END             269
+#define KEY_KP_ENTER        335
+#define KEY_LEFT_SHIFT      340
+#define KEY_LEFT_CONTROL    341
+#define KEY_RIGHT_CONTROL   345
 
 #define MOUSE_LEFT_BUTTON     0
+#define MOUSE_RIGHT_BUTTON    1
+#define MOUSE_MIDDLE_BUTTON   2
+
+// Memory allocators used on font atlas data manipulation
+#if !defined(RL_CALLOC)
+    #define RL_CALLOC(n,sz)     RAYGUI_CALLOC(n,sz)
+#endif
+#if !defined(RL_FREE)
+    #define RL_FREE(p)          RAYGUI_FREE(p)
+#endif
 
 // Input required functions
+// NOTE: Not required if RAYGUI_INPUT_STATE is defined, input state provided by user
 //-------------------------------------------------------------------------------
+#if !defined(RAYGUI_INPUT_STATE)
 static Vector2 GetMousePosition(void);
 static float GetMouseWheelMove(void);
 static bool IsMouseButtonDown(int button);
@@ -1558,12 +2489,23 @@ static bool IsMouseButtonReleased(int button);
 static bool IsKeyDown(int key);
 static bool IsKeyPressed(int key);
 static int GetCharPressed(void); // -- GuiTextBox(), GuiValueBox()
+#endif
+static const char *GetClipboardText(void);  // -- GuiTextBox(), paste text
+//-------------------------------------------------------------------------------
+
+// Window required functions
+//-------------------------------------------------------------------------------
+static int GetScreenWidth(void);    // -- GuiTooltip()
+static int GetScreenHeight(void);   // -- GuiTooltip()
 //-------------------------------------------------------------------------------
 
 // Drawing required functions
 //-------------------------------------------------------------------------------
 static void DrawRectangle(int x, int y, int width, int height, Color color); // -- GuiDrawRectangle()
 static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4); // -- GuiColorPicker()
+static void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // -- GuiDrawIcon(), icons baked into font, GuiColorBarAlpha() (tiled, wrap repeat)
+static void BeginScissorMode(int x, int y, int width, int height); // -- GuiPushClip()
+static void EndScissorMode(void);   // -- GuiPopClip()
 //-------------------------------------------------------------------------------
 
 // Text required functions
@@ -1571,7 +2513,10 @@ static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color
 static Font GetFontDefault(void);                            // -- GuiLoadStyleDefault()
 static Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // -- GuiLoadStyle(), load font
 
-static Texture2D LoadTextureFromImage(Image image);          // -- GuiLoadStyle(), required to load texture from embedded font atlas image
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // -- GuiDrawText()
+
+static Texture2D LoadTextureFromImage(Image image);          // -- GuiLoadStyle(), GuiColorBarAlpha(), required to load font atlas and pattern textures
+static void UnloadTexture(Texture2D texture);                // -- GuiLoadStyle(), required to unload previous font atlas texture
 static void SetShapesTexture(Texture2D tex, Rectangle rec);  // -- GuiLoadStyle(), required to set shapes rec to font white rec (optimization)
 
 static char *LoadFileText(const char *fileName);             // -- GuiLoadStyle(), required to load charset data
@@ -1584,9 +2529,20 @@ static void UnloadCodepoints(int *codepoints);               // -- GuiLoadStyle(
 
 static unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize); // -- GuiLoadStyle()
 
+#if defined(RAYGUI_STYLE_HOT_RELOAD)
+static long GetFileModTime(const char *fileName);            // -- GuiUpdateStyleWatch(), watched style file modification time
+#endif
+
 static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing); // Measure string size for Font
 //-------------------------------------------------------------------------------
 
+// Timing required functions
+//-------------------------------------------------------------------------------
+#if defined(RAYGUI_PROFILE)
+static double GetTime(void);                                 // -- GuiTraceBegin(), elapsed time in seconds
+#endif
+//-------------------------------------------------------------------------------
+
 // raylib functions already implemented in raygui
 //-------------------------------------------------------------------------------
 static Color GetColor(int hexValue);                // Returns a Color struct from hexadecimal value
@@ -1598,6 +2554,8 @@ static int TextToInteger(const char *text);         // Get integer value from te
 static float TextToFloat(const char *text);         // Get float value from text
 
 static int GetCodepointNext(const char *text, int *codepointSize);  // Get next codepoint in a UTF-8 encoded text
+static int GetCodepointPrevious(const char *text, int *codepointSize); // Get previous codepoint in a UTF-8 encoded text
+static int GetGlyphIndex(Font font, int codepoint);                 // Get glyph index position in font for a codepoint (unicode character)
 static const char *CodepointToUTF8(int codepoint, int *byteSize);   // Encode codepoint into UTF-8 text (char array size returned as parameter)
 //-------------------------------------------------------------------------------
 
@@ -1607,11 +2565,43 @@ static const char *CodepointToUTF8(int codepoint, int *byteSize);   // Encode co
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 static int GetLineWidth(const char *text);                      // Get text line width (stops at '\n' or '\0')
+static int GetAsciiLength(const char *text, int length);        // Get leading ASCII bytes count, checked 8 bytes at a time
+static const int *GetAsciiGlyphs(void);                         // Get current font glyphs indices for ASCII codepoints
+static bool GuiIsFontLazy(void);                                // Check if current font is a lazy font (glyphs rasterized on first use)
+static int GuiGetGlyphIndex(int codepoint);                     // Get current font glyph index for a codepoint, lazy fonts glyphs rasterized if required
+static Font GuiGetGlyphFont(int codepoint);                     // Get current font to draw a codepoint, single glyph view for lazy fonts
+static unsigned int GuiGetGlyphGeneration(void);                // Get current font glyphs generation, changes when lazy font glyphs are added
+#if !defined(RAYGUI_STANDALONE)
+static int GuiGetCachedGlyph(GuiGlyphCache *cache, int codepoint); // Get lazy font glyph slot for a codepoint, rasterized if required (frame budget)
+static bool GuiAddGlyphs(GuiGlyphCache *cache, const int *codepoints, int count, bool pinned); // Rasterize glyphs into lazy font atlas pages
+static int GuiAllocGlyphRect(GuiGlyphCache *cache, int width, int height, int *x, int *y); // Allocate lazy font atlas rectangle, returns page (-1 if no space)
+static bool GuiEvictGlyphPage(GuiGlyphCache *cache);           // Clear least recently used lazy font atlas page for reuse
+static void GuiMapGlyphs(GuiGlyphCache *cache);                 // Rebuild lazy font codepoints map from resident glyphs
+static void GuiUnloadGlyphCache(GuiGlyphCache *cache);          // Unload lazy font glyphs cache (atlas, glyphs and font data)
+#endif
 static Rectangle GetTextBounds(int control, Rectangle bounds);  // Get text bounds considering control bounds
 static const char *GetTextIcon(const char *text, int *iconId);  // Get text icon if provided and move text cursor
 
 static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint); // Gui draw text using default font
 static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color); // Gui draw rectangle using default raygui style
+static void GuiDrawCheckerboard(Rectangle bounds, int cellSize, Color color1, Color color2); // Gui draw checkerboard pattern using cached pattern texture
+
+static void GuiCmdDrawRectangle(int x, int y, int width, int height, Color color); // Draw rectangle, recorded if command list active
+static void GuiCmdDrawRectangles(const Rectangle *recs, const Color *colors, int count); // Draw rectangles stream, recorded if command list active
+static void GuiCmdDrawRectangleGradient(Rectangle rec, Color col1, Color col2, Color col3, Color col4); // Draw gradient rectangle, recorded if command list active
+static void GuiCmdDrawTexture(Texture2D texture, Rectangle source, Rectangle dest, Color tint); // Draw texture rectangle, recorded if command list active
+static void GuiCmdDrawCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw codepoint, recorded if command list active
+static void GuiCmdBeginScissor(int x, int y, int width, int height); // Begin scissor area, recorded if command list active
+static void GuiCmdEndScissor(void);                             // End scissor area, recorded if command list active
+static void GuiSetFontShaderActive(bool active);                // Set SDF font shader state for next drawing, begun or ended only on changes
+static void GuiCmdBeginFontShader(void);                        // Begin SDF font shader, recorded if command list active
+static void GuiCmdEndFontShader(void);                          // End SDF font shader, recorded if command list active
+static void GuiBeginFontShader(void);                           // Begin SDF font shader, using callbacks or default shader
+static void GuiEndFontShader(void);                             // End SDF font shader, using callbacks or default shader
+#if defined(RAYGUI_COMMAND_LISTS)
+static GuiCommand *GuiAddCommand(int type);                     // Add command to recording command list, growing it if required
+static GuiCommand *GuiAddCommands(int type, int count);         // Add consecutive commands to recording command list, growing it once if required
+#endif
 
 static char **GuiTextSplit(const char *text, char delimiter, int *count); // Split controls text into multiple strings
 static Vector3 ConvertHSVtoRGB(Vector3 hsv);                    // Convert color data from HSV to RGB
@@ -1619,9 +2609,73 @@ static Vector3 ConvertRGBtoHSV(Vector3 rgb);                    // Convert color
 
 static void GuiTooltip(Rectangle controlRec);                   // Draw tooltip using control rec position
 static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue); // Scroll bar control, used by GuiScrollPanel()
+static double GuiScrollBarRange(Rectangle bounds, double value, double minValue, double maxValue); // Scroll bar control for double precision ranges, used by GuiScrollPanelEx()
+#if defined(RAYGUI_FONT_ICONS_BAKING)
 static int GuiFontIconBaking(Image *imFont, Font font, Rectangle *whiteRec); // Update font image atlas to append raygui icons
+#endif
+static void GuiLoadStyleFont(Font font, int fontType, Image *imFont, Rectangle fontWhiteRec); // Load style font atlas texture and set it as gui font
+static bool GuiLoadStyleFontFile(float scale);                  // Load text style font from its font and charset files, generated at scale, set as gui font
+static bool GuiGetStyleSections(const unsigned char *fileData, int dataSize, const unsigned char **sections, int *sizes, int *params); // Get indexed style data sections, validating checksum
+static void GuiLoadStyleIndexed(const unsigned char *fileData, int dataSize); // Load indexed style data (.rgs version >= 700), sections located from table of contents
+#if defined(RAYGUI_STYLE_HOT_RELOAD)
+static bool GuiReadStyleData(const unsigned char *fileData, int dataSize, unsigned int *style, bool *updated, unsigned int *fontHash); // Read style data properties into a style table, no changes applied
+static int GuiGetStyleFontDataSize(const unsigned char *fontData, int dataSize, int version); // Get binary style font data size, -1 if font data is truncated
+static void GuiSetStyleTable(unsigned int *style, bool *updated, int control, int property, unsigned int value); // Set style table property, DEFAULT base properties propagated
+static int GuiReloadStyle(const char *fileName);            // Reload style file, only changed properties applied
+static long GuiGetStyleFileSize(const char *fileName);      // Get style file size, -1 if file could not be opened
+#endif
 
 static Color GuiFade(Color color, float alpha); // Fade color by an alpha factor
+static bool GuiCheckHover(Vector2 point, Rectangle bounds);     // Check pointer over control bounds, registering control for hit-testing
+static bool GuiIsCulled(Rectangle bounds);                      // Check if bounds are completely outside current clip region
+static bool GuiIsCulledText(Rectangle bounds, bool textLeft, bool textRight); // Check if bounds and side text are completely outside current clip region
+
+static GuiID GuiHashID(GuiID seed, const void *data, int size); // Get data hash for an id scope seed (FNV-1a 64-bit)
+static unsigned int GuiHashData(unsigned int seed, const void *data, int size); // Get data hash, seed to continue a previous hash (FNV-1a 32-bit)
+static GuiID GuiGetControlID(Rectangle bounds);                 // Get next control automatic id on current id scope
+static void GuiPushControlID(GuiID id);                         // Push control id scope, used by controls containing other controls
+static unsigned int GuiGetCacheClock(void);                     // Get retained caches clock, frames counter or caches uses counter if GuiBeginFrame() is not used
+static void *GuiGetControlCache(GuiID id, unsigned int key, bool *valid); // Get control retained data, valid if stored with same inputs key
+static unsigned int GuiHashText(const char *text);              // Get text hash, including text style and font (FNV-1a)
+static int GuiGetTextWidthCached(GuiID id, int slot, const char *text); // Get text width, retained by control (slot for multiple texts)
+static GuiTextRun *GuiGetTextRun(const char *line, bool icon, float width, bool *valid); // Get shaped text line, valid if retained with same text, style and width
+static void GuiAddTextRunGlyph(GuiTextRun *run, int codepoint, float offset); // Add glyph to shaped text line being retained
+static Vector3 GuiGetColorHSVCached(GuiID id, Color color);     // Get color hsv, retained by control while color is not changed
+static void GuiSetColorHSVCached(GuiID id, Color color, Vector3 hsv); // Set color hsv, retained by control
+static GuiTabBarCacheEntry *GuiGetTabBarCache(GuiID id, char **text, int count); // Get tab bar tabs measures, retained by control while tabs count and style do not change
+static void GuiUpdateTabBarCache(GuiTabBarCacheEntry *entry, char **text, int first, int last); // Update tab bar tabs measures for changed tabs text in range
+static int GuiGetTabBarIndex(const GuiTabBarCacheEntry *entry, float offset); // Get tab index at offset, binary search over tabs offsets
+static float GuiGetTabWidth(const char *text);                  // Get tab width for text, including padding and close button
+static const char *GuiGetTextItem(const char *text, int index, int *count); // Get text items count and item text at index (items separated by ';' or '\n')
+static const char *GuiCopyTextItem(const char *item);           // Copy item text (up to separator) into dropdown item text buffer
+static bool GuiUpdateDropdownIndex(GuiID id, const char *text); // Update open dropdown box items index, true if index built for a newly open dropdown
+static int GuiCompareTextItem(const char *item, const char *other, int length); // Compare item texts (case-insensitive), up to separator or length characters if length >= 0
+static int GuiFindDropdownItem(const char *text, const char *prefix, int length); // Find first item (sorted) starting with prefix, -1 if not found
+
+static void GuiLayoutContainerBegin(Rectangle bounds, int type, int columns, const GuiLayoutItem *items, int count, float spacing); // Begin layout container, used by GuiLayoutBegin()/GuiLayoutGridBegin()
+static unsigned int GuiLayoutHash(int type, int columns, const GuiLayoutItem *items, int count, float spacing, float width, float height, GuiLayoutCacheText *text); // Get layout inputs hash (FNV-1a), text measure inputs filled if required
+static bool GuiLayoutCacheMatch(const GuiLayoutCacheEntry *entry, int type, int columns, const GuiLayoutItem *items, int count, float spacing, float width, float height, const GuiLayoutCacheText *text); // Check layout cache entry stored inputs are equal to provided ones
+static void GuiLayoutCacheStore(GuiLayoutCacheEntry *entry, int type, int columns, const GuiLayoutItem *items, int count, float spacing, float width, float height, const GuiLayoutCacheText *text); // Store layout inputs on cache entry
+static void GuiLayoutCompute(Rectangle bounds, int type, int columns, const GuiLayoutItem *items, int count, float spacing, Rectangle *rects); // Compute layout items bounds, relative to container
+static float GuiLayoutItemSize(GuiLayoutItem item, float available, bool horizontal); // Get layout item size in pixels, negative weight for fill items
+static bool GuiIsStyleMetric(int control, int property);    // Check if style property is a metric, resolved for gui scale
+static void GuiSetStyleTemp(int control, int property, int value); // Set control style property value temporarily, unscaled value is kept
+static void GuiSetStyleResolved(int control, int property, int value, float base); // Set control style property resolved and unscaled values
+static void GuiResolveStyle(void);                          // Resolve metric style properties and icon scale for gui scale
+
+#if defined(RAYGUI_INPUT_STATE)
+static unsigned int GuiGetInputKeyFlag(int key);                // Get input state key flag for a backend key code
+static const char *GuiGetInputClipboardText(void);              // Get clipboard text, recorded or replayed along input state
+static void GuiWriteInputFrame(void);                           // Write pending input record frame (delta encoded)
+static bool GuiReadInputFrame(GuiInputState *state);            // Read next input replay frame (delta encoded)
+static void GuiWriteInputValue(unsigned int value, int size);   // Write input record value (little-endian, size bytes)
+static bool GuiReadInputValue(unsigned int *value, int size);   // Read input replay value (little-endian, size bytes), false on short read
+#endif
+
+#if defined(RAYGUI_PROFILE)
+static void GuiTraceScopeBegin(const char *name, void *userData); // Write trace begin event, used by GuiTraceBegin()
+static void GuiTraceScopeEnd(const char *name, void *userData); // Write trace end event, used by GuiTraceBegin()
+#endif
 
 //----------------------------------------------------------------------------------
 // Gui Setup Functions Definition
@@ -1652,12 +2706,137 @@ void GuiSetAlpha(float alpha)
     guiAlpha = alpha;
 }
 
+// Set gui scale (global state)
+// NOTE: Metric style properties and icon scale are resolved once for the new scale, text is drawn at
+// resolved text size: text style fonts (.rgs font files) are generated again at new scale, SDF fonts keep
+// sharp at any scale while other fonts (binary .rgs embedded atlas, user fonts) are scaled from their atlas
+// WARNING: Controls bounds and pointer position are not scaled, bounds are provided in screen pixels
+void GuiSetScale(float scale)
+{
+    if (scale <= 0.0f)
+    {
+        RAYGUI_LOG("WARNING: Gui scale must be greater than 0\n");
+        return;
+    }
+
+    float previousScale = guiScale;
+    guiScale = scale;
+
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+    else GuiResolveStyle();
+
+#if !defined(RAYGUI_STANDALONE)
+    // Text style font is generated again at new scale, only while it is gui font (not replaced by user)
+    // NOTE: Previous font is unloaded (lazy fonts are unloaded when replaced), contexts copying style must copy it again
+    if ((scale != previousScale) && (guiStyleFontFile[0] != '\0') && (guiStyleFontTextureId > 0) && (guiFont.texture.id == guiStyleFontTextureId))
+    {
+        Font previousFont = guiFont;
+        bool previousLazy = GuiIsFontLazy();
+
+        if (GuiLoadStyleFontFile(scale) && !previousLazy) UnloadFont(previousFont);
+    }
+#else
+    (void)previousScale;
+#endif
+}
+
+// Get gui scale (global state)
+float GuiGetScale(void) { return guiScale; }
+
 // Set gui state (global state)
 void GuiSetState(int state) { guiState = (GuiState)state; }
 
 // Get gui state (global state)
 int GuiGetState(void) { return guiState; }
 
+// Create gui context
+// NOTE: Context is not set as current, style and font are copied from current context (default style is
+// loaded on it first if required), so contexts used on worker threads do not load default style lazily,
+// it requires backend resources (shapes texture and default font) only available on rendering thread
+GuiContext *GuiCreateContext(void)
+{
+    GuiContext *context = (GuiContext *)RAYGUI_CALLOC(1, sizeof(GuiContext));
+
+    if (context != NULL)
+    {
+        context->alpha = 1.0f;
+        context->scale = 1.0f;
+        context->iconScale = 1;
+        context->iconScaleBase = 1.0f;
+        context->idCount = 1;
+        context->idStack[0].seed = guiDefaultContext.idStack[0].seed;
+#if defined(RAYGUI_HITTEST)
+        context->hitTestHovered = -1;
+#endif
+#if defined(RAYGUI_INPUT_STATE)
+        context->inputClipboardSize = -1;
+#endif
+
+        if (!guiStyleLoaded) GuiLoadStyleDefault();
+        GuiCopyContextStyle(context, guiContext);
+    }
+    else RAYGUI_LOG("WARNING: Failed to allocate gui context\n");
+
+    return context;
+}
+
+// Destroy gui context
+// NOTE: Resources loaded on context (style font) are not unloaded, default context can not be destroyed
+void GuiDestroyContext(GuiContext *context)
+{
+    if ((context == NULL) || (context == &guiDefaultContext)) return;
+
+    if (guiContext == context) guiContext = &guiDefaultContext;
+
+    for (int i = 0; i < RAYGUI_TABBAR_CACHE_SIZE; i++)
+    {
+        RAYGUI_FREE(context->tabBarCache[i].offsets);
+        RAYGUI_FREE(context->tabBarCache[i].hashes);
+    }
+
+    RAYGUI_FREE(context->dropdownIndex.offsets);
+    RAYGUI_FREE(context->dropdownIndex.sorted);
+
+    RAYGUI_FREE(context->controlCache);
+    RAYGUI_FREE(context->textRuns);
+    RAYGUI_FREE(context->layoutCache);
+    RAYGUI_FREE(context->layoutItems);
+    RAYGUI_FREE(context->layoutInputs);
+
+    // Shared lazy font cache is kept, its frame is no longer advanced
+    if ((context->glyphCache != NULL) && (context->glyphCache->owner == context)) context->glyphCache->owner = NULL;
+
+    RAYGUI_FREE(context);
+}
+
+// Set current gui context for calling thread
+void GuiSetCurrentContext(GuiContext *context) { guiContext = (context != NULL)? context : &guiDefaultContext; }
+
+// Get current gui context for calling thread
+GuiContext *GuiGetCurrentContext(void) { return guiContext; }
+
+// Copy style and font from source context
+// NOTE: Font is shared (not copied), it must be kept loaded while used by any context,
+// lazy font cache is shared too, only updated by loading context frames and command lists drawing
+void GuiCopyContextStyle(GuiContext *context, GuiContext *source)
+{
+    if (context == NULL) context = &guiDefaultContext;
+    if (source == NULL) source = &guiDefaultContext;
+    if (context == source) return;
+
+    memcpy(context->style, source->style, sizeof(context->style));
+    memcpy(context->styleBase, source->styleBase, sizeof(context->styleBase));
+    memcpy(context->fontName, source->fontName, sizeof(context->fontName));
+    context->font = source->font;
+    context->fontType = source->fontType;
+    context->glyphCache = source->glyphCache;
+    context->styleLoaded = source->styleLoaded;
+    context->scale = source->scale;
+    context->iconScale = source->iconScale;
+    context->iconScaleBase = source->iconScaleBase;
+    context->iconFontOffsetY = source->iconFontOffsetY;
+}
+
 // Set custom gui font
 // NOTE: Font loading/unloading is external to raygui
 void GuiSetFont(Font font)
@@ -1669,6 +2848,7 @@ void GuiSetFont(Font font)
         if (!guiStyleLoaded) GuiLoadStyleDefault();
 
         guiFont = font;
+        guiFontType = FONT_TYPE_NORMAL;
     }
 }
 
@@ -1678,1407 +2858,1487 @@ Font GuiGetFont(void)
     return guiFont;
 }
 
-// Set control style property value
-void GuiSetStyle(int control, int property, int value)
+// Set custom gui font type
+// NOTE: Text drawn with SDF fonts is enclosed by font shader begin/end calls
+void GuiSetFontType(int type)
 {
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
-    guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
-
-    // Default properties are propagated to all controls
-    if ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))
-    {
-        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) guiStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
-    }
+    guiFontType = (type == FONT_TYPE_SDF)? FONT_TYPE_SDF : FONT_TYPE_NORMAL;
 }
 
-// Get control style property value
-int GuiGetStyle(int control, int property)
+// Get custom gui font type
+int GuiGetFontType(void)
 {
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
-    return guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
+    return guiFontType;
 }
 
-//----------------------------------------------------------------------------------
-// Gui Controls Functions Definition
-//----------------------------------------------------------------------------------
+// Set SDF font shader callbacks (shared by all contexts)
+// NOTE: Callbacks must set/unset a shader sampling the distance field from font atlas alpha,
+// if not set, raygui default shader is used (not available in RAYGUI_STANDALONE mode)
+void GuiSetFontShaderCallbacks(void (*begin)(void), void (*end)(void))
+{
+    guiFontShaderBegin = begin;
+    guiFontShaderEnd = end;
+}
 
-// Window Box control
-int GuiWindowBox(Rectangle bounds, const char *title)
+// Evaluate SDF font atlas image into glyphs coverage for a text scale (text size/font base size)
+// NOTE: Image is converted in place, resulting atlas is a normal font atlas valid for provided scale,
+// useful for backends with no shaders support; distance values are read from alpha channel
+// (gray channel for grayscale images), supported formats: grayscale, gray-alpha and R8G8B8A8
+void GuiEvalFontSDF(Image *image, float scale)
 {
-    // Window title bar height (including borders)
-    // NOTE: This define is also used by GuiMessageBox() and GuiTextInputBox()
-    #if !defined(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
-        #define RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT        24
+    // SDF generation parameters, raylib defaults
+    #if !defined(RAYGUI_FONT_SDF_ON_EDGE_VALUE)
+        #define RAYGUI_FONT_SDF_ON_EDGE_VALUE       128
     #endif
-
-    #if !defined(RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT)
-        #define RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT      18
+    #if !defined(RAYGUI_FONT_SDF_PIXEL_DIST_SCALE)
+        #define RAYGUI_FONT_SDF_PIXEL_DIST_SCALE   64.0f
     #endif
 
-    int result = RESULT_NONE;
-    //GuiState state = guiState;
-
-    int statusBarHeight = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT;
-	int statusBorderWidth = GuiGetStyle(STATUSBAR, BORDER_WIDTH);
-
-    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)statusBarHeight };
-    if (bounds.height < statusBarHeight*2.0f) bounds.height = statusBarHeight*2.0f;
-
-    const float vPadding = statusBarHeight/2.0f - RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT/2.0f;
-    Rectangle windowPanel = { bounds.x, bounds.y + (float)statusBarHeight - (float)statusBorderWidth, bounds.width, bounds.height - (float)statusBarHeight + (float)statusBorderWidth };
-    Rectangle closeButtonRec = { statusBar.x + statusBar.width - (float)statusBorderWidth - RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT - vPadding,
-                                 statusBar.y + vPadding, RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT, RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT };
+    if ((image == NULL) || (image->data == NULL) || (scale <= 0.0f)) return;
 
-    // Update control
-    //--------------------------------------------------------------------
-    // NOTE: Logic is directly managed by button
-    //--------------------------------------------------------------------
+    int channels = 0;
+    if (image->format == 1) channels = 1;           // PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+    else if (image->format == 2) channels = 2;      // PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+    else if (image->format == 7) channels = 4;      // PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiPanel(windowPanel, NULL);    // Draw window base
+    if (channels == 0)
+    {
+        RAYGUI_LOG("WARNING: SDF font atlas image format not supported for evaluation\n");
+        return;
+    }
 
-    int tempTextAlignment = GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT);
-    GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiStatusBar(statusBar, title); // Draw window header as status bar
-    GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, tempTextAlignment);
+    // Distance values change per screen pixel, edge is antialiased over one screen pixel
+    float distancePerPixel = RAYGUI_FONT_SDF_PIXEL_DIST_SCALE/scale;
+    unsigned char *pixels = (unsigned char *)image->data;
+    int pixelCount = image->width*image->height;
 
-    // Draw window close button
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-#if defined(RAYGUI_NO_ICONS)
-    result = GuiButton(closeButtonRec, "x");
-#else
-    result = GuiButton(closeButtonRec, GuiIconText(ICON_CROSS_SMALL, NULL));
-#endif
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
-    //--------------------------------------------------------------------
+    for (int i = 0; i < pixelCount; i++)
+    {
+        unsigned char *distance = &pixels[i*channels + channels - 1];
+        float coverage = ((float)*distance - RAYGUI_FONT_SDF_ON_EDGE_VALUE)/distancePerPixel + 0.5f;
+        coverage = (coverage < 0.0f)? 0.0f : ((coverage > 1.0f)? 1.0f : coverage);
 
-    return result;
+        *distance = (unsigned char)(coverage*255.0f + 0.5f);
+    }
 }
 
-// Group Box control with text name
-int GuiGroupBox(Rectangle bounds, const char *text)
+// Load font with glyphs rasterized on first use into atlas pages, set as gui font
+// NOTE: Only ASCII glyphs are rasterized on loading, any other codepoint available in font file
+// is rasterized when first measured or drawn (up to RAYGUI_GLYPH_CACHE_FRAME_BUDGET glyphs per frame),
+// GuiBeginFrame() must be called every frame on loading context for glyphs budget and atlas pages reuse
+// NOTE: While recording a command list, cache is only read, missing glyphs are recorded as '?' and rasterized
+// by GuiDrawCommandLists() on rendering thread, GuiLoadStyle() also loads style fonts lazily for charsets
+// of RAYGUI_GLYPH_CACHE_MIN_CODEPOINTS or more
+// WARNING: Font file data is kept loaded, lazy font is shared by contexts copying style: they can record
+// command lists on any thread, but not while lists are drawn, drawing without lists is rendering thread only
+// and it should not add glyphs between lists recording and drawing (recorded atlas pages could be reused)
+bool GuiLoadFontLazy(const char *fileName, int fontSize)
 {
-    #if !defined(RAYGUI_GROUPBOX_LINE_THICK)
-        #define RAYGUI_GROUPBOX_LINE_THICK     1
-    #endif
-
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+#if !defined(RAYGUI_STANDALONE)
+    if ((fontSize <= 0) || ((fontSize + 2*RAYGUI_GLYPH_CACHE_PADDING) > (RAYGUI_GLYPH_CACHE_ATLAS_SIZE/RAYGUI_GLYPH_CACHE_PAGES)))
+    {
+        RAYGUI_LOG("WARNING: Lazy font size does not fit atlas pages\n");
+        return false;
+    }
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR)));
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, RAYGUI_GROUPBOX_LINE_THICK }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR)));
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - 1, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR)));
+    int fileDataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileDataSize);
 
-    GuiLine(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y - GuiGetStyle(DEFAULT, TEXT_SIZE)/2, bounds.width, (float)GuiGetStyle(DEFAULT, TEXT_SIZE) }, text);
-    //--------------------------------------------------------------------
+    if (fileData == NULL) return false;
 
-    return result;
-}
+    GuiGlyphCache *cache = (GuiGlyphCache *)RAYGUI_CALLOC(1, sizeof(GuiGlyphCache));
+    if (cache == NULL)
+    {
+        UnloadFileData(fileData);
+        return false;
+    }
 
-// Line control
-int GuiLine(Rectangle bounds, const char *text)
-{
-    #if !defined(RAYGUI_LINE_MARGIN_TEXT)
-        #define RAYGUI_LINE_MARGIN_TEXT  12
-    #endif
-    #if !defined(RAYGUI_LINE_TEXT_PADDING)
-        #define RAYGUI_LINE_TEXT_PADDING  4
-    #endif
+    cache->fileData = fileData;
+    cache->fileDataSize = fileDataSize;
+    cache->fontSize = fontSize;
+    cache->owner = guiContext;
+    cache->glyphs = (GlyphInfo *)RAYGUI_CALLOC(RAYGUI_GLYPH_CACHE_MAX_GLYPHS, sizeof(GlyphInfo));
+    cache->recs = (Rectangle *)RAYGUI_CALLOC(RAYGUI_GLYPH_CACHE_MAX_GLYPHS, sizeof(Rectangle));
+    for (int i = 0; i < RAYGUI_GLYPH_CACHE_MAX_GLYPHS; i++) cache->pages[i] = -1;
+
+    // Atlas texture starts transparent, glyphs are uploaded on rasterization
+    Image atlas = { 0 };
+    atlas.data = RAYGUI_CALLOC(RAYGUI_GLYPH_CACHE_ATLAS_SIZE*RAYGUI_GLYPH_CACHE_ATLAS_SIZE*2, 1);
+    atlas.width = RAYGUI_GLYPH_CACHE_ATLAS_SIZE;
+    atlas.height = RAYGUI_GLYPH_CACHE_ATLAS_SIZE;
+    atlas.mipmaps = 1;
+    atlas.format = 2;           // PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+
+    if (atlas.data != NULL) cache->texture = LoadTextureFromImage(atlas);
+    RAYGUI_FREE(atlas.data);
+
+    // ASCII glyphs are pinned, always available for ASCII text and '?' fallback
+    int codepoints[95] = { 0 };
+    for (int i = 0; i < 95; i++) codepoints[i] = 32 + i;
+
+    if ((cache->glyphs == NULL) || (cache->recs == NULL) || (cache->texture.id == 0) || !GuiAddGlyphs(cache, codepoints, 95, true))
+    {
+        RAYGUI_LOG("WARNING: Lazy font could not be loaded\n");
+        GuiUnloadGlyphCache(cache);
+        return false;
+    }
 
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+    Font font = { 0 };
+    font.baseSize = fontSize;
+    font.glyphCount = RAYGUI_GLYPH_CACHE_MAX_GLYPHS;
+    font.glyphPadding = RAYGUI_GLYPH_CACHE_PADDING;
+    font.texture = cache->texture;
+    font.recs = cache->recs;
+    font.glyphs = cache->glyphs;
 
-    Color color = GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR));
+    // Previous lazy font is replaced, unloaded once new font is set
+    GuiGlyphCache *previous = guiGlyphCache;
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (text == NULL) GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height/2, bounds.width, 1 }, 0, BLANK, color);
-    else
-    {
-        Rectangle textBounds = { 0 };
-        textBounds.width = (float)GuiGetTextWidth(text) + 2;
-        textBounds.height = bounds.height;
-        textBounds.x = bounds.x + RAYGUI_LINE_MARGIN_TEXT;
-        textBounds.y = bounds.y;
+    GuiSetFont(font);
+    guiGlyphCache = cache;
 
-        // Draw line with embedded text label: "--- text --------------"
-        GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height/2, RAYGUI_LINE_MARGIN_TEXT - RAYGUI_LINE_TEXT_PADDING, 1 }, 0, BLANK, color);
-        GuiDrawText(text, textBounds, TEXT_ALIGN_LEFT, color);
-        GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + 12 + textBounds.width + 4, bounds.y + bounds.height/2, bounds.width - textBounds.width - RAYGUI_LINE_MARGIN_TEXT - RAYGUI_LINE_TEXT_PADDING, 1 }, 0, BLANK, color);
-    }
-    //--------------------------------------------------------------------
+    if (previous != NULL) GuiUnloadGlyphCache(previous);
 
-    return result;
+    return true;
+#else
+    (void)fileName;
+    (void)fontSize;
+    RAYGUI_LOG("WARNING: Lazy fonts require raylib\n");
+    return false;
+#endif
 }
 
-// Panel control
-int GuiPanel(Rectangle bounds, const char *text)
+// Unload lazy font (atlas, glyphs and font data)
+// NOTE: If lazy font is current gui font, default font is set
+void GuiUnloadFontLazy(void)
 {
-    #if !defined(RAYGUI_PANEL_BORDER_WIDTH)
-        #define RAYGUI_PANEL_BORDER_WIDTH   1
-    #endif
-
-    int result = RESULT_NONE;
-    GuiState state = guiState;
-
-    // Text will be drawn as a header bar (if provided)
-    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT };
-    if ((text != NULL) && (bounds.height < RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f)) bounds.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f;
+#if !defined(RAYGUI_STANDALONE)
+    if (guiGlyphCache == NULL) return;
 
-    if (text != NULL)
+    if (GuiIsFontLazy())
     {
-        // Move panel bounds after the header bar
-        bounds.y += (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
-        bounds.height -= (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
+        guiFont = GetFontDefault();
+        guiFontType = FONT_TYPE_NORMAL;
     }
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (text != NULL) result = GuiStatusBar(statusBar, text);  // Draw panel header as status bar
-
-    GuiDrawRectangle(bounds, RAYGUI_PANEL_BORDER_WIDTH, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR)),
-                     GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BASE_COLOR_DISABLED : (int)BACKGROUND_COLOR)));
-    //--------------------------------------------------------------------
-
-    return result;
+    GuiUnloadGlyphCache(guiGlyphCache);
+    guiGlyphCache = NULL;
+#endif
 }
 
-// Scroll Panel control
-int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector2 *scroll, Rectangle *view)
+// Set control style property value
+// NOTE: Metric value is already scaled, unscaled value kept for next scale changes is value/scale,
+// use GuiSetStyleUnscaled() to keep exact unscaled values, controls use GuiSetStyleTemp() for temporary changes
+void GuiSetStyle(int control, int property, int value)
 {
-    #define RAYGUI_MIN_SCROLLBAR_WIDTH     40
-    #define RAYGUI_MIN_SCROLLBAR_HEIGHT    40
-    #define RAYGUI_MIN_MOUSE_WHEEL_SPEED   20
-
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
 
-    Rectangle temp = { 0 };
-    if (view == NULL) view = &temp;
+    GuiSetStyleResolved(control, property, value, GuiIsStyleMetric(control, property)? (float)value/guiScale : (float)value);
+}
 
-    Vector2 scrollPos = { 0.0f, 0.0f };
-    if (scroll != NULL) scrollPos = *scroll;
+// Set control style property value, metric value is unscaled
+// NOTE: Metric value is resolved for gui scale, unscaled value is kept exactly for next scale changes
+void GuiSetStyleUnscaled(int control, int property, int value)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
 
-    // Text will be drawn as a header bar (if provided)
-    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT };
-    if (bounds.height < RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f) bounds.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f;
+    int resolved = value;
 
-    if (text != NULL)
+    if (GuiIsStyleMetric(control, property))
     {
-        // Move panel bounds after the header bar
-        bounds.y += (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
-        bounds.height -= (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT + 1;
+        float scaled = (float)value*guiScale;
+        resolved = (int)((scaled >= 0.0f)? scaled + 0.5f : scaled - 0.5f);
     }
 
-    bool hasHorizontalScrollBar = (content.width > bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH))? true : false;
-    bool hasVerticalScrollBar = (content.height > bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH))? true : false;
-
-    // Recheck to account for the other scrollbar being visible
-    if (!hasHorizontalScrollBar) hasHorizontalScrollBar = (hasVerticalScrollBar && (content.width > (bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH))))? true : false;
-    if (!hasVerticalScrollBar) hasVerticalScrollBar = (hasHorizontalScrollBar && (content.height > (bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH))))? true : false;
+    GuiSetStyleResolved(control, property, resolved, (float)value);
+}
 
-    int horizontalScrollBarWidth = hasHorizontalScrollBar? GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) : 0;
-    int verticalScrollBarWidth =  hasVerticalScrollBar? GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) : 0;
-    Rectangle horizontalScrollBar = {
-        (float)((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)bounds.x + verticalScrollBarWidth : (float)bounds.x) + GuiGetStyle(DEFAULT, BORDER_WIDTH),
-        (float)bounds.y + bounds.height - horizontalScrollBarWidth - GuiGetStyle(DEFAULT, BORDER_WIDTH),
-        (float)bounds.width - verticalScrollBarWidth - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH),
-        (float)horizontalScrollBarWidth
-    };
-    Rectangle verticalScrollBar = {
-        (float)((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) : (float)bounds.x + bounds.width - verticalScrollBarWidth - GuiGetStyle(DEFAULT, BORDER_WIDTH)),
-        (float)bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH),
-        (float)verticalScrollBarWidth,
-        (float)bounds.height - horizontalScrollBarWidth - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH)
-    };
+// Get control style property value
+int GuiGetStyle(int control, int property)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+    RAYGUI_STATS_ADD(styleReads, 1);
+    return guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
+}
 
-    // Make sure scroll bars have a minimum width/height
-    if (horizontalScrollBar.width < RAYGUI_MIN_SCROLLBAR_WIDTH) horizontalScrollBar.width = RAYGUI_MIN_SCROLLBAR_WIDTH;
-    if (verticalScrollBar.height < RAYGUI_MIN_SCROLLBAR_HEIGHT) verticalScrollBar.height = RAYGUI_MIN_SCROLLBAR_HEIGHT;
+// Get frame stats, counters accumulated since last reset
+GuiFrameStats GuiGetFrameStats(void)
+{
+#if defined(RAYGUI_FRAME_STATS)
+    return guiFrameStats;
+#else
+    GuiFrameStats stats = { 0 };
+    return stats;
+#endif
+}
 
-    // Calculate view area (area without the scrollbars)
-    *view = (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)?
-                RAYGUI_CLITERAL(Rectangle){ bounds.x + verticalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth, bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth } :
-                RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth, bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth };
+// Reset frame stats
+void GuiResetFrameStats(void)
+{
+#if defined(RAYGUI_FRAME_STATS)
+    memset(&guiFrameStats, 0, sizeof(GuiFrameStats));
+#endif
+}
 
-    // Clip view area to the actual content size
-    if (view->width > content.width) view->width = content.width;
-    if (view->height > content.height) view->height = content.height;
+// Set profile scopes callbacks
+// NOTE: Callbacks replace any active trace file collector
+void GuiSetProfileCallbacks(GuiProfileCallback begin, GuiProfileCallback end, void *userData)
+{
+#if defined(RAYGUI_PROFILE)
+    guiProfileBegin = begin;
+    guiProfileEnd = end;
+    guiProfileUserData = userData;
+#else
+    (void)begin;
+    (void)end;
+    (void)userData;
+#endif
+}
 
-    float horizontalMin = hasHorizontalScrollBar? ((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)-verticalScrollBarWidth : 0) - (float)GuiGetStyle(DEFAULT, BORDER_WIDTH) : (((float)GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)-verticalScrollBarWidth : 0) - (float)GuiGetStyle(DEFAULT, BORDER_WIDTH);
-    float horizontalMax = hasHorizontalScrollBar? content.width - bounds.width + (float)verticalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH) - (((float)GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)verticalScrollBarWidth : 0) : (float)-GuiGetStyle(DEFAULT, BORDER_WIDTH);
-    float verticalMin = -(float)GuiGetStyle(DEFAULT, BORDER_WIDTH);
-    float verticalMax = hasVerticalScrollBar? content.height - bounds.height + (float)horizontalScrollBarWidth + (float)GuiGetStyle(DEFAULT, BORDER_WIDTH) : (float)-GuiGetStyle(DEFAULT, BORDER_WIDTH);
+// Begin writing profile scopes to a trace file
+// NOTE: Trace Event Format (JSON), it can be opened with chrome://tracing or ui.perfetto.dev
+bool GuiTraceBegin(const char *fileName)
+{
+    bool result = false;
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+#if defined(RAYGUI_PROFILE)
+    if (guiTraceFile != NULL) GuiTraceEnd();
 
-        // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
+    guiTraceFile = fopen(fileName, "wt");
 
-#if defined(SUPPORT_SCROLLBAR_KEY_INPUT)
-            if (hasHorizontalScrollBar)
-            {
-                if (GUI_KEY_DOWN(KEY_RIGHT)) scrollPos.x -= GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                if (GUI_KEY_DOWN(KEY_LEFT)) scrollPos.x += GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-            }
+    if (guiTraceFile != NULL)
+    {
+        fprintf(guiTraceFile, "{\"traceEvents\":[\n");
 
-            if (hasVerticalScrollBar)
-            {
-                if (GUI_KEY_DOWN(KEY_DOWN)) scrollPos.y -= GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                if (GUI_KEY_DOWN(KEY_UP)) scrollPos.y += GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-            }
-#endif
-            float scrollDelta = GUI_SCROLL_DELTA;
+        guiTraceStartTime = GetTime();
+        guiTraceEventCount = 0;
 
-            // Set scrolling speed with mouse wheel based on ratio between bounds and content
-            Vector2 scrollSpeed = { content.width/bounds.width, content.height/bounds.height };
-            if (scrollSpeed.x < RAYGUI_MIN_MOUSE_WHEEL_SPEED) scrollSpeed.x = RAYGUI_MIN_MOUSE_WHEEL_SPEED;
-            if (scrollSpeed.y < RAYGUI_MIN_MOUSE_WHEEL_SPEED) scrollSpeed.y = RAYGUI_MIN_MOUSE_WHEEL_SPEED;
+        GuiSetProfileCallbacks(GuiTraceScopeBegin, GuiTraceScopeEnd, guiTraceFile);
 
-            // Horizontal and vertical scrolling with mouse wheel
-            if (hasHorizontalScrollBar && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_LEFT_SHIFT))) scrollPos.x += scrollDelta*scrollSpeed.x;
-            else scrollPos.y += scrollDelta*scrollSpeed.y; // Vertical scroll
-        }
+        result = true;
     }
+#else
+    (void)fileName;
+#endif
 
-    // Normalize scroll values
-    if (scrollPos.x > -horizontalMin) scrollPos.x = -horizontalMin;
-    if (scrollPos.x < -horizontalMax) scrollPos.x = -horizontalMax;
-    if (scrollPos.y > -verticalMin) scrollPos.y = -verticalMin;
-    if (scrollPos.y < -verticalMax) scrollPos.y = -verticalMax;
-    //--------------------------------------------------------------------
+    return result;
+}
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (text != NULL) result = GuiStatusBar(statusBar, text);  // Draw panel header as status bar
+// End writing profile scopes, close trace file
+void GuiTraceEnd(void)
+{
+#if defined(RAYGUI_PROFILE)
+    if (guiTraceFile != NULL)
+    {
+        fprintf(guiTraceFile, "\n]}\n");
+        fclose(guiTraceFile);
+        guiTraceFile = NULL;
 
-    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));        // Draw background
+        GuiSetProfileCallbacks(NULL, NULL, NULL);
+    }
+#endif
+}
 
-    // Save size of the scrollbar slider
-    const int slider = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+#if defined(RAYGUI_INPUT_STATE)
+// Keys tracked on input state: backend key code and input key flag
+#define RAYGUI_INPUT_KEYS_COUNT     15
+static const int guiInputKeys[RAYGUI_INPUT_KEYS_COUNT][2] = {
+    { KEY_ENTER, INPUT_KEY_ENTER },
+    { KEY_KP_ENTER, INPUT_KEY_KP_ENTER },
+    { KEY_BACKSPACE, INPUT_KEY_BACKSPACE },
+    { KEY_DELETE, INPUT_KEY_DELETE },
+    { KEY_RIGHT, INPUT_KEY_RIGHT },
+    { KEY_LEFT, INPUT_KEY_LEFT },
+    { KEY_DOWN, INPUT_KEY_DOWN },
+    { KEY_UP, INPUT_KEY_UP },
+    { KEY_HOME, INPUT_KEY_HOME },
+    { KEY_END, INPUT_KEY_END },
+    { KEY_MINUS, INPUT_KEY_MINUS },
+    { KEY_V, INPUT_KEY_V },
+    { KEY_LEFT_SHIFT, INPUT_KEY_LEFT_SHIFT },
+    { KEY_LEFT_CONTROL, INPUT_KEY_LEFT_CONTROL },
+    { KEY_RIGHT_CONTROL, INPUT_KEY_RIGHT_CONTROL }
+};
+#endif
 
-    // Draw horizontal scrollbar if visible
-    if (hasHorizontalScrollBar)
+#if !defined(RAYGUI_STANDALONE)
+// Update input state from backend
+// NOTE: Inputs are polled once using GUI_* input macros, so custom inputs mapping is respected
+void GuiUpdateInputState(void)
+{
+#if defined(RAYGUI_INPUT_STATE)
+    GuiInputState state = { 0 };
+
+    state.pointer = GUI_POINTER_POSITION;
+    state.scrollDelta = GUI_SCROLL_DELTA;
+    state.buttonDown = GUI_BUTTON_DOWN;
+    state.buttonDownAlt = GUI_BUTTON_DOWN_ALT;
+    state.buttonPressed = GUI_BUTTON_PRESSED;
+    state.buttonPressedMid = GUI_BUTTON_PRESSED_MID;
+    state.buttonReleased = GUI_BUTTON_RELEASED;
+
+    for (int i = 0; i < RAYGUI_INPUT_KEYS_COUNT; i++)
     {
-        // Change scrollbar slider size to show the diff in size between the content width and the widget width
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)/(int)content.width)*((int)bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)));
-        scrollPos.x = (float)-GuiScrollBar(horizontalScrollBar, (int)-scrollPos.x, (int)horizontalMin, (int)horizontalMax);
+        if (GUI_KEY_DOWN(guiInputKeys[i][0])) state.keysDown |= guiInputKeys[i][1];
+        if (GUI_KEY_PRESSED(guiInputKeys[i][0])) state.keysPressed |= guiInputKeys[i][1];
     }
-    else scrollPos.x = 0.0f;
 
-    // Draw vertical scrollbar if visible
-    if (hasVerticalScrollBar)
+    int codepoint = GUI_INPUT_KEY;
+    while ((codepoint > 0) && (state.charCount < RAYGUI_INPUT_MAX_CHARS))
     {
-        // Change scrollbar slider size to show the diff in size between the content height and the widget height
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)/(int)content.height)*((int)bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)));
-        scrollPos.y = (float)-GuiScrollBar(verticalScrollBar, (int)-scrollPos.y, (int)verticalMin, (int)verticalMax);
+        state.chars[state.charCount] = codepoint;
+        state.charCount++;
+
+        if (state.charCount < RAYGUI_INPUT_MAX_CHARS) codepoint = GUI_INPUT_KEY;
     }
-    else scrollPos.y = 0.0f;
 
-    // Draw detail corner rectangle if both scroll bars are visible
-    if (hasHorizontalScrollBar && hasVerticalScrollBar)
+    GuiSetInputState(state);
+#endif
+}
+#endif
+
+// Set input state provided by user
+// NOTE: Provided state is ignored while replaying an input file
+void GuiSetInputState(GuiInputState state)
+{
+#if defined(RAYGUI_INPUT_STATE)
+    if (guiInputReplayFile != NULL)
     {
-        Rectangle corner = { (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) + 2) : (horizontalScrollBar.x + horizontalScrollBar.width + 2), verticalScrollBar.y + verticalScrollBar.height + 2, (float)horizontalScrollBarWidth - 4, (float)verticalScrollBarWidth - 4 };
-        GuiDrawRectangle(corner, 0, BLANK, GetColor(GuiGetStyle(LISTVIEW, TEXT + (state*3))));
+        if (!GuiReadInputFrame(&state)) GuiInputReplayEnd();
     }
 
-    // Draw scrollbar lines depending on current state
-    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + (state*3))), BLANK);
+    if (state.charCount > RAYGUI_INPUT_MAX_CHARS) state.charCount = RAYGUI_INPUT_MAX_CHARS;
 
-    // Set scrollbar slider size back to the way it was before
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, slider);
-    //--------------------------------------------------------------------
+    if (guiInputRecordFile != NULL)
+    {
+        // Previous frame is written once completed, including its clipboard reads
+        if (guiInputRecordPending) GuiWriteInputFrame();
 
-    if (scroll != NULL) *scroll = scrollPos;
+        guiInputRecordFrame = state;
+        guiInputRecordPending = true;
+        guiInputClipboardSize = -1;
+    }
 
-    return result;
+    guiInputState = state;
+    guiInputCharIndex = 0;
+#else
+    (void)state;
+#endif
 }
 
-// Label control
-int GuiLabel(Rectangle bounds, const char *text)
+// Get current input state
+GuiInputState GuiGetInputState(void)
 {
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+#if defined(RAYGUI_INPUT_STATE)
+    return guiInputState;
+#else
+    GuiInputState state = { 0 };
+    return state;
+#endif
+}
 
-    // Update control
-    //--------------------------------------------------------------------
-    //...
-    //--------------------------------------------------------------------
+// Begin recording input state per frame into a file
+// NOTE: Every input state set after this call is recorded, including clipboard reads
+bool GuiInputRecordBegin(const char *fileName)
+{
+    // Input Record File Structure (.rgi)
+    // NOTE: All values are stored little-endian, floats as their IEEE 754 bits
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGI "
+    // 4       | 2       | short      | Version: 100
+    // 6       | 2       | short      | reserved
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
-    //--------------------------------------------------------------------
+    // Frames Data (1 byte minimum per frame, only changes from previous frame are stored)
+    // foreach (frame)
+    // {
+    //   ...   | 1       | char       | Frame changes flags
+    //   if (flags & 0x01)  | 4   | short[2] | Pointer delta (integer)
+    //   if (flags & 0x80)  | 8   | float[2] | Pointer position (absolute)
+    //   if (flags & 0x02)  | 4   | float    | Scroll delta
+    //   if (flags & 0x04)  | 1   | char     | Buttons state (bits: down, downAlt, pressed, pressedMid, released)
+    //   if (flags & 0x08)  | 2   | short    | Keys down (GuiInputKey flags)
+    //   if (flags & 0x10)  | 2   | short    | Keys pressed (GuiInputKey flags)
+    //   if (flags & 0x20)  | 1+4*n | char + int[n] | Codepoints count and codepoints
+    //   if (flags & 0x40)  | 2+n | short + char[n] | Clipboard text size and text (read on that frame)
+    // }
+    // ------------------------------------------------------
 
-    return result;
-}
+    bool result = false;
 
-// Button control, returns true when clicked
-int GuiButton(Rectangle bounds, const char *text)
-{
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+#if defined(RAYGUI_INPUT_STATE)
+    if (guiInputRecordFile != NULL) GuiInputRecordEnd();
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    guiInputRecordFile = fopen(fileName, "wb");
+
+    if (guiInputRecordFile != NULL)
     {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+        fwrite("rGI ", 1, 4, guiInputRecordFile);
+        GuiWriteInputValue(100, 2);     // Version
+        GuiWriteInputValue(0, 2);       // reserved
 
-        // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
+        memset(&guiInputRecordPrev, 0, sizeof(GuiInputState));
+        guiInputRecordPending = false;
+        guiInputClipboardSize = -1;
 
-            if (GUI_BUTTON_RELEASED) result = RESULT_PRESSED;
-        }
+        result = true;
     }
-    //--------------------------------------------------------------------
+#else
+    (void)fileName;
+#endif
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(BUTTON, BORDER_WIDTH), GetColor(GuiGetStyle(BUTTON, BORDER + (state*3))), GetColor(GuiGetStyle(BUTTON, BASE + (state*3))));
-    GuiDrawText(text, GetTextBounds(BUTTON, bounds), GuiGetStyle(BUTTON, TEXT_ALIGNMENT), GetColor(GuiGetStyle(BUTTON, TEXT + (state*3))));
+    return result;
+}
 
-    if (state == STATE_FOCUSED) GuiTooltip(bounds);
-    //------------------------------------------------------------------
+// End recording input state, close file
+void GuiInputRecordEnd(void)
+{
+#if defined(RAYGUI_INPUT_STATE)
+    if (guiInputRecordFile != NULL)
+    {
+        if (guiInputRecordPending) GuiWriteInputFrame();
 
-    return result;
+        fclose(guiInputRecordFile);
+        guiInputRecordFile = NULL;
+        guiInputRecordPending = false;
+    }
+#endif
 }
 
-// Label button control
-int GuiLabelButton(Rectangle bounds, const char *text)
+// Begin replaying input state from a file
+// NOTE: One recorded frame is consumed on every GuiUpdateInputState()/GuiSetInputState() call
+bool GuiInputReplayBegin(const char *fileName)
 {
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+    bool result = false;
 
-    // NOTE: Force bounds.width to be all text
-    float textWidth = (float)GuiGetTextWidth(text);
-    if ((bounds.width - 2*GuiGetStyle(LABEL, BORDER_WIDTH) - 2*GuiGetStyle(LABEL, TEXT_PADDING)) < textWidth) bounds.width = textWidth + 2*GuiGetStyle(LABEL, BORDER_WIDTH) + 2*GuiGetStyle(LABEL, TEXT_PADDING) + 2;
+#if defined(RAYGUI_INPUT_STATE)
+    if (guiInputReplayFile != NULL) GuiInputReplayEnd();
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    guiInputReplayFile = fopen(fileName, "rb");
+
+    if (guiInputReplayFile != NULL)
     {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+        char signature[5] = { 0 };
+        unsigned int version = 0;
+        unsigned int reserved = 0;
+
+        bool valid = (fread(signature, 1, 4, guiInputReplayFile) == 4) &&
+            GuiReadInputValue(&version, 2) && GuiReadInputValue(&reserved, 2);
+
+        if (valid &&
+            (signature[0] == 'r') &&
+            (signature[1] == 'G') &&
+            (signature[2] == 'I') &&
+            (signature[3] == ' ') &&
+            (version == 100))
+        {
+            memset(&guiInputState, 0, sizeof(GuiInputState));
+            guiInputClipboardSize = -1;
 
-        // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+            result = true;
+        }
+        else
         {
-            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
+            RAYGUI_LOG("WARNING: Input file not valid: %s\n", fileName);
 
-            if (GUI_BUTTON_RELEASED) result = RESULT_PRESSED;
+            fclose(guiInputReplayFile);
+            guiInputReplayFile = NULL;
         }
     }
-    //--------------------------------------------------------------------
-
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
-    //--------------------------------------------------------------------
+#else
+    (void)fileName;
+#endif
 
     return result;
 }
 
-// Toggle Button control
-int GuiToggle(Rectangle bounds, const char *text, bool *active)
+// End replaying input state, close file
+void GuiInputReplayEnd(void)
 {
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+#if defined(RAYGUI_INPUT_STATE)
+    if (guiInputReplayFile != NULL)
+    {
+        fclose(guiInputReplayFile);
+        guiInputReplayFile = NULL;
+        guiInputClipboardSize = -1;
+    }
+#endif
+}
 
-    bool temp = false;
-    if (active == NULL) active = &temp;
+// Check if input is being replayed
+bool GuiIsInputReplaying(void)
+{
+#if defined(RAYGUI_INPUT_STATE)
+    return (guiInputReplayFile != NULL);
+#else
+    return false;
+#endif
+}
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+#if defined(RAYGUI_INPUT_STATE)
+// Redefine input macros to read from input state, all controls below use the frame snapshot
+#undef GUI_BUTTON_DOWN
+#undef GUI_BUTTON_DOWN_ALT
+#undef GUI_BUTTON_PRESSED
+#undef GUI_BUTTON_PRESSED_MID
+#undef GUI_BUTTON_RELEASED
+#undef GUI_SCROLL_DELTA
+#undef GUI_POINTER_POSITION
+#undef GUI_KEY_DOWN
+#undef GUI_KEY_PRESSED
+#undef GUI_INPUT_KEY
+#undef GUI_CLIPBOARD_TEXT
+
+#define GUI_BUTTON_DOWN         guiInputState.buttonDown
+#define GUI_BUTTON_DOWN_ALT     guiInputState.buttonDownAlt
+#define GUI_BUTTON_PRESSED      guiInputState.buttonPressed
+#define GUI_BUTTON_PRESSED_MID  guiInputState.buttonPressedMid
+#define GUI_BUTTON_RELEASED     guiInputState.buttonReleased
+#define GUI_SCROLL_DELTA        guiInputState.scrollDelta
+#define GUI_POINTER_POSITION    guiInputState.pointer
+#define GUI_KEY_DOWN(key)       ((guiInputState.keysDown & GuiGetInputKeyFlag(key)) != 0)
+#define GUI_KEY_PRESSED(key)    ((guiInputState.keysPressed & GuiGetInputKeyFlag(key)) != 0)
+#define GUI_INPUT_KEY           ((guiInputCharIndex < guiInputState.charCount)? guiInputState.chars[guiInputCharIndex++] : 0)
+#define GUI_CLIPBOARD_TEXT      GuiGetInputClipboardText()
+#endif
 
-        // Check toggle button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+// Begin gui frame
+// NOTE 1: Required for controls ids from controls sequence, if never called controls ids are hashed
+// from controls bounds, so they change when a control moves (i.e. while being dragged)
+// NOTE 2: With RAYGUI_HITTEST, hovered control is resolved from controls registered on previous frame
+void GuiBeginFrame(void)
+{
+#if defined(RAYGUI_HITTEST)
+    Vector2 mousePoint = GUI_POINTER_POSITION;
+    guiHitTestHovered = -1;
+    guiHitTestResolved = CheckCollisionPointRec(mousePoint, guiHitTestWindow);
+
+    if (guiHitTestResolved)
+    {
+        // Entries are stored last registered first, so first hit on pointer cell is the topmost
+        int cellX = (int)((mousePoint.x - guiHitTestWindow.x)/RAYGUI_HITTEST_CELL_SIZE);
+        int cellY = (int)((mousePoint.y - guiHitTestWindow.y)/RAYGUI_HITTEST_CELL_SIZE);
+        if (cellX > (RAYGUI_HITTEST_WINDOW_CELLS - 1)) cellX = RAYGUI_HITTEST_WINDOW_CELLS - 1;
+        if (cellY > (RAYGUI_HITTEST_WINDOW_CELLS - 1)) cellY = RAYGUI_HITTEST_WINDOW_CELLS - 1;
+        int cell = cellY*RAYGUI_HITTEST_WINDOW_CELLS + cellX;
+
+        for (int entry = guiHitTestCells[cell]; entry > 0; entry = guiHitTestEntryNext[entry - 1])
         {
-            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            else if (GUI_BUTTON_RELEASED)
-            {
-                state = STATE_NORMAL;
-                *active = !(*active);
+            int control = guiHitTestEntryControl[entry - 1];
 
-                result = RESULT_CHANGED;
+            if (CheckCollisionPointRec(mousePoint, guiHitTestBounds[control]))
+            {
+                guiHitTestHovered = control;
+                break;
             }
-            else state = STATE_FOCUSED;
         }
     }
-    //--------------------------------------------------------------------
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (state == STATE_NORMAL)
-    {
-        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, ((*active)? BORDER_COLOR_PRESSED : (BORDER + state*3)))), GetColor(GuiGetStyle(TOGGLE, ((*active)? BASE_COLOR_PRESSED : (BASE + state*3)))));
-        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, ((*active)? TEXT_COLOR_PRESSED : (TEXT + state*3)))));
-    }
-    else
+    if (guiHitTestHovered >= 0) guiHitTestHoveredBounds = guiHitTestBounds[guiHitTestHovered];
+
+    // Reset grid for current frame registrations, grid window centered on pointer cell
+    float windowCellX = floorf(mousePoint.x/RAYGUI_HITTEST_CELL_SIZE) - (float)(RAYGUI_HITTEST_WINDOW_CELLS/2);
+    float windowCellY = floorf(mousePoint.y/RAYGUI_HITTEST_CELL_SIZE) - (float)(RAYGUI_HITTEST_WINDOW_CELLS/2);
+    guiHitTestWindow = RAYGUI_CLITERAL(Rectangle){ windowCellX*RAYGUI_HITTEST_CELL_SIZE, windowCellY*RAYGUI_HITTEST_CELL_SIZE,
+        RAYGUI_HITTEST_WINDOW_CELLS*RAYGUI_HITTEST_CELL_SIZE, RAYGUI_HITTEST_WINDOW_CELLS*RAYGUI_HITTEST_CELL_SIZE };
+
+    memset(guiHitTestCells, 0, sizeof(guiHitTestCells));
+    guiHitTestCount = 0;
+    guiHitTestEntryCount = 0;
+#endif
+
+    // Lazy font glyphs added on previous frame invalidate retained text measures,
+    // generation is increased once per frame, not for every glyph added
+    // NOTE: Only owner context frames update the cache, contexts sharing it could be recording on other threads
+    if ((guiGlyphCache != NULL) && (guiGlyphCache->owner == guiContext))
     {
-        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + state*3)), GetColor(GuiGetStyle(TOGGLE, BASE + state*3)));
-        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, TEXT + state*3)));
+        if (guiGlyphCache->added)
+        {
+            guiGlyphCache->generation++;
+            guiGlyphCache->added = false;
+        }
+
+        guiGlyphCache->frame++;
     }
 
-    if (state == STATE_FOCUSED) GuiTooltip(bounds);
-    //--------------------------------------------------------------------
+    // Restart controls automatic ids sequence
+    guiIdCount = 1;
+    guiIdStack[0].counter = 0;
 
-    return result;
+#if defined(RAYGUI_STYLE_HOT_RELOAD)
+    if ((guiFrameCounter%RAYGUI_STYLE_WATCH_FRAMES) == 0) GuiUpdateStyleWatch();
+#endif
+
+    guiFrameCounter++;
 }
 
-// Toggle Group control
-int GuiToggleGroup(Rectangle bounds, const char *text, int *active)
+// End gui frame
+// NOTE: SDF font shader could be kept active after last text drawn, it is ended here,
+// required before any other drawing if SDF fonts are used (not required for command lists)
+void GuiEndFrame(void)
 {
-    int result = RESULT_NONE;
+    GuiSetFontShaderActive(false);
+}
 
-    #if !defined(RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE)
-        #define RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE       256
-    #endif
+// Push string id scope, following controls ids are hashed with it
+// NOTE: Useful to keep controls ids stable when controls are conditionally drawn or repeated
+void GuiPushID(const char *strId)
+{
+    GuiPushControlID(GuiGetID(strId));
+}
 
-    // One toggle group item text
-    static char itemText[RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE] = { 0 };
-    memset(itemText, 0, RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE);
+// Push integer id scope, following controls ids are hashed with it
+void GuiPushIDInt(int intId)
+{
+    GuiPushControlID(GuiHashID(guiIdStack[((guiIdCount < RAYGUI_ID_STACK_SIZE)? guiIdCount : RAYGUI_ID_STACK_SIZE) - 1].seed, &intId, sizeof(int)));
+}
 
-    int temp = 0;
-    int prevActive = (active == NULL)? 0 : *active;
-    if (active == NULL) active = &temp;
+// Pop id scope, restoring previous one
+void GuiPopID(void)
+{
+    if (guiIdCount > 1) guiIdCount--;
+}
 
-    bool toggle = false;    // Required for individual toggles
+// Get id for string on current id scope
+GuiID GuiGetID(const char *strId)
+{
+    GuiID seed = guiIdStack[((guiIdCount < RAYGUI_ID_STACK_SIZE)? guiIdCount : RAYGUI_ID_STACK_SIZE) - 1].seed;
 
-    const char *textPtr = text;
-    bool itemReady = false;
-    float initBoundsX = bounds.x;
-    float initBoundsY = bounds.y;
+    return GuiHashID(seed, strId, (strId != NULL)? (int)strlen(strId) : 0);
+}
 
-    if (GuiGetStyle(TOGGLE, GROUP_WIDTH_FULL))
+// Push clip region, intersected with current one
+// NOTE: Scissor mode is enabled on backend, controls completely outside clip region are culled (not processed)
+void GuiPushClip(Rectangle bounds)
+{
+    if (guiClipCount > 0)
     {
-        // Calculate item width considring all horizontal items
-        // NOTE: bounds.height still considers individual items height
-        int itemCount = 1;
-        for (int c = 0; textPtr[c] != '\0'; c++) { if (textPtr[c] == ';') itemCount++; }
-        bounds.width /= itemCount;
+        Rectangle clip = GuiGetClip();
+
+        float x0 = (bounds.x > clip.x)? bounds.x : clip.x;
+        float y0 = (bounds.y > clip.y)? bounds.y : clip.y;
+        float x1 = ((bounds.x + bounds.width) < (clip.x + clip.width))? (bounds.x + bounds.width) : (clip.x + clip.width);
+        float y1 = ((bounds.y + bounds.height) < (clip.y + clip.height))? (bounds.y + bounds.height) : (clip.y + clip.height);
+
+        bounds = RAYGUI_CLITERAL(Rectangle){ x0, y0, (x1 > x0)? (x1 - x0) : 0, (y1 > y0)? (y1 - y0) : 0 };
     }
 
-    // Text parsing needed to consider potential row and col entries (vertical/horizontal layout)
-    // when '\n' found move vertically next toggle, when ';' found move horizontally
-    for (int c = 0, k = 0, itemIndex = 0, row = 0, col = 0, exit = 0; exit == 0; c++)
+    if (guiClipCount < RAYGUI_CLIP_STACK_SIZE)
     {
-        // Process text to get items one by one
-        // NOTE: Setting columns and rows index properly
-        if (textPtr[c] == '\n')
-        {
-            row++;
-            col = 0;
-            itemReady = true;
-        }
-        else if (textPtr[c] == ';')
-        {
-            col++;
-            itemReady = true;
-        }
-        else if (textPtr[c] == '\0')
-        {
-            itemReady = true;
-            exit = 1;
-        }
-        else
-        {
-            itemText[k] = textPtr[c];
-            k++;
-        }
+        guiClipStack[guiClipCount] = bounds;
+        GuiCmdBeginScissor((int)bounds.x, (int)bounds.y, (int)bounds.width, (int)bounds.height);
+    }
+    else RAYGUI_LOG("WARNING: Clip stack is full, clip region ignored\n");
 
-        if (itemReady)
-        {
-            // When a next item is ready, draw its toggle
-            if (itemIndex == (*active))
-            {
-                toggle = true;
-                GuiToggle(bounds, itemText, &toggle);
-            }
-            else
-            {
-                toggle = false;
-                GuiToggle(bounds, itemText, &toggle);
-                if (toggle) *active = itemIndex;
-            }
+    guiClipCount++;
+}
 
-            // Calculate next item position
-            bounds.x = initBoundsX + col*(bounds.width + GuiGetStyle(TOGGLE, GROUP_PADDING));
-            bounds.y = initBoundsY + row*(bounds.height + GuiGetStyle(TOGGLE, GROUP_PADDING));
+// Pop clip region, restoring previous one
+void GuiPopClip(void)
+{
+    if (guiClipCount > 0)
+    {
+        guiClipCount--;
 
-            itemIndex++;
-            itemReady = false;
-            memset(itemText, 0, k + 1);
-            k = 0;
+        if (guiClipCount == 0) GuiCmdEndScissor();
+        else if (guiClipCount < RAYGUI_CLIP_STACK_SIZE)
+        {
+            Rectangle clip = guiClipStack[guiClipCount - 1];
+            GuiCmdBeginScissor((int)clip.x, (int)clip.y, (int)clip.width, (int)clip.height);
         }
     }
+}
 
-    if (prevActive != *active) result = RESULT_CHANGED;
+// Get current clip region
+Rectangle GuiGetClip(void)
+{
+    Rectangle clip = { 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() };
 
-    return result;
+    if (guiClipCount > 0) clip = guiClipStack[((guiClipCount < RAYGUI_CLIP_STACK_SIZE)? guiClipCount : RAYGUI_CLIP_STACK_SIZE) - 1];
+
+    return clip;
 }
 
-// Toggle Slider control extended
-int GuiToggleSlider(Rectangle bounds, const char *text, int *active)
+#if defined(RAYGUI_COMMAND_LISTS)
+//----------------------------------------------------------------------------------
+// Gui Command Lists Functions Definition
+//----------------------------------------------------------------------------------
+// Load command list with initial capacity
+GuiCommandList GuiLoadCommandList(int capacity)
 {
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+    GuiCommandList list = { 0 };
 
-    int temp = 0;
-    int prevActive = (active == NULL)? 0 : *active;
-    if (active == NULL) active = &temp;
+    if (capacity > 0)
+    {
+        list.commands = (GuiCommand *)RAYGUI_MALLOC(capacity*sizeof(GuiCommand));
+        if (list.commands != NULL) list.capacity = capacity;
+    }
 
-    // Get substrings items from text (items pointers)
-    int itemCount = 0;
-    char **items = NULL;
+    return list;
+}
 
-    if (text != NULL) items = GuiTextSplit(text, ';', &itemCount);
+// Unload command list
+void GuiUnloadCommandList(GuiCommandList list)
+{
+    RAYGUI_FREE(list.commands);
+}
 
-    Rectangle slider = {
-        0,      // Calculated later depending on the active toggle
-        bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH) + GuiGetStyle(SLIDER, SLIDER_PADDING),
-        (bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - (itemCount + 1)*GuiGetStyle(SLIDER, SLIDER_PADDING))/itemCount,
-        bounds.height - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - 2*GuiGetStyle(SLIDER, SLIDER_PADDING) };
+// Begin recording current context drawing into command list
+// NOTE: List is cleared, previous commands are discarded
+void GuiBeginCommandList(GuiCommandList *list, int order)
+{
+    // Font shader active for backend drawing is ended, list starts with no shader
+    GuiSetFontShaderActive(false);
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked)
+    if (list != NULL)
     {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+        list->count = 0;
+        list->order = order;
+    }
 
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            else if (GUI_BUTTON_RELEASED)
+    guiCommandList = list;
+}
+
+// End recording current context drawing
+void GuiEndCommandList(void)
+{
+    // Font shader active on list is ended on list, lists are drawn independently
+    if (guiCommandList != NULL) GuiSetFontShaderActive(false);
+
+    guiCommandList = NULL;
+}
+
+// Draw command lists, merged by z-order
+// NOTE: Lists with same order are drawn in provided order, drawing happens on calling thread
+void GuiDrawCommandLists(const GuiCommandList *lists, int count)
+{
+    if (lists == NULL) return;
+
+    RAYGUI_PROFILE_BEGIN("GuiDrawCommandLists");
+
+#if !defined(RAYGUI_STANDALONE)
+    // Lazy font glyphs recorded as '?' (not resident on recording) by all lists, rasterized once lists are drawn
+    int pending[RAYGUI_GLYPH_CACHE_FRAME_BUDGET] = { 0 };
+    int pendingCount = 0;
+#endif
+
+    // Draw lists by ascending order, one order value per pass
+    bool started = false;
+    int order = 0;
+
+    while (true)
+    {
+        bool found = false;
+        int nextOrder = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            if ((!started || (lists[i].order > order)) && (!found || (lists[i].order < nextOrder)))
             {
-                state = STATE_PRESSED;
-                (*active)++;
-                result = 1;
+                nextOrder = lists[i].order;
+                found = true;
             }
-            else state = STATE_FOCUSED;
         }
 
-        if ((*active) && (state != STATE_FOCUSED)) state = STATE_PRESSED;
-    }
+        if (!found) break;
 
-    if (*active >= itemCount) *active = 0;
-    slider.x = bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH) + (*active + 1)*GuiGetStyle(SLIDER, SLIDER_PADDING) + (*active)*slider.width;
+        for (int i = 0; i < count; i++)
+        {
+            if (lists[i].order != nextOrder) continue;
 
-    if (prevActive != *active) result = RESULT_CHANGED;
-    //--------------------------------------------------------------------
+            for (int c = 0; c < lists[i].count; c++)
+            {
+                const GuiCommand *command = &lists[i].commands[c];
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + (state*3))),
-        GetColor(GuiGetStyle(TOGGLE, BASE_COLOR_NORMAL)));
+                switch (command->type)
+                {
+                    case COMMAND_RECTANGLE: DrawRectangle((int)command->bounds.x, (int)command->bounds.y, (int)command->bounds.width, (int)command->bounds.height, command->colors[0]); break;
+                    case COMMAND_RECTANGLE_GRADIENT: DrawRectangleGradientEx(command->bounds, command->colors[0], command->colors[1], command->colors[2], command->colors[3]); break;
+                    case COMMAND_TEXTURE: DrawTexturePro(command->texture, command->source, command->bounds, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, command->colors[0]); break;
+                    case COMMAND_CODEPOINT: DrawTextCodepoint(command->font, command->codepoint, RAYGUI_CLITERAL(Vector2){ command->bounds.x, command->bounds.y }, command->fontSize, command->colors[0]); break;
+                    case COMMAND_SCISSOR_BEGIN: BeginScissorMode((int)command->bounds.x, (int)command->bounds.y, (int)command->bounds.width, (int)command->bounds.height); break;
+                    case COMMAND_SCISSOR_END: EndScissorMode(); break;
+                    case COMMAND_FONT_SHADER_BEGIN: GuiBeginFontShader(); break;
+                    case COMMAND_FONT_SHADER_END: GuiEndFontShader(); break;
+                    default: break;
+                }
 
-    // Draw internal slider
-    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
-    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_FOCUSED)));
-    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
+#if !defined(RAYGUI_STANDALONE)
+                // Lazy font pages used by recorded glyphs are stamped here, recording does not modify cache
+                if ((command->type == COMMAND_CODEPOINT) && (guiGlyphCache != NULL) && (command->font.texture.id == guiGlyphCache->texture.id))
+                {
+                    int slot = (int)(command->font.glyphs - guiGlyphCache->glyphs);
 
-    // Draw text in slider
-    if (text != NULL)
+                    if ((slot >= 0) && (slot < RAYGUI_GLYPH_CACHE_MAX_GLYPHS) && (guiGlyphCache->pages[slot] != -1))
+                    {
+                        guiGlyphCache->pageFrame[guiGlyphCache->pages[slot]] = guiGlyphCache->frame;
+
+                        if (guiGlyphCache->glyphs[slot].value != command->codepoint)
+                        {
+                            bool queued = false;
+                            for (int p = 0; p < pendingCount; p++) if (pending[p] == command->codepoint) queued = true;
+
+                            if (!queued && (pendingCount < RAYGUI_GLYPH_CACHE_FRAME_BUDGET))
+                            {
+                                pending[pendingCount] = command->codepoint;
+                                pendingCount++;
+                            }
+                        }
+                    }
+                }
+#endif
+            }
+        }
+
+        order = nextOrder;
+        started = true;
+    }
+
+#if !defined(RAYGUI_STANDALONE)
+    // Lazy font glyphs recorded as '?' are rasterized on rendering thread, once lists are drawn,
+    // so atlas pages referenced by recorded glyphs are not reused before being drawn (frame budget applies)
+    if ((guiGlyphCache != NULL) && (pendingCount > 0))
     {
-        Rectangle textBounds = { 0 };
-        textBounds.width = (float)GuiGetTextWidth(text);
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = slider.x + slider.width/2 - textBounds.width/2;
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        if (guiGlyphCache->budgetFrame != guiGlyphCache->frame)
+        {
+            guiGlyphCache->budgetFrame = guiGlyphCache->frame;
+            guiGlyphCache->budgetUsed = 0;
+        }
 
-        GuiDrawText(items[*active], textBounds, GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(TOGGLE, TEXT + (state*3))), guiAlpha));
+        int count = pendingCount;
+        if ((guiGlyphCache->frame > 0) && (count > (RAYGUI_GLYPH_CACHE_FRAME_BUDGET - guiGlyphCache->budgetUsed))) count = RAYGUI_GLYPH_CACHE_FRAME_BUDGET - guiGlyphCache->budgetUsed;
+
+        if (count > 0)
+        {
+            guiGlyphCache->budgetUsed += count;
+            GuiAddGlyphs(guiGlyphCache, pending, count, false);
+        }
     }
-    //--------------------------------------------------------------------
+#endif
 
-    return result;
+    RAYGUI_PROFILE_END("GuiDrawCommandLists");
 }
+#endif
 
-// Check Box control, returns 1 when state changed
-int GuiCheckBox(Rectangle bounds, const char *text, bool *checked)
+//----------------------------------------------------------------------------------
+// Gui Layout Functions Definition
+//----------------------------------------------------------------------------------
+// Begin layout container (row/column), computing items bounds
+// NOTE: Items bounds are cached, only recomputed when container size, items or text style change
+void GuiLayoutBegin(Rectangle bounds, int type, const GuiLayoutItem *items, int count, float spacing)
 {
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+    GuiLayoutContainerBegin(bounds, (type == LAYOUT_COLUMN)? LAYOUT_COLUMN : LAYOUT_ROW, 1, items, count, spacing);
+}
 
-    bool temp = false;
-    if (checked == NULL) checked = &temp;
+// Begin layout grid container, items are placed on equal width columns
+// NOTE: Items sizes define rows height, every row uses its biggest item size (or fills if any item fills)
+void GuiLayoutGridBegin(Rectangle bounds, int columns, const GuiLayoutItem *items, int count, float spacing)
+{
+    GuiLayoutContainerBegin(bounds, LAYOUT_GRID, (columns > 0)? columns : 1, items, count, spacing);
+}
 
-    Rectangle textBounds = { 0 };
+// Get next item bounds on current layout container
+// NOTE: Returns empty bounds if no container active or all container items already used
+Rectangle GuiLayoutNext(void)
+{
+    Rectangle bounds = { 0 };
 
-    if (text != NULL)
+    if ((guiLayoutCount > 0) && (guiLayoutCount <= RAYGUI_LAYOUT_STACK_SIZE) && (guiLayoutStack[guiLayoutCount - 1].entry >= 0))
     {
-        textBounds.width = (float)GuiGetTextWidth(text) + 2;
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + bounds.width + GuiGetStyle(CHECKBOX, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
-        if (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(CHECKBOX, TEXT_PADDING);
+        GuiLayoutContainer *container = &guiLayoutStack[guiLayoutCount - 1];
+        GuiLayoutCacheEntry *entry = &guiLayoutCache[container->entry];
+
+        if (container->next < entry->count)
+        {
+            bounds = guiLayoutItems[entry->offset + container->next];
+            bounds.x += container->bounds.x;
+            bounds.y += container->bounds.y;
+            container->next++;
+        }
     }
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+    return bounds;
+}
 
-        Rectangle totalBounds = {
-            (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT)? textBounds.x : bounds.x,
-            bounds.y,
-            bounds.width + textBounds.width + GuiGetStyle(CHECKBOX, TEXT_PADDING),
-            bounds.height,
-        };
+// End layout container, restoring parent container (if any)
+void GuiLayoutEnd(void)
+{
+    if (guiLayoutCount > 0)
+    {
+        guiLayoutCount--;
 
-        // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, totalBounds))
+        if ((guiLayoutCount < RAYGUI_LAYOUT_STACK_SIZE) && (guiLayoutStack[guiLayoutCount].entry >= 0))
         {
-            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
+            int entry = guiLayoutStack[guiLayoutCount].entry;
+            bool shared = false;
 
-            if (GUI_BUTTON_RELEASED)
-            {
-                *checked = !(*checked);
+            // Same cache entry could be used by a parent container with same inputs
+            for (int i = 0; i < guiLayoutCount; i++) if (guiLayoutStack[i].entry == entry) shared = true;
 
-                result = RESULT_CHANGED;
-            }
+            if (!shared) guiLayoutCache[entry].active = false;
         }
     }
-    //--------------------------------------------------------------------
-
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(CHECKBOX, BORDER_WIDTH), GetColor(GuiGetStyle(CHECKBOX, BORDER + (state*3))), BLANK);
+}
 
-    if (*checked)
-    {
-        Rectangle check = { bounds.x + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
-                            bounds.y + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
-                            bounds.width - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)),
-                            bounds.height - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)) };
-        GuiDrawRectangle(check, 0, BLANK, GetColor(GuiGetStyle(CHECKBOX, TEXT + state*3)));
-    }
+//----------------------------------------------------------------------------------
+// Gui Controls Functions Definition
+//----------------------------------------------------------------------------------
 
-    GuiDrawText(text, textBounds, (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
-    //--------------------------------------------------------------------
+// Window Box control
+int GuiWindowBox(Rectangle bounds, const char *title)
+{
+    // Window title bar height (including borders)
+    // NOTE: This define is also used by GuiMessageBox() and GuiTextInputBox()
+    #if !defined(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
+        #define RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT        24
+    #endif
 
-    return result;
-}
+    #if !defined(RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT)
+        #define RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT      18
+    #endif
 
-// Combo Box control
-int GuiComboBox(Rectangle bounds, const char *text, int *active)
-{
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
 
-    int temp = 0;
-    int prevActive = (active == NULL)? 0 : *active;
-    if (active == NULL) active = &temp;
+    RAYGUI_PROFILE_BEGIN("GuiWindowBox");
+    GuiPushControlID(id);
 
-    bounds.width -= (GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH) + GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING));
+    int result = RESULT_NONE;
+    //GuiState state = guiState;
 
-    Rectangle selector = { (float)bounds.x + bounds.width + GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING),
-                           (float)bounds.y, (float)GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH), (float)bounds.height };
+    int statusBarHeight = (int)(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*guiScale + 0.5f);
+	int statusBorderWidth = GuiGetStyle(STATUSBAR, BORDER_WIDTH);
+    float closeButtonHeight = RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT*guiScale;
 
-    // Get substrings items from text (items pointers, lengths and count)
-    int itemCount = 0;
-    char **items = GuiTextSplit(text, ';', &itemCount);
+    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)statusBarHeight };
+    if (bounds.height < statusBarHeight*2.0f) bounds.height = statusBarHeight*2.0f;
 
-    if (*active < 0) *active = 0;
-    else if (*active > (itemCount - 1)) *active = itemCount - 1;
+    const float vPadding = statusBarHeight/2.0f - closeButtonHeight/2.0f;
+    Rectangle windowPanel = { bounds.x, bounds.y + (float)statusBarHeight - (float)statusBorderWidth, bounds.width, bounds.height - (float)statusBarHeight + (float)statusBorderWidth };
+    Rectangle closeButtonRec = { statusBar.x + statusBar.width - (float)statusBorderWidth - closeButtonHeight - vPadding,
+                                 statusBar.y + vPadding, closeButtonHeight, closeButtonHeight };
 
     // Update control
     //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && (itemCount > 1) && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
-
-        if (CheckCollisionPointRec(mousePoint, bounds) ||
-            CheckCollisionPointRec(mousePoint, selector))
-        {
-            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
-
-            if (GUI_BUTTON_PRESSED)
-            {
-                *active += 1;
-                if (*active >= itemCount) *active = 0;      // Cyclic combobox
-            }
-        }
-    }
-
-    if (prevActive != *active) result = RESULT_CHANGED;
+    // NOTE: Logic is directly managed by button
+#if defined(RAYGUI_HITTEST)
+    GuiCheckHover(GUI_POINTER_POSITION, bounds);    // Register container for hit-testing, occluding controls below
+#endif
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    // Draw combo box main
-    GuiDrawRectangle(bounds, GuiGetStyle(COMBOBOX, BORDER_WIDTH), GetColor(GuiGetStyle(COMBOBOX, BORDER + (state*3))), GetColor(GuiGetStyle(COMBOBOX, BASE + (state*3))));
-    GuiDrawText(items[*active], GetTextBounds(COMBOBOX, bounds), GuiGetStyle(COMBOBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(COMBOBOX, TEXT + (state*3))));
-
-    // Draw selector using a custom button
-    // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiPanel(windowPanel, NULL);    // Draw window base
 
-    GuiButton(selector, TextFormat("%i/%i", *active + 1, itemCount));
+    int tempTextAlignment = GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT);
+    GuiSetStyleTemp(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+    GuiStatusBar(statusBar, title); // Draw window header as status bar
+    GuiSetStyleTemp(STATUSBAR, TEXT_ALIGNMENT, tempTextAlignment);
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+    // Draw window close button
+    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
+    tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiSetStyleTemp(BUTTON, BORDER_WIDTH, 1);
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+#if defined(RAYGUI_NO_ICONS)
+    result = GuiButton(closeButtonRec, "x");
+#else
+    result = GuiButton(closeButtonRec, GuiIconText(ICON_CROSS_SMALL, NULL));
+#endif
+    GuiSetStyleTemp(BUTTON, BORDER_WIDTH, tempBorderWidth);
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
     //--------------------------------------------------------------------
 
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiWindowBox");
     return result;
 }
 
-// Dropdown Box control
-// NOTE: Returns mouse click
-int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMode)
+// Group Box control with text name
+int GuiGroupBox(Rectangle bounds, const char *text)
 {
-    int result = RESULT_NONE;
-    GuiState state = guiState;
-
-    int temp = 0;
-    int prevActive = (active == NULL)? 0 : *active;
-    if (active == NULL) active = &temp;
+    #if !defined(RAYGUI_GROUPBOX_LINE_THICK)
+        #define RAYGUI_GROUPBOX_LINE_THICK     1
+    #endif
 
-    int itemSelected = *active;
-    int itemFocused = -1;
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
 
-    int direction = 0; // Dropdown box open direction: down (default)
-    if (GuiGetStyle(DROPDOWNBOX, DROPDOWN_ROLL_UP) == 1) direction = 1; // Up
+    RAYGUI_PROFILE_BEGIN("GuiGroupBox");
+    GuiPushControlID(id);
 
-    // Get substrings items from text (items pointers, lengths and count)
-    int itemCount = 0;
-    char **items = GuiTextSplit(text, ';', &itemCount);
+    int result = RESULT_NONE;
+    GuiState state = guiState;
 
-    Rectangle boundsOpen = bounds;
-    boundsOpen.height = (itemCount + 1)*(bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
-    if (direction == 1) boundsOpen.y -= itemCount*(bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING)) + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING);
+    float lineThick = (float)(int)(RAYGUI_GROUPBOX_LINE_THICK*guiScale + 0.5f);
 
-    Rectangle itemBounds = bounds;
+#if defined(RAYGUI_HITTEST)
+    GuiCheckHover(GUI_POINTER_POSITION, bounds);    // Register container for hit-testing, occluding controls below
+#endif
 
-    // Update control
+    // Draw control
     //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && (editMode || !guiLocked) && (itemCount > 1) && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, lineThick, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR)));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - lineThick, bounds.width, lineThick }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR)));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - lineThick, bounds.y, lineThick, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR)));
 
-        if (editMode)
-        {
-            state = STATE_PRESSED;
+    GuiLine(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y - GuiGetStyle(DEFAULT, TEXT_SIZE)/2, bounds.width, (float)GuiGetStyle(DEFAULT, TEXT_SIZE) }, text);
+    //--------------------------------------------------------------------
 
-            // Check if mouse has been pressed or released outside limits
-            if (!CheckCollisionPointRec(mousePoint, boundsOpen))
-            {
-                if (GUI_BUTTON_PRESSED || GUI_BUTTON_RELEASED) result = 1;
-            }
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiGroupBox");
+    return result;
+}
 
-            // Check if already selected item has been pressed again
-            if (CheckCollisionPointRec(mousePoint, bounds) && GUI_BUTTON_PRESSED) result = 1;
+// Line control
+int GuiLine(Rectangle bounds, const char *text)
+{
+    #if !defined(RAYGUI_LINE_MARGIN_TEXT)
+        #define RAYGUI_LINE_MARGIN_TEXT  12
+    #endif
+    #if !defined(RAYGUI_LINE_TEXT_PADDING)
+        #define RAYGUI_LINE_TEXT_PADDING  4
+    #endif
 
-            // Check focused and selected item
-            for (int i = 0; i < itemCount; i++)
-            {
-                // Update item rectangle y position for next item
-                if (direction == 0) itemBounds.y += (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
-                else itemBounds.y -= (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
 
-                if (CheckCollisionPointRec(mousePoint, itemBounds))
-                {
-                    itemFocused = i;
-                    if (GUI_BUTTON_RELEASED)
-                    {
-                        itemSelected = i;
-                        result = 1;         // Item selected
-                    }
-                    break;
-                }
-            }
+    RAYGUI_PROFILE_BEGIN("GuiLine");
 
-            itemBounds = bounds;
-        }
-        else
-        {
-            if (CheckCollisionPointRec(mousePoint, bounds))
-            {
-                if (GUI_BUTTON_PRESSED)
-                {
-                    result = 1;
-                    state = STATE_PRESSED;
-                }
-                else state = STATE_FOCUSED;
-            }
-        }
-    }
-    //--------------------------------------------------------------------
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    Color color = GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR));
+    float marginText = RAYGUI_LINE_MARGIN_TEXT*guiScale;
+    float textPadding = RAYGUI_LINE_TEXT_PADDING*guiScale;
 
     // Draw control
     //--------------------------------------------------------------------
-    if (editMode) GuiPanel(boundsOpen, NULL);
-
-    GuiDrawRectangle(bounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER + state*3)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE + state*3)));
-    GuiDrawText(items[itemSelected], GetTextBounds(DROPDOWNBOX, bounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + state*3)));
-
-    if (editMode)
+    if (text == NULL) GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height/2, bounds.width, 1 }, 0, BLANK, color);
+    else
     {
-        // Draw visible items
-        for (int i = 0; i < itemCount; i++)
-        {
-            // Update item rectangle y position for next item
-            if (direction == 0) itemBounds.y += (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
-            else itemBounds.y -= (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
-
-            if (i == itemSelected)
-            {
-                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_PRESSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_PRESSED)));
-                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_PRESSED)));
-            }
-            else if (i == itemFocused)
-            {
-                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_FOCUSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_FOCUSED)));
-                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_FOCUSED)));
-            }
-            else GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_NORMAL)));
-        }
-    }
+        Rectangle textBounds = { 0 };
+        textBounds.width = (float)GuiGetTextWidthCached(id, 0, text) + 2;
+        textBounds.height = bounds.height;
+        textBounds.x = bounds.x + marginText;
+        textBounds.y = bounds.y;
 
-    if (!GuiGetStyle(DROPDOWNBOX, DROPDOWN_ARROW_HIDDEN))
-    {
-        // Draw arrows (using icon if available)
-#if defined(RAYGUI_NO_ICONS)
-        GuiDrawText("v", RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 2, 10, 10 },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
-#else
-        GuiDrawText(direction? GuiIconText(ICON_ARROW_UP_FILL, NULL) : GuiIconText(ICON_ARROW_DOWN_FILL, NULL),
-            RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 6, 10, 10 },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));   // ICON_ARROW_DOWN_FILL
-#endif
+        // Draw line with embedded text label: "--- text --------------"
+        GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height/2, marginText - textPadding, 1 }, 0, BLANK, color);
+        GuiDrawText(text, textBounds, TEXT_ALIGN_LEFT, color);
+        GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + marginText + textBounds.width + textPadding, bounds.y + bounds.height/2, bounds.width - textBounds.width - marginText - textPadding, 1 }, 0, BLANK, color);
     }
     //--------------------------------------------------------------------
 
-    *active = itemSelected;
-
-    if (prevActive != *active) result = RESULT_CHANGED;
-
+    RAYGUI_PROFILE_END("GuiLine");
     return result;
 }
 
-// Text Box control
-// NOTE: Returns true on ENTER pressed (useful for data validation)
-int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
+// Panel control
+int GuiPanel(Rectangle bounds, const char *text)
 {
-    #if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN)
-        #define RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN  20        // Frames to wait for autocursor movement
-    #endif
-    #if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY)
-        #define RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY      1        // Frames delay for autocursor movement
+    #if !defined(RAYGUI_PANEL_BORDER_WIDTH)
+        #define RAYGUI_PANEL_BORDER_WIDTH   1
     #endif
 
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiPanel");
+    GuiPushControlID(id);
+
     int result = RESULT_NONE;
     GuiState state = guiState;
 
-    bool multiline = false;
-    int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);
-
-    Rectangle textBounds = GetTextBounds(TEXTBOX, bounds);
-    int textLength = (text != NULL)? (int)strlen(text) : 0; // Get current text length
-    int thisCursorIndex = textBoxCursorIndex;
-    if (thisCursorIndex > textLength) thisCursorIndex = textLength;
-    int textWidth = GuiGetTextWidth(text) - GuiGetTextWidth(text + thisCursorIndex);
-    int textIndexOffset = 0; // Text index offset to start drawing in the box
+    float statusBarHeight = (float)(int)(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*guiScale + 0.5f);
 
-    // Cursor rectangle
-    // NOTE: Position X value should be updated
-    Rectangle cursor = {
-        textBounds.x + textWidth + GuiGetStyle(DEFAULT, TEXT_SPACING),
-        textBounds.y + textBounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE),
-        2,
-        (float)GuiGetStyle(DEFAULT, TEXT_SIZE)*2
-    };
+    // Text will be drawn as a header bar (if provided)
+    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, statusBarHeight };
+    if ((text != NULL) && (bounds.height < statusBarHeight*2.0f)) bounds.height = statusBarHeight*2.0f;
 
-    if (cursor.height >= bounds.height) cursor.height = bounds.height - GuiGetStyle(TEXTBOX, BORDER_WIDTH)*2;
-    if (cursor.y < (bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH))) cursor.y = bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH);
+#if defined(RAYGUI_HITTEST)
+    GuiCheckHover(GUI_POINTER_POSITION, bounds);    // Register container for hit-testing, occluding controls below
+#endif
 
-    // Mouse cursor rectangle
-    // NOTE: Initialized outside of screen
-    Rectangle mouseCursor = cursor;
-    mouseCursor.x = -1;
-    mouseCursor.width = 1;
+    if (text != NULL)
+    {
+        // Move panel bounds after the header bar
+        bounds.y += statusBarHeight - 1;
+        bounds.height -= statusBarHeight - 1;
+    }
 
-    // Blink-cursor frame counter
-    //if (!autoCursorMode) blinkCursorFrameCounter++;
-    //else blinkCursorFrameCounter = 0;
+    // Draw control
+    //--------------------------------------------------------------------
+    if (text != NULL) result = GuiStatusBar(statusBar, text);  // Draw panel header as status bar
 
-    // Update control
+    GuiDrawRectangle(bounds, (int)(RAYGUI_PANEL_BORDER_WIDTH*guiScale + 0.5f), GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BORDER_COLOR_DISABLED : (int)LINE_COLOR)),
+                     GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? (int)BASE_COLOR_DISABLED : (int)BACKGROUND_COLOR)));
     //--------------------------------------------------------------------
-    // WARNING: Text editing is only supported under certain conditions:
-    if ((state != STATE_DISABLED) &&                // Control not disabled
-        !GuiGetStyle(TEXTBOX, TEXT_READONLY) &&     // TextBox not on read-only mode
-        !guiLocked &&                               // Gui not locked
-        !guiControlExclusiveMode &&                       // No gui slider on dragging
-        (wrapMode == TEXT_WRAP_NONE))               // No wrap mode
-    {
-        Vector2 mousePosition = GUI_POINTER_POSITION;
 
-        if (editMode)
-        {
-            // GLOBAL: Auto-cursor movement logic
-            // NOTE: Keystrokes are handled repeatedly when button is held down for some time
-            if (GUI_KEY_DOWN(KEY_LEFT) || GUI_KEY_DOWN(KEY_RIGHT) ||
-                GUI_KEY_DOWN(KEY_UP) || GUI_KEY_DOWN(KEY_DOWN) ||
-                GUI_KEY_DOWN(KEY_BACKSPACE) || GUI_KEY_DOWN(KEY_DELETE)) autoCursorCounter++;
-            else autoCursorCounter = 0;
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiPanel");
+    return result;
+}
 
-            bool autoCursorShouldTrigger = (autoCursorCounter > RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN) && ((autoCursorCounter % RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY) == 0);
+// Scroll Panel control
+// NOTE: Scroll offsets are truncated to integer pixels, use GuiScrollPanelEx() for large content
+int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector2 *scroll, Rectangle *view)
+{
+    double scrollX = (scroll != NULL)? scroll->x : 0.0;
+    double scrollY = (scroll != NULL)? scroll->y : 0.0;
 
-            state = STATE_PRESSED;
+    int result = GuiScrollPanelEx(bounds, text, content.width, content.height, &scrollX, &scrollY, view);
 
-            if (textBoxCursorIndex > textLength) textBoxCursorIndex = textLength;
+    if (scroll != NULL)
+    {
+        scroll->x = (float)(int)scrollX;
+        scroll->y = (float)(int)scrollY;
+    }
 
-            // If text does not fit in the textbox and current cursor position is out of bounds,
-            // adding an index offset to text for drawing only what requires depending on cursor
-            while (textWidth >= textBounds.width)
-            {
-                int nextCodepointSize = 0;
-                GetCodepointNext(text + textIndexOffset, &nextCodepointSize);
+    return result;
+}
 
-                textIndexOffset += nextCodepointSize;
+// Scroll Panel control, extended version with double precision content size and scroll offsets
+// NOTE: Content beyond float precision (~16M pixels) scrolls exactly, scroll bars map the offset
+// range to a fixed number of steps when it does not fit in RAYGUI_MAX_SCROLLBAR_STEPS
+int GuiScrollPanelEx(Rectangle bounds, const char *text, double contentWidth, double contentHeight, double *scrollX, double *scrollY, Rectangle *view)
+{
+    #define RAYGUI_MIN_SCROLLBAR_WIDTH     40
+    #define RAYGUI_MIN_SCROLLBAR_HEIGHT    40
+    #define RAYGUI_MIN_MOUSE_WHEEL_SPEED   20
 
-                textWidth = GuiGetTextWidth(text + textIndexOffset) - GuiGetTextWidth(text + textBoxCursorIndex);
-            }
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds))    // Control outside clip region, not processed
+    {
+        if (view != NULL) *view = RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, 0, 0 };
+        return 0;
+    }
 
-            int codepoint = GUI_INPUT_KEY; // Get Unicode codepoint
-            if (multiline && GUI_KEY_PRESSED(KEY_ENTER)) codepoint = (int)'\n';
+    RAYGUI_PROFILE_BEGIN("GuiScrollPanelEx");
+    GuiPushControlID(id);
 
-            // Encode codepoint as UTF-8
-            int codepointSize = 0;
-            const char *charEncoded = CodepointToUTF8(codepoint, &codepointSize);
+    int result = RESULT_NONE;
+    GuiState state = guiState;
 
-            // Handle text paste action
-            if (GUI_KEY_PRESSED(KEY_V) && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
-            {
-                const char *pasteText = GetClipboardText();
-                if (pasteText != NULL)
-                {
-                    int pasteLength = 0;
-                    int pasteCodepoint;
-                    int pasteCodepointSize;
+    Rectangle temp = { 0 };
+    if (view == NULL) view = &temp;
 
-                    // Count how many codepoints to copy, stopping at the first unwanted control character
-                    while (true)
-                    {
-                        pasteCodepoint = GetCodepointNext(pasteText + pasteLength, &pasteCodepointSize);
-                        if (textLength + pasteLength + pasteCodepointSize >= textSize) break;
-                        if (!(multiline && (pasteCodepoint == (int)'\n')) && !(pasteCodepoint >= 32)) break;
-                        pasteLength += pasteCodepointSize;
-                    }
+    double scrollPosX = (scrollX != NULL)? *scrollX : 0.0;
+    double scrollPosY = (scrollY != NULL)? *scrollY : 0.0;
 
-                    if (pasteLength > 0)
-                    {
-                        // Move forward data from cursor position
-                        for (int i = textLength + pasteLength; i > textBoxCursorIndex; i--) text[i] = text[i - pasteLength];
+    float statusBarHeight = (float)(int)(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*guiScale + 0.5f);
 
-                        // Paste data in at cursor
-                        for (int i = 0; i < pasteLength; i++) text[textBoxCursorIndex + i] = pasteText[i];
+    // Text will be drawn as a header bar (if provided)
+    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, statusBarHeight };
+    if (bounds.height < statusBarHeight*2.0f) bounds.height = statusBarHeight*2.0f;
 
-                        textBoxCursorIndex += pasteLength;
-                        textLength += pasteLength;
-                        text[textLength] = '\0';
+    if (text != NULL)
+    {
+        // Move panel bounds after the header bar
+        bounds.y += statusBarHeight - 1;
+        bounds.height -= statusBarHeight + 1;
+    }
 
-                        //result = RESULT_CHANGED;
-                    }
-                }
-            }
-            else if (((multiline && (codepoint == (int)'\n')) || (codepoint >= 32)) && ((textLength + codepointSize) < textSize))
-            {
-                // Adding codepoint to text, at current cursor position
+    bool hasHorizontalScrollBar = (contentWidth > bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH))? true : false;
+    bool hasVerticalScrollBar = (contentHeight > bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH))? true : false;
 
-                // Move forward data from cursor position
-                for (int i = (textLength + codepointSize); i > textBoxCursorIndex; i--) text[i] = text[i - codepointSize];
+    // Recheck to account for the other scrollbar being visible
+    if (!hasHorizontalScrollBar) hasHorizontalScrollBar = (hasVerticalScrollBar && (contentWidth > (bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH))))? true : false;
+    if (!hasVerticalScrollBar) hasVerticalScrollBar = (hasHorizontalScrollBar && (contentHeight > (bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH))))? true : false;
 
-                // Add new codepoint in current cursor position
-                for (int i = 0; i < codepointSize; i++) text[textBoxCursorIndex + i] = charEncoded[i];
+    int horizontalScrollBarWidth = hasHorizontalScrollBar? GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) : 0;
+    int verticalScrollBarWidth =  hasVerticalScrollBar? GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) : 0;
+    Rectangle horizontalScrollBar = {
+        (float)((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)bounds.x + verticalScrollBarWidth : (float)bounds.x) + GuiGetStyle(DEFAULT, BORDER_WIDTH),
+        (float)bounds.y + bounds.height - horizontalScrollBarWidth - GuiGetStyle(DEFAULT, BORDER_WIDTH),
+        (float)bounds.width - verticalScrollBarWidth - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH),
+        (float)horizontalScrollBarWidth
+    };
+    Rectangle verticalScrollBar = {
+        (float)((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) : (float)bounds.x + bounds.width - verticalScrollBarWidth - GuiGetStyle(DEFAULT, BORDER_WIDTH)),
+        (float)bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH),
+        (float)verticalScrollBarWidth,
+        (float)bounds.height - horizontalScrollBarWidth - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH)
+    };
 
-                textBoxCursorIndex += codepointSize;
-                textLength += codepointSize;
+    // Make sure scroll bars have a minimum width/height
+    if (horizontalScrollBar.width < RAYGUI_MIN_SCROLLBAR_WIDTH) horizontalScrollBar.width = RAYGUI_MIN_SCROLLBAR_WIDTH;
+    if (verticalScrollBar.height < RAYGUI_MIN_SCROLLBAR_HEIGHT) verticalScrollBar.height = RAYGUI_MIN_SCROLLBAR_HEIGHT;
 
-                // Make sure text last character is EOL
-                text[textLength] = '\0';
+    // Calculate view area (area without the scrollbars)
+    *view = (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)?
+                RAYGUI_CLITERAL(Rectangle){ bounds.x + verticalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth, bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth } :
+                RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth, bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth };
 
-                //result = RESULT_CHANGED;
-            }
+    // Clip view area to the actual content size
+    if (view->width > contentWidth) view->width = (float)contentWidth;
+    if (view->height > contentHeight) view->height = (float)contentHeight;
 
-            // Move cursor to start
-            if ((textLength > 0) && GUI_KEY_PRESSED(KEY_HOME)) textBoxCursorIndex = 0;
+    double horizontalMin = hasHorizontalScrollBar? ((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)-verticalScrollBarWidth : 0) - (float)GuiGetStyle(DEFAULT, BORDER_WIDTH) : (((float)GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)-verticalScrollBarWidth : 0) - (float)GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    double horizontalMax = hasHorizontalScrollBar? contentWidth - bounds.width + (float)verticalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH) - (((float)GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)verticalScrollBarWidth : 0) : (float)-GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    double verticalMin = -(float)GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    double verticalMax = hasVerticalScrollBar? contentHeight - bounds.height + (float)horizontalScrollBarWidth + (float)GuiGetStyle(DEFAULT, BORDER_WIDTH) : (float)-GuiGetStyle(DEFAULT, BORDER_WIDTH);
 
-            // Move cursor to end
-            if ((textLength > textBoxCursorIndex) && GUI_KEY_PRESSED(KEY_END)) textBoxCursorIndex = textLength;
+    // Update control
+    //--------------------------------------------------------------------
+    // NOTE: Scrolling is not blocked by panel content controls, pointer is checked directly
+#if defined(RAYGUI_HITTEST)
+    GuiCheckHover(GUI_POINTER_POSITION, bounds);    // Register container for hit-testing, occluding controls below
+#endif
 
-            // Delete related codepoints from text, after current cursor position
-            if ((textLength > textBoxCursorIndex) && GUI_KEY_PRESSED(KEY_DELETE) && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
-            {
-                int offset = textBoxCursorIndex;
-                int accCodepointSize = 0;
-                int nextCodepointSize;
-                int nextCodepoint;
+    if ((state != STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
 
-                // Check characters of the same type to delete (either ASCII punctuation or anything non-whitespace)
-                // Not using isalnum() since it only works on ASCII characters
-                nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
-                bool puctuation = ispunct(nextCodepoint & 0xff);
-                while (offset < textLength)
-                {
-                    if ((puctuation && !ispunct(nextCodepoint & 0xff)) ||
-                        (!puctuation && (isspace(nextCodepoint & 0xff) || ispunct(nextCodepoint & 0xff)))) break;
+        // Check button state
+        if (CheckCollisionPointRec(mousePoint, bounds))
+        {
+            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
 
-                    offset += nextCodepointSize;
-                    accCodepointSize += nextCodepointSize;
-                    nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
-                }
+#if defined(SUPPORT_SCROLLBAR_KEY_INPUT)
+            if (hasHorizontalScrollBar)
+            {
+                if (GUI_KEY_DOWN(KEY_RIGHT)) scrollPosX -= GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                if (GUI_KEY_DOWN(KEY_LEFT)) scrollPosX += GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+            }
 
-                // Check whitespace to delete (ASCII only)
-                while (offset < textLength)
-                {
-                    if (!isspace(nextCodepoint & 0xff)) break;
+            if (hasVerticalScrollBar)
+            {
+                if (GUI_KEY_DOWN(KEY_DOWN)) scrollPosY -= GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                if (GUI_KEY_DOWN(KEY_UP)) scrollPosY += GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+            }
+#endif
+            float scrollDelta = GUI_SCROLL_DELTA;
 
-                    offset += nextCodepointSize;
-                    accCodepointSize += nextCodepointSize;
-                    nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
-                }
+            // Set scrolling speed with mouse wheel based on ratio between bounds and content
+            double scrollSpeedX = contentWidth/bounds.width;
+            double scrollSpeedY = contentHeight/bounds.height;
+            if (scrollSpeedX < RAYGUI_MIN_MOUSE_WHEEL_SPEED) scrollSpeedX = RAYGUI_MIN_MOUSE_WHEEL_SPEED;
+            if (scrollSpeedY < RAYGUI_MIN_MOUSE_WHEEL_SPEED) scrollSpeedY = RAYGUI_MIN_MOUSE_WHEEL_SPEED;
 
-                // Move text after cursor forward (including final null terminator)
-                for (int i = offset; i <= textLength; i++) text[i - accCodepointSize] = text[i];
+            // Horizontal and vertical scrolling with mouse wheel
+            if (hasHorizontalScrollBar && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_LEFT_SHIFT))) scrollPosX += scrollDelta*scrollSpeedX;
+            else scrollPosY += scrollDelta*scrollSpeedY; // Vertical scroll
+        }
+    }
 
-                textLength -= accCodepointSize;
+    // Normalize scroll values
+    if (scrollPosX > -horizontalMin) scrollPosX = -horizontalMin;
+    if (scrollPosX < -horizontalMax) scrollPosX = -horizontalMax;
+    if (scrollPosY > -verticalMin) scrollPosY = -verticalMin;
+    if (scrollPosY < -verticalMax) scrollPosY = -verticalMax;
+    //--------------------------------------------------------------------
 
-                //result = RESULT_CHANGED;
-            }
-            else if ((textLength > textBoxCursorIndex) && (GUI_KEY_PRESSED(KEY_DELETE) ||
-                (GUI_KEY_DOWN(KEY_DELETE) && autoCursorShouldTrigger)))
-            {
-                // Delete single codepoint from text, after current cursor position
+    // Draw control
+    //--------------------------------------------------------------------
+    if (text != NULL) result = GuiStatusBar(statusBar, text);  // Draw panel header as status bar
 
-                int nextCodepointSize = 0;
-                GetCodepointNext(text + textBoxCursorIndex, &nextCodepointSize);
+    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));        // Draw background
 
-                // Move text after cursor forward (including final null terminator)
-                for (int i = textBoxCursorIndex + nextCodepointSize; i <= textLength; i++) text[i - nextCodepointSize] = text[i];
+    // Save size of the scrollbar slider
+    const int slider = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
 
-                textLength -= nextCodepointSize;
+    // Draw horizontal scrollbar if visible
+    if (hasHorizontalScrollBar)
+    {
+        // Change scrollbar slider size to show the diff in size between the content width and the widget width
+        GuiSetStyleTemp(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)/contentWidth)*((int)bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)));
+        scrollPosX = -GuiScrollBarRange(horizontalScrollBar, -scrollPosX, horizontalMin, horizontalMax);
+    }
+    else scrollPosX = 0.0;
 
-                //result = RESULT_CHANGED;
-            }
+    // Draw vertical scrollbar if visible
+    if (hasVerticalScrollBar)
+    {
+        // Change scrollbar slider size to show the diff in size between the content height and the widget height
+        GuiSetStyleTemp(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)/contentHeight)*((int)bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)));
+        scrollPosY = -GuiScrollBarRange(verticalScrollBar, -scrollPosY, verticalMin, verticalMax);
+    }
+    else scrollPosY = 0.0;
 
-            // Delete related codepoints from text, before current cursor position
-            if ((textBoxCursorIndex > 0) && GUI_KEY_PRESSED(KEY_BACKSPACE) &&
-                (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
-            {
-                int offset = textBoxCursorIndex;
-                int accCodepointSize = 0;
-                int prevCodepointSize = 0;
-                int prevCodepoint = 0;
+    // Draw detail corner rectangle if both scroll bars are visible
+    if (hasHorizontalScrollBar && hasVerticalScrollBar)
+    {
+        Rectangle corner = { (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) + 2) : (horizontalScrollBar.x + horizontalScrollBar.width + 2), verticalScrollBar.y + verticalScrollBar.height + 2, (float)horizontalScrollBarWidth - 4, (float)verticalScrollBarWidth - 4 };
+        GuiDrawRectangle(corner, 0, BLANK, GetColor(GuiGetStyle(LISTVIEW, TEXT + (state*3))));
+    }
 
-                // Check whitespace to delete (ASCII only)
-                while (offset > 0)
-                {
-                    prevCodepoint = GetCodepointPrevious(text + offset, &prevCodepointSize);
-                    if (!isspace(prevCodepoint & 0xff)) break;
+    // Draw scrollbar lines depending on current state
+    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + (state*3))), BLANK);
 
-                    offset -= prevCodepointSize;
-                    accCodepointSize += prevCodepointSize;
-                }
+    // Set scrollbar slider size back to the way it was before
+    GuiSetStyleTemp(SCROLLBAR, SCROLL_SLIDER_SIZE, slider);
+    //--------------------------------------------------------------------
 
-                // Check characters of the same type to delete (either ASCII punctuation or anything non-whitespace)
-                // Not using isalnum() since it only works on ASCII characters
-                bool puctuation = ispunct(prevCodepoint & 0xff);
-                while (offset > 0)
-                {
-                    prevCodepoint = GetCodepointPrevious(text + offset, &prevCodepointSize);
-                    if ((puctuation && !ispunct(prevCodepoint & 0xff)) ||
-                        (!puctuation && (isspace(prevCodepoint & 0xff) || ispunct(prevCodepoint & 0xff)))) break;
+    if (scrollX != NULL) *scrollX = scrollPosX;
+    if (scrollY != NULL) *scrollY = scrollPosY;
 
-                    offset -= prevCodepointSize;
-                    accCodepointSize += prevCodepointSize;
-                }
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiScrollPanelEx");
+    return result;
+}
 
-                // Move text after cursor forward (including final null terminator)
-                for (int i = textBoxCursorIndex; i <= textLength; i++) text[i - accCodepointSize] = text[i];
+// Get visible items range for a list of fixed height items inside a scroll panel view
+// NOTE: scroll is the vertical scroll offset (<= 0) returned by GuiScrollPanelEx(),
+// returns number of visible items, 0 if none (first and last set to -1)
+int GuiGetVisibleRange(double scroll, float viewHeight, float itemHeight, int itemCount, int *first, int *last)
+{
+    int firstIndex = -1;
+    int lastIndex = -1;
 
-                textLength -= accCodepointSize;
-                textBoxCursorIndex -= accCodepointSize;
+    if ((itemCount > 0) && (itemHeight > 0.0f) && (viewHeight > 0.0f))
+    {
+        double top = -scroll;
+        double bottom = top + viewHeight;
 
-                //result = RESULT_CHANGED;
-            }
-            else if ((textBoxCursorIndex > 0) && (GUI_KEY_PRESSED(KEY_BACKSPACE) || (GUI_KEY_DOWN(KEY_BACKSPACE) && autoCursorShouldTrigger)))
-            {
-                // Delete single codepoint from text, before current cursor position
+        double firstItem = floor(top/itemHeight);
+        double lastItem = ceil(bottom/itemHeight) - 1.0;
 
-                int prevCodepointSize = 0;
+        if (firstItem < 0.0) firstItem = 0.0;
+        if (lastItem > (double)(itemCount - 1)) lastItem = (double)(itemCount - 1);
 
-                GetCodepointPrevious(text + textBoxCursorIndex, &prevCodepointSize);
+        if (firstItem <= lastItem)
+        {
+            firstIndex = (int)firstItem;
+            lastIndex = (int)lastItem;
+        }
+    }
 
-                // Move text after cursor forward (including final null terminator)
-                for (int i = textBoxCursorIndex; i <= textLength; i++) text[i - prevCodepointSize] = text[i];
+    if (first != NULL) *first = firstIndex;
+    if (last != NULL) *last = lastIndex;
 
-                textLength -= prevCodepointSize;
-                textBoxCursorIndex -= prevCodepointSize;
+    return (firstIndex >= 0)? (lastIndex - firstIndex + 1) : 0;
+}
 
-                //result = RESULT_CHANGED;
-            }
+// Get visible items range for a list of variable height items inside a scroll panel view
+// NOTE: offsets[] is the prefix sum of items heights, itemCount + 1 entries: offsets[i] is
+// item i top position and offsets[itemCount] the total content height, found by binary search
+int GuiGetVisibleRangeEx(double scroll, float viewHeight, const double *offsets, int itemCount, int *first, int *last)
+{
+    int firstIndex = -1;
+    int lastIndex = -1;
 
-            // Move cursor position with keys
-            if ((textBoxCursorIndex > 0) && GUI_KEY_PRESSED(KEY_LEFT) && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
-            {
-                int offset = textBoxCursorIndex;
-                //int accCodepointSize = 0;
-                int prevCodepointSize = 0;
-                int prevCodepoint = 0;
+    if ((offsets != NULL) && (itemCount > 0) && (viewHeight > 0.0f))
+    {
+        double top = -scroll;
+        double bottom = top + viewHeight;
 
-                // Check whitespace to skip (ASCII only)
-                while (offset > 0)
-                {
-                    prevCodepoint = GetCodepointPrevious(text + offset, &prevCodepointSize);
-                    if (!isspace(prevCodepoint & 0xff)) break;
+        // First item with bottom edge below view top
+        int low = 0;
+        int high = itemCount;
+        while (low < high)
+        {
+            int mid = low + (high - low)/2;
+            if (offsets[mid + 1] <= top) low = mid + 1;
+            else high = mid;
+        }
+        int firstItem = low;
 
-                    offset -= prevCodepointSize;
-                    //accCodepointSize += prevCodepointSize;
-                }
+        // Last item with top edge above view bottom
+        low = firstItem;
+        high = itemCount;
+        while (low < high)
+        {
+            int mid = low + (high - low)/2;
+            if (offsets[mid] < bottom) low = mid + 1;
+            else high = mid;
+        }
+        int lastItem = low - 1;
 
-                // Check characters of the same type to skip (either ASCII punctuation or anything non-whitespace)
-                // Not using isalnum() since it only works on ASCII characters
-                bool puctuation = ispunct(prevCodepoint & 0xff);
-                while (offset > 0)
-                {
-                    prevCodepoint = GetCodepointPrevious(text + offset, &prevCodepointSize);
-                    if ((puctuation && !ispunct(prevCodepoint & 0xff)) || (!puctuation && (isspace(prevCodepoint & 0xff) || ispunct(prevCodepoint & 0xff)))) break;
+        if ((firstItem < itemCount) && (firstItem <= lastItem))
+        {
+            firstIndex = firstItem;
+            lastIndex = lastItem;
+        }
+    }
 
-                    offset -= prevCodepointSize;
-                    //accCodepointSize += prevCodepointSize;
-                }
+    if (first != NULL) *first = firstIndex;
+    if (last != NULL) *last = lastIndex;
 
-                textBoxCursorIndex = offset;
-            }
-            else if ((textBoxCursorIndex > 0) && (GUI_KEY_PRESSED(KEY_LEFT) || (GUI_KEY_DOWN(KEY_LEFT) && autoCursorShouldTrigger)))
-            {
-                int prevCodepointSize = 0;
-                GetCodepointPrevious(text + textBoxCursorIndex, &prevCodepointSize);
+    return (firstIndex >= 0)? (lastIndex - firstIndex + 1) : 0;
+}
 
-                textBoxCursorIndex -= prevCodepointSize;
-            }
-            else if ((textLength > textBoxCursorIndex) && GUI_KEY_PRESSED(KEY_RIGHT) && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
-            {
-                int offset = textBoxCursorIndex;
-                //int accCodepointSize = 0;
-                int nextCodepointSize;
-                int nextCodepoint;
+// Label control
+int GuiLabel(Rectangle bounds, const char *text)
+{
+    GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
 
-                // Check characters of the same type to skip (either ASCII punctuation or anything non-whitespace)
-                // Not using isalnum() since it only works on ASCII characters
-                nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
-                bool puctuation = ispunct(nextCodepoint & 0xff);
-                while (offset < textLength)
-                {
-                    if ((puctuation && !ispunct(nextCodepoint & 0xff)) || (!puctuation && (isspace(nextCodepoint & 0xff) || ispunct(nextCodepoint & 0xff)))) break;
+    RAYGUI_PROFILE_BEGIN("GuiLabel");
 
-                    offset += nextCodepointSize;
-                    //accCodepointSize += nextCodepointSize;
-                    nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
-                }
+    int result = RESULT_NONE;
+    GuiState state = guiState;
 
-                // Check whitespace to skip (ASCII only)
-                while (offset < textLength)
-                {
-                    if (!isspace(nextCodepoint & 0xff)) break;
+    // Update control
+    //--------------------------------------------------------------------
+    //...
+    //--------------------------------------------------------------------
 
-                    offset += nextCodepointSize;
-                    //accCodepointSize += nextCodepointSize;
-                    nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
-                }
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    //--------------------------------------------------------------------
 
-                textBoxCursorIndex = offset;
-            }
-            else if ((textLength > textBoxCursorIndex) && (GUI_KEY_PRESSED(KEY_RIGHT) || (GUI_KEY_DOWN(KEY_RIGHT) && autoCursorShouldTrigger)))
-            {
-                int nextCodepointSize = 0;
-                GetCodepointNext(text + textBoxCursorIndex, &nextCodepointSize);
+    RAYGUI_PROFILE_END("GuiLabel");
+    return result;
+}
 
-                textBoxCursorIndex += nextCodepointSize;
-            }
+// Button control, returns true when clicked
+int GuiButton(Rectangle bounds, const char *text)
+{
+    GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
 
-            // Move cursor position with mouse
-            if (CheckCollisionPointRec(mousePosition, textBounds))
-            {
-                float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)guiFont.baseSize;
-                int codepointIndex = 0;
-                float glyphWidth = 0.0f;
-                float widthToMouseX = 0;
-                int mouseCursorIndex = 0;
+    RAYGUI_PROFILE_BEGIN("GuiButton");
 
-                for (int i = textIndexOffset; i < textLength; i += codepointSize)
-                {
-                    codepoint = GetCodepointNext(&text[i], &codepointSize);
-                    codepointIndex = GetGlyphIndex(guiFont, codepoint);
-
-                    if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                    else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
-
-                    if (mousePosition.x <= (textBounds.x + (widthToMouseX + glyphWidth/2)))
-                    {
-                        mouseCursor.x = textBounds.x + widthToMouseX;
-                        mouseCursorIndex = i;
-                        break;
-                    }
-
-                    widthToMouseX += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-                }
-
-                // Check if mouse cursor is at the last position
-                int textEndWidth = GuiGetTextWidth(text + textIndexOffset);
-                if (GUI_POINTER_POSITION.x >= (textBounds.x + textEndWidth - glyphWidth/2))
-                {
-                    mouseCursor.x = textBounds.x + textEndWidth;
-                    mouseCursorIndex = textLength;
-                }
-
-                // Place cursor at required index on mouse click
-                if ((mouseCursor.x >= 0) && GUI_BUTTON_PRESSED)
-                {
-                    cursor.x = mouseCursor.x;
-                    textBoxCursorIndex = mouseCursorIndex;
-                }
-            }
-            else mouseCursor.x = -1;
-
-            // Recalculate cursor position.y depending on textBoxCursorIndex
-            cursor.x = bounds.x + GuiGetStyle(TEXTBOX, TEXT_PADDING) + GuiGetTextWidth(text + textIndexOffset) - GuiGetTextWidth(text + textBoxCursorIndex) + GuiGetStyle(DEFAULT, TEXT_SPACING);
-            //if (multiline) cursor.y = GetTextLines()
+    int result = RESULT_NONE;
+    GuiState state = guiState;
 
-            // Finish text editing on ENTER or mouse click outside bounds
-            if ((!multiline && GUI_KEY_PRESSED(KEY_ENTER)) ||
-                (!CheckCollisionPointRec(mousePosition, bounds) && GUI_BUTTON_PRESSED))
-            {
-                textBoxCursorIndex = 0;     // GLOBAL: Reset the shared cursor index
-                autoCursorCounter = 0;      // GLOBAL: Reset counter for repeated keystrokes
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
 
-                //*editMode = false;
-                result = RESULT_PRESSED;
-            }
-        }
-        else
+        // Check button state
+        if (GuiCheckHover(mousePoint, bounds))
         {
-            if (CheckCollisionPointRec(mousePosition, bounds))
-            {
-                state = STATE_FOCUSED;
-
-                if (GUI_BUTTON_PRESSED)
-                {
-                    textBoxCursorIndex = textLength;   // GLOBAL: Place cursor index to the end of current text
-                    autoCursorCounter = 0;             // GLOBAL: Reset counter for repeated keystrokes
+            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
 
-                    //*editMode = true;
-                    result = RESULT_PRESSED;
-                }
-            }
+            if (GUI_BUTTON_RELEASED) result = RESULT_PRESSED;
         }
     }
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    if (state == STATE_PRESSED)
-    {
-        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_PRESSED)));
-    }
-    else if (state == STATE_DISABLED)
-    {
-        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_DISABLED)));
-    }
-    else GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), BLANK);
-
-    // Draw text considering index offset if required
-    // NOTE: Text index offset depends on cursor position
-    GuiDrawText(text + textIndexOffset, textBounds, GuiGetStyle(TEXTBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TEXTBOX, TEXT + (state*3))));
-
-    // Draw cursor
-    if (editMode && !GuiGetStyle(TEXTBOX, TEXT_READONLY))
-    {
-        //if (autoCursorMode || ((blinkCursorFrameCounter/40)%2 == 0))
-        GuiDrawRectangle(cursor, 0, BLANK, GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)));
+    GuiDrawRectangle(bounds, GuiGetStyle(BUTTON, BORDER_WIDTH), GetColor(GuiGetStyle(BUTTON, BORDER + (state*3))), GetColor(GuiGetStyle(BUTTON, BASE + (state*3))));
+    GuiDrawText(text, GetTextBounds(BUTTON, bounds), GuiGetStyle(BUTTON, TEXT_ALIGNMENT), GetColor(GuiGetStyle(BUTTON, TEXT + (state*3))));
 
-        // Draw mouse position cursor (if required)
-        if (mouseCursor.x >= 0) GuiDrawRectangle(mouseCursor, 0, BLANK, GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)));
-    }
-    else if (state == STATE_FOCUSED) GuiTooltip(bounds);
-    //--------------------------------------------------------------------
+    if (state == STATE_FOCUSED) GuiTooltip(bounds);
+    //------------------------------------------------------------------
 
+    RAYGUI_PROFILE_END("GuiButton");
     return result;
 }
 
-/*
-// Text Box control with multiple lines and word-wrap
-// NOTE: This text-box is readonly, no editing supported by default
-bool GuiTextBoxMulti(Rectangle bounds, char *text, int textSize, bool editMode)
+// Label button control
+int GuiLabelButton(Rectangle bounds, const char *text)
 {
-    bool pressed = false;
-
-    GuiSetStyle(TEXTBOX, TEXT_READONLY, 1);
-    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_WORD);   // WARNING: If wrap mode enabled, text editing is not supported
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_TOP);
-
-    // TODO: Implement methods to calculate cursor position properly
-    pressed = GuiTextBox(bounds, text, textSize, editMode);
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
 
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);
-    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_NONE);
-    GuiSetStyle(TEXTBOX, TEXT_READONLY, 0);
-
-    return pressed;
-}
-*/
+    RAYGUI_PROFILE_BEGIN("GuiLabelButton");
 
-// Spinner control, returns selected value
-int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
-{
-    int result = 1;
+    int result = RESULT_NONE;
     GuiState state = guiState;
 
-    int tempValue = *value;
-
-    Rectangle valueBoxBounds = {
-        bounds.x + GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH) + GuiGetStyle(VALUEBOX, SPINNER_BUTTON_SPACING),
-        bounds.y,
-        bounds.width - 2*(GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH) + GuiGetStyle(VALUEBOX, SPINNER_BUTTON_SPACING)), bounds.height };
-    Rectangle leftButtonBound = { (float)bounds.x, (float)bounds.y, (float)GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH), (float)bounds.height };
-    Rectangle rightButtonBound = { (float)bounds.x + bounds.width - GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH), (float)bounds.y,
-        (float)GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH), (float)bounds.height };
-
-    Rectangle textBounds = { 0 };
-    if (text != NULL)
-    {
-        textBounds.width = (float)GuiGetTextWidth(text) + 2;
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + bounds.width + GuiGetStyle(VALUEBOX, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
-        if (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(VALUEBOX, TEXT_PADDING);
-    }
+    // NOTE: Force bounds.width to be all text
+    float textWidth = (float)GuiGetTextWidthCached(id, 0, text);
+    if ((bounds.width - 2*GuiGetStyle(LABEL, BORDER_WIDTH) - 2*GuiGetStyle(LABEL, TEXT_PADDING)) < textWidth) bounds.width = textWidth + 2*GuiGetStyle(LABEL, BORDER_WIDTH) + 2*GuiGetStyle(LABEL, TEXT_PADDING) + 2;
 
     // Update control
     //--------------------------------------------------------------------
@@ -3086,218 +4346,303 @@ int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int
     {
         Vector2 mousePoint = GUI_POINTER_POSITION;
 
-        // Check spinner state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        // Check checkbox state
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
-        }
-    }
-
-#if defined(RAYGUI_NO_ICONS)
-    if (GuiButton(leftButtonBound, "<")) tempValue--;
-    if (GuiButton(rightButtonBound, ">")) tempValue++;
-#else
-    if (GuiButton(leftButtonBound, GuiIconText(ICON_ARROW_LEFT_FILL, NULL))) tempValue--;
-    if (GuiButton(rightButtonBound, GuiIconText(ICON_ARROW_RIGHT_FILL, NULL))) tempValue++;
-#endif
 
-    if (!editMode)
-    {
-        if (tempValue < minValue) tempValue = minValue;
-        if (tempValue > maxValue) tempValue = maxValue;
+            if (GUI_BUTTON_RELEASED) result = RESULT_PRESSED;
+        }
     }
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    result = GuiValueBox(valueBoxBounds, NULL, &tempValue, minValue, maxValue, editMode);
-
-    // Draw value selector custom buttons
-    // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, GuiGetStyle(VALUEBOX, BORDER_WIDTH));
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
-
-    // Draw text label if provided
-    GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
     //--------------------------------------------------------------------
 
-    //if (tempValue != *value) result = RESULT_CHANGED; // WARNING: Stops editing
-
-    *value = tempValue;
-
+    RAYGUI_PROFILE_END("GuiLabelButton");
     return result;
 }
 
-// Value Box control, updates input text with numbers
-int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
+// Toggle Button control
+int GuiToggle(Rectangle bounds, const char *text, bool *active)
 {
-    #if !defined(RAYGUI_VALUEBOX_MAX_CHARS)
-        #define RAYGUI_VALUEBOX_MAX_CHARS  32
-    #endif
+    GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiToggle");
 
     int result = RESULT_NONE;
     GuiState state = guiState;
 
-    //int prevValue = *value;
-    char textValue[RAYGUI_VALUEBOX_MAX_CHARS + 1] = { 0 };
-    snprintf(textValue, RAYGUI_VALUEBOX_MAX_CHARS + 1, "%i", *value);
-
-    Rectangle textBounds = { 0 };
-    if (text != NULL)
-    {
-        textBounds.width = (float)GuiGetTextWidth(text) + 2;
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + bounds.width + GuiGetStyle(VALUEBOX, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
-        if (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(VALUEBOX, TEXT_PADDING);
-    }
+    bool temp = false;
+    if (active == NULL) active = &temp;
 
     // Update control
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
         Vector2 mousePoint = GUI_POINTER_POSITION;
-        bool valueHasChanged = false;
 
-        if (editMode)
+        // Check toggle button state
+        if (GuiCheckHover(mousePoint, bounds))
         {
-            state = STATE_PRESSED;
+            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
+            else if (GUI_BUTTON_RELEASED)
+            {
+                state = STATE_NORMAL;
+                *active = !(*active);
 
-            int keyCount = (int)strlen(textValue);
+                result = RESULT_CHANGED;
+            }
+            else state = STATE_FOCUSED;
+        }
+    }
+    //--------------------------------------------------------------------
 
-            // Add or remove minus symbol
-            if (GUI_KEY_PRESSED(KEY_MINUS))
-            {
-                if (textValue[0] == '-')
-                {
-                    for (int i = 0 ; i < keyCount; i++) textValue[i] = textValue[i + 1];
+    // Draw control
+    //--------------------------------------------------------------------
+    if (state == STATE_NORMAL)
+    {
+        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, ((*active)? BORDER_COLOR_PRESSED : (BORDER + state*3)))), GetColor(GuiGetStyle(TOGGLE, ((*active)? BASE_COLOR_PRESSED : (BASE + state*3)))));
+        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, ((*active)? TEXT_COLOR_PRESSED : (TEXT + state*3)))));
+    }
+    else
+    {
+        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + state*3)), GetColor(GuiGetStyle(TOGGLE, BASE + state*3)));
+        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, TEXT + state*3)));
+    }
 
-                    keyCount--;
-                    valueHasChanged = true;
-                }
-                else if (keyCount < RAYGUI_VALUEBOX_MAX_CHARS)
-                {
-                    if (keyCount == 0)
-                    {
-                        textValue[0] = '0';
-                        textValue[1] = '\0';
-                        keyCount++;
-                    }
+    if (state == STATE_FOCUSED) GuiTooltip(bounds);
+    //--------------------------------------------------------------------
 
-                    for (int i = keyCount ; i > -1; i--) textValue[i + 1] = textValue[i];
+    RAYGUI_PROFILE_END("GuiToggle");
+    return result;
+}
 
-                    textValue[0] = '-';
-                    keyCount++;
-                    valueHasChanged = true;
-                }
-            }
+// Toggle Group control
+int GuiToggleGroup(Rectangle bounds, const char *text, int *active)
+{
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds))
+    {
+        // First item outside clip region, check the full group extent
+        // NOTE: When '\n' found move vertically next toggle, when ';' found move horizontally
+        int padding = GuiGetStyle(TOGGLE, GROUP_PADDING);
+        int rows = 1;
+        int cols = 1;
 
-            // Add new digit to text value
-            if ((keyCount >= 0) && (keyCount < RAYGUI_VALUEBOX_MAX_CHARS) && (GuiGetTextWidth(textValue) < bounds.width))
-            {
-                int key = GUI_INPUT_KEY;
+        for (int c = 0, col = 1; (text != NULL) && (text[c] != '\0'); c++)
+        {
+            if (text[c] == '\n') { rows++; col = 1; }
+            else if (text[c] == ';') { col++; if (col > cols) cols = col; }
+        }
 
-                // Only allow keys in range [48..57]
-                if ((key >= 48) && (key <= 57))
-                {
-                    textValue[keyCount] = (char)key;
-                    keyCount++;
-                    valueHasChanged = true;
-                }
-            }
+        Rectangle groupBounds = bounds;
+        if (!GuiGetStyle(TOGGLE, GROUP_WIDTH_FULL)) groupBounds.width = cols*(bounds.width + padding) - padding;
+        groupBounds.height = rows*(bounds.height + padding) - padding;
 
-            // Delete text
-            if ((keyCount > 0) && GUI_KEY_PRESSED(KEY_BACKSPACE))
-            {
-                keyCount--;
-                textValue[keyCount] = '\0';
-                valueHasChanged = true;
-            }
+        if (GuiIsCulled(groupBounds)) return 0;    // Control outside clip region, not processed
+    }
 
-            if (valueHasChanged) *value = TextToInteger(textValue);
+    RAYGUI_PROFILE_BEGIN("GuiToggleGroup");
+    GuiPushControlID(id);
 
-            // NOTE: Values are not clamped until user input finishes
-            //if (*value > maxValue) *value = maxValue;
-            //else if (*value < minValue) *value = minValue;
+    int result = RESULT_NONE;
 
-            if ((GUI_KEY_PRESSED(KEY_ENTER) || GUI_KEY_PRESSED(KEY_KP_ENTER)) || (!CheckCollisionPointRec(mousePoint, bounds) && GUI_BUTTON_PRESSED))
-            {
-                if (*value > maxValue) *value = maxValue;
-                else if (*value < minValue) *value = minValue;
+    // One toggle group item text
+    char *itemText = guiContext->toggleGroupItemText;
+    memset(itemText, 0, RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE);
+    RAYGUI_STATS_ADD(bufferBytes, RAYGUI_TOGGLEGROUP_MAX_ITEM_TEXT_SIZE);
 
-                result = RESULT_PRESSED;
-            }
+    int temp = 0;
+    int prevActive = (active == NULL)? 0 : *active;
+    if (active == NULL) active = &temp;
+
+    bool toggle = false;    // Required for individual toggles
+
+    const char *textPtr = text;
+    bool itemReady = false;
+    float initBoundsX = bounds.x;
+    float initBoundsY = bounds.y;
+
+    if (GuiGetStyle(TOGGLE, GROUP_WIDTH_FULL))
+    {
+        // Calculate item width considring all horizontal items
+        // NOTE: bounds.height still considers individual items height
+        int itemCount = 1;
+        for (int c = 0; textPtr[c] != '\0'; c++) { if (textPtr[c] == ';') itemCount++; }
+        bounds.width /= itemCount;
+    }
+
+    // Text parsing needed to consider potential row and col entries (vertical/horizontal layout)
+    // when '\n' found move vertically next toggle, when ';' found move horizontally
+    for (int c = 0, k = 0, itemIndex = 0, row = 0, col = 0, exit = 0; exit == 0; c++)
+    {
+        // Process text to get items one by one
+        // NOTE: Setting columns and rows index properly
+        if (textPtr[c] == '\n')
+        {
+            row++;
+            col = 0;
+            itemReady = true;
+        }
+        else if (textPtr[c] == ';')
+        {
+            col++;
+            itemReady = true;
+        }
+        else if (textPtr[c] == '\0')
+        {
+            itemReady = true;
+            exit = 1;
         }
         else
         {
-            if (*value > maxValue) *value = maxValue;
-            else if (*value < minValue) *value = minValue;
+            itemText[k] = textPtr[c];
+            k++;
+        }
 
-            if (CheckCollisionPointRec(mousePoint, bounds))
+        if (itemReady)
+        {
+            // When a next item is ready, draw its toggle
+            if (itemIndex == (*active))
             {
-                state = STATE_FOCUSED;
+                toggle = true;
+                GuiToggle(bounds, itemText, &toggle);
+            }
+            else
+            {
+                toggle = false;
+                GuiToggle(bounds, itemText, &toggle);
+                if (toggle) *active = itemIndex;
+            }
 
-                if (GUI_BUTTON_PRESSED) result = RESULT_PRESSED;
+            // Calculate next item position
+            bounds.x = initBoundsX + col*(bounds.width + GuiGetStyle(TOGGLE, GROUP_PADDING));
+            bounds.y = initBoundsY + row*(bounds.height + GuiGetStyle(TOGGLE, GROUP_PADDING));
+
+            itemIndex++;
+            itemReady = false;
+            memset(itemText, 0, k + 1);
+            RAYGUI_STATS_ADD(bufferBytes, 2*k + 1);     // Item copy and clear
+            k = 0;
+        }
+    }
+
+    if (prevActive != *active) result = RESULT_CHANGED;
+
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiToggleGroup");
+    return result;
+}
+
+// Toggle Slider control extended
+int GuiToggleSlider(Rectangle bounds, const char *text, int *active)
+{
+    GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiToggleSlider");
+
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    int temp = 0;
+    int prevActive = (active == NULL)? 0 : *active;
+    if (active == NULL) active = &temp;
+
+    // Get substrings items from text (items pointers)
+    int itemCount = 0;
+    char **items = NULL;
+
+    if (text != NULL) items = GuiTextSplit(text, ';', &itemCount);
+
+    Rectangle slider = {
+        0,      // Calculated later depending on the active toggle
+        bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH) + GuiGetStyle(SLIDER, SLIDER_PADDING),
+        (bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - (itemCount + 1)*GuiGetStyle(SLIDER, SLIDER_PADDING))/itemCount,
+        bounds.height - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - 2*GuiGetStyle(SLIDER, SLIDER_PADDING) };
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
+
+        if (GuiCheckHover(mousePoint, bounds))
+        {
+            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
+            else if (GUI_BUTTON_RELEASED)
+            {
+                state = STATE_PRESSED;
+                (*active)++;
+                result = 1;
             }
+            else state = STATE_FOCUSED;
         }
+
+        if ((*active) && (state != STATE_FOCUSED)) state = STATE_PRESSED;
     }
 
-    //if (prevValue != *value) result = RESULT_CHANGED;
+    if (*active >= itemCount) *active = 0;
+    slider.x = bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH) + (*active + 1)*GuiGetStyle(SLIDER, SLIDER_PADDING) + (*active)*slider.width;
+
+    if (prevActive != *active) result = RESULT_CHANGED;
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    Color baseColor = BLANK;
-    if (state == STATE_PRESSED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_PRESSED));
-    else if (state == STATE_DISABLED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_DISABLED));
+    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + (state*3))),
+        GetColor(GuiGetStyle(TOGGLE, BASE_COLOR_NORMAL)));
 
-    GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
-    GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(VALUEBOX, TEXT + (state*3))));
+    // Draw internal slider
+    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
+    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_FOCUSED)));
+    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
 
-    // Draw cursor rectangle
-    if (editMode)
+    // Draw text in slider
+    if (text != NULL)
     {
-        // NOTE: ValueBox internal text is always centered
-        Rectangle cursor = { bounds.x + GuiGetTextWidth(textValue)/2 + bounds.width/2 + 1,
-            bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH) + 2,
-            2, bounds.height - GuiGetStyle(TEXTBOX, BORDER_WIDTH)*2 - 4 };
-        if (cursor.height > bounds.height) cursor.height = bounds.height - GuiGetStyle(TEXTBOX, BORDER_WIDTH)*2;
-        GuiDrawRectangle(cursor, 0, BLANK, GetColor(GuiGetStyle(VALUEBOX, BORDER_COLOR_PRESSED)));
-    }
+        Rectangle textBounds = { 0 };
+        textBounds.width = (float)GuiGetTextWidth(text);
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = slider.x + slider.width/2 - textBounds.width/2;
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-    // Draw text label if provided
-    GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+        GuiDrawText(items[*active], textBounds, GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(TOGGLE, TEXT + (state*3))), guiAlpha));
+    }
     //--------------------------------------------------------------------
 
+    RAYGUI_PROFILE_END("GuiToggleSlider");
     return result;
 }
 
-// Floating point Value Box control, updates input val_str with numbers
-int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float *value, bool editMode)
+// Check Box control, returns 1 when state changed
+int GuiCheckBox(Rectangle bounds, const char *text, bool *checked)
 {
-    #if !defined(RAYGUI_VALUEBOX_MAX_CHARS)
-        #define RAYGUI_VALUEBOX_MAX_CHARS  32
-    #endif
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulledText(bounds, (text != NULL), (text != NULL))) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiCheckBox");
 
     int result = RESULT_NONE;
     GuiState state = guiState;
 
-    //float prevValue = *value;
+    bool temp = false;
+    if (checked == NULL) checked = &temp;
 
     Rectangle textBounds = { 0 };
+
     if (text != NULL)
     {
-        textBounds.width = (float)GuiGetTextWidth(text) + 2;
+        textBounds.width = (float)GuiGetTextWidthCached(id, 0, text) + 2;
         textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + bounds.width + GuiGetStyle(VALUEBOX, TEXT_PADDING);
+        textBounds.x = bounds.x + bounds.width + GuiGetStyle(CHECKBOX, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
-        if (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(VALUEBOX, TEXT_PADDING);
+        if (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(CHECKBOX, TEXT_PADDING);
     }
 
     // Update control
@@ -3306,970 +4651,1265 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
     {
         Vector2 mousePoint = GUI_POINTER_POSITION;
 
-        bool valueHasChanged = false;
+        Rectangle totalBounds = {
+            (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT)? textBounds.x : bounds.x,
+            bounds.y,
+            bounds.width + textBounds.width + GuiGetStyle(CHECKBOX, TEXT_PADDING),
+            bounds.height,
+        };
 
-        if (editMode)
+        // Check checkbox state
+        if (GuiCheckHover(mousePoint, totalBounds))
         {
-            state = STATE_PRESSED;
-
-            int keyCount = (int)strlen(textValue);
+            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
 
-            // Add or remove minus symbol
-            if (GUI_KEY_PRESSED(KEY_MINUS))
+            if (GUI_BUTTON_RELEASED)
             {
-                if (textValue[0] == '-')
-                {
-                    for (int i = 0; i < keyCount; i++) textValue[i] = textValue[i + 1];
+                *checked = !(*checked);
 
-                    keyCount--;
-                    valueHasChanged = true;
-                }
-                else if (keyCount < (RAYGUI_VALUEBOX_MAX_CHARS - 1))
-                {
-                    if (keyCount == 0)
-                    {
-                        textValue[0] = '0';
-                        textValue[1] = '\0';
-                        keyCount++;
-                    }
+                result = RESULT_CHANGED;
+            }
+        }
+    }
+    //--------------------------------------------------------------------
 
-                    for (int i = keyCount; i > -1; i--) textValue[i + 1] = textValue[i];
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangle(bounds, GuiGetStyle(CHECKBOX, BORDER_WIDTH), GetColor(GuiGetStyle(CHECKBOX, BORDER + (state*3))), BLANK);
 
-                    textValue[0] = '-';
-                    keyCount++;
-                    valueHasChanged = true;
-                }
-            }
+    if (*checked)
+    {
+        Rectangle check = { bounds.x + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
+                            bounds.y + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
+                            bounds.width - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)),
+                            bounds.height - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)) };
+        GuiDrawRectangle(check, 0, BLANK, GetColor(GuiGetStyle(CHECKBOX, TEXT + state*3)));
+    }
 
-            // Only allow keys in range [48..57]
-            if (keyCount < RAYGUI_VALUEBOX_MAX_CHARS)
-            {
-                if (GuiGetTextWidth(textValue) < bounds.width)
-                {
-                    int key = GUI_INPUT_KEY;
-                    if (((key >= 48) && (key <= 57)) ||
-                        (key == '.') ||
-                        ((keyCount == 0) && (key == '+')) ||  // NOTE: Sign can only be in first position
-                        ((keyCount == 0) && (key == '-')))
-                    {
-                        textValue[keyCount] = (char)key;
-                        keyCount++;
+    GuiDrawText(text, textBounds, (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    //--------------------------------------------------------------------
 
-                        valueHasChanged = true;
-                    }
-                }
-            }
+    RAYGUI_PROFILE_END("GuiCheckBox");
+    return result;
+}
 
-            // Pressed backspace
-            if (GUI_KEY_PRESSED(KEY_BACKSPACE))
-            {
-                if (keyCount > 0)
-                {
-                    keyCount--;
-                    textValue[keyCount] = '\0';
-                    valueHasChanged = true;
-                }
-            }
+// Combo Box control
+int GuiComboBox(Rectangle bounds, const char *text, int *active)
+{
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
 
-            if (valueHasChanged) *value = TextToFloat(textValue);
+    RAYGUI_PROFILE_BEGIN("GuiComboBox");
+    GuiPushControlID(id);
 
-            if ((GUI_KEY_PRESSED(KEY_ENTER) || GUI_KEY_PRESSED(KEY_KP_ENTER)) ||
-                (!CheckCollisionPointRec(mousePoint, bounds) && GUI_BUTTON_PRESSED)) result = RESULT_PRESSED;
-        }
-        else
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    int temp = 0;
+    int prevActive = (active == NULL)? 0 : *active;
+    if (active == NULL) active = &temp;
+
+    bounds.width -= (GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH) + GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING));
+
+    Rectangle selector = { (float)bounds.x + bounds.width + GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING),
+                           (float)bounds.y, (float)GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH), (float)bounds.height };
+
+    // Get substrings items from text (items pointers, lengths and count)
+    int itemCount = 0;
+    char **items = GuiTextSplit(text, ';', &itemCount);
+
+    if (*active < 0) *active = 0;
+    else if (*active > (itemCount - 1)) *active = itemCount - 1;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && (itemCount > 1) && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
+
+        if (GuiCheckHover(mousePoint, bounds) ||
+            CheckCollisionPointRec(mousePoint, selector))
         {
-            if (CheckCollisionPointRec(mousePoint, bounds))
-            {
-                state = STATE_FOCUSED;
+            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
 
-                if (GUI_BUTTON_PRESSED) result = RESULT_PRESSED;
+            if (GUI_BUTTON_PRESSED)
+            {
+                *active += 1;
+                if (*active >= itemCount) *active = 0;      // Cyclic combobox
             }
         }
     }
 
-    //if (prevValue != *value) result = RESULT_CHANGED;
+    if (prevActive != *active) result = RESULT_CHANGED;
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    Color baseColor = BLANK;
-    if (state == STATE_PRESSED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_PRESSED));
-    else if (state == STATE_DISABLED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_DISABLED));
+    // Draw combo box main
+    GuiDrawRectangle(bounds, GuiGetStyle(COMBOBOX, BORDER_WIDTH), GetColor(GuiGetStyle(COMBOBOX, BORDER + (state*3))), GetColor(GuiGetStyle(COMBOBOX, BASE + (state*3))));
+    GuiDrawText(items[*active], GetTextBounds(COMBOBOX, bounds), GuiGetStyle(COMBOBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(COMBOBOX, TEXT + (state*3))));
 
-    GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
-    GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(VALUEBOX, TEXT + (state*3))));
+    // Draw selector using a custom button
+    // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
+    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
+    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiSetStyleTemp(BUTTON, BORDER_WIDTH, 1);
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 
-    // Draw cursor
-    if (editMode)
-    {
-        // NOTE: ValueBox internal text is always centered
-        Rectangle cursor = {bounds.x + GuiGetTextWidth(textValue)/2 + bounds.width/2 + 1,
-                            bounds.y + 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), 4,
-                            bounds.height - 4*GuiGetStyle(VALUEBOX, BORDER_WIDTH)};
-        GuiDrawRectangle(cursor, 0, BLANK, GetColor(GuiGetStyle(VALUEBOX, BORDER_COLOR_PRESSED)));
-    }
+    // NOTE: Using a local buffer, raylib TextFormat() buffers are shared by all threads
+    char selectorText[32] = { 0 };
+    snprintf(selectorText, 32, "%i/%i", *active + 1, itemCount);
+    RAYGUI_STATS_ADD(bufferBytes, 32);
+    GuiButton(selector, selectorText);
 
-    // Draw text label if provided
-    GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT,
-                GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
+    GuiSetStyleTemp(BUTTON, BORDER_WIDTH, tempBorderWidth);
     //--------------------------------------------------------------------
 
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiComboBox");
     return result;
 }
 
-// Slider control with pro parameters
-// NOTE: Other GuiSlider*() controls use this one
-int GuiSlider(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue)
+// Dropdown Box control
+// NOTE: Returns mouse click
+// NOTE: Items are indexed while dropdown box is open (not split every frame), only visible items are
+// drawn and hit-tested, DROPDOWN_MAX_VISIBLE_ITEMS limits open items (scroll bar shown if exceeded)
+// NOTE: Typing while open jumps to first item (sorted) starting with typed text, ENTER selects it
+int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMode)
 {
+    GuiID id = GuiGetControlID(bounds);
+    if (!editMode && (guiDropdownIndex.id == id)) guiDropdownIndex.id = 0;   // Dropdown box closed
+    if (!editMode && GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiDropdownBox");
+    GuiPushControlID(id);
+
     int result = RESULT_NONE;
     GuiState state = guiState;
 
-    float temp = (maxValue - minValue)/2.0f;
-    if (value == NULL) value = &temp;
+    int temp = 0;
+    int prevActive = (active == NULL)? 0 : *active;
+    if (active == NULL) active = &temp;
+    if (text == NULL) text = "";
 
-    float prevValue = *value;
+    int itemSelected = *active;
+    int itemFocused = -1;
 
-    int sliderWidth = GuiGetStyle(SLIDER, SLIDER_WIDTH);
+    int direction = 0; // Dropdown box open direction: down (default)
+    if (GuiGetStyle(DROPDOWNBOX, DROPDOWN_ROLL_UP) == 1) direction = 1; // Up
 
-    Rectangle slider = { bounds.x, bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH) + GuiGetStyle(SLIDER, SLIDER_PADDING),
-                         0, bounds.height - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - 2*GuiGetStyle(SLIDER, SLIDER_PADDING) };
+    // Get items count and selected item text, open dropdown box items are indexed
+    int itemCount = 0;
+    const char *itemText = GuiGetTextItem(text, itemSelected, &itemCount);
+
+    GuiDropdownIndex *index = &guiDropdownIndex;
+    bool open = false;
+
+    if (editMode)
+    {
+        open = GuiUpdateDropdownIndex(id, text);
+        itemCount = index->count;
+    }
+
+    float itemsStep = bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING);
+    int maxVisibleItems = GuiGetStyle(DROPDOWNBOX, DROPDOWN_MAX_VISIBLE_ITEMS);
+    int visibleItems = ((maxVisibleItems > 0) && (maxVisibleItems < itemCount))? maxVisibleItems : itemCount;
+    bool useScrollBar = (visibleItems < itemCount);
+    int startIndex = 0;
+
+    Rectangle boundsOpen = bounds;
+    boundsOpen.height = (visibleItems + 1)*itemsStep;
+    if (direction == 1) boundsOpen.y -= visibleItems*itemsStep + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING);
+
+    Rectangle itemBounds = bounds;
+    if (useScrollBar) itemBounds.width -= (GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) + GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH));
+
+    if (editMode)
+    {
+        // Reveal selected item when open
+        if (open && (itemSelected >= visibleItems)) index->scroll = itemSelected - visibleItems/2;
+
+        startIndex = index->scroll;
+        if (startIndex > (itemCount - visibleItems)) startIndex = itemCount - visibleItems;
+        if (startIndex < 0) startIndex = 0;
+    }
 
     // Update control
     //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked)
+    if ((state != STATE_DISABLED) && (editMode || !guiLocked) && (itemCount > 1) && !guiControlExclusiveMode)
     {
         Vector2 mousePoint = GUI_POINTER_POSITION;
 
-        if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
+        if (editMode)
         {
-            if (GUI_BUTTON_DOWN)
+            state = STATE_PRESSED;
+
+            // Check if mouse has been pressed or released outside limits
+            if (!CheckCollisionPointRec(mousePoint, boundsOpen))
+            {
+                if (GUI_BUTTON_PRESSED || GUI_BUTTON_RELEASED) result = 1;
+            }
+
+            // Check if already selected item has been pressed again
+            if (CheckCollisionPointRec(mousePoint, bounds) && GUI_BUTTON_PRESSED) result = 1;
+
+            // Type-ahead, typed text jumps to first item starting with it
+            int codepoint = GUI_INPUT_KEY;
+
+            while (codepoint > 0)
             {
-                if (CHECK_BOUNDS_ID(bounds, guiControlExclusiveRec))
+                if ((index->frames - index->typedFrame) > RAYGUI_DROPDOWN_TYPEAHEAD_FRAMES) index->typedLength = 0;
+
+                // NOTE: Only ASCII characters are considered for type-ahead
+                if ((codepoint >= 32) && (codepoint < 127) && (codepoint != ';'))
                 {
-                    state = STATE_PRESSED;
-                    // Get equivalent value and slider position from mousePosition.x
-                    *value = (maxValue - minValue)*((mousePoint.x - bounds.x - sliderWidth/2)/(bounds.width - sliderWidth)) + minValue;
+                    if (index->typedLength >= (RAYGUI_DROPDOWN_TYPEAHEAD_SIZE - 1)) index->typedLength = 0;
+
+                    index->typed[index->typedLength++] = (char)(((codepoint >= 'A') && (codepoint <= 'Z'))? codepoint + ('a' - 'A') : codepoint);
+                    index->typedFrame = index->frames;
+
+                    int item = GuiFindDropdownItem(text, index->typed, index->typedLength);
+
+                    // No item starting with typed prefix, a new prefix is started with typed character
+                    if ((item < 0) && (index->typedLength > 1))
+                    {
+                        index->typed[0] = index->typed[index->typedLength - 1];
+                        index->typedLength = 1;
+                        item = GuiFindDropdownItem(text, index->typed, index->typedLength);
+                    }
+
+                    if (item >= 0)
+                    {
+                        index->typedItem = item;
+
+                        if (item < startIndex) startIndex = item;
+                        else if (item >= (startIndex + visibleItems)) startIndex = item - visibleItems + 1;
+                    }
                 }
+
+                codepoint = GUI_INPUT_KEY;
             }
-            else
+
+            if ((index->typedItem >= 0) && GUI_KEY_PRESSED(KEY_ENTER))
             {
-                guiControlExclusiveMode = false;
-                guiControlExclusiveRec = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
+                itemSelected = index->typedItem;
+                result = 1;         // Item selected
             }
-        }
-        else if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            if (GUI_BUTTON_DOWN)
+
+            // Scroll items with mouse wheel
+            // NOTE: Rolling up, items scroll in opposite direction
+            if (useScrollBar && CheckCollisionPointRec(mousePoint, boundsOpen)) startIndex -= (int)GUI_SCROLL_DELTA*((direction == 0)? 1 : -1);
+
+            if (startIndex > (itemCount - visibleItems)) startIndex = itemCount - visibleItems;
+            if (startIndex < 0) startIndex = 0;
+
+            // Check focused and selected item, only visible items
+            for (int i = 0; i < visibleItems; i++)
             {
-                state = STATE_PRESSED;
-                guiControlExclusiveMode = true;
-                guiControlExclusiveRec = bounds; // Store bounds as an identifier when dragging starts
+                // Update item rectangle y position for next item
+                if (direction == 0) itemBounds.y += itemsStep;
+                else itemBounds.y -= itemsStep;
 
-                if (!CheckCollisionPointRec(mousePoint, slider))
+                if (CheckCollisionPointRec(mousePoint, itemBounds))
                 {
-                    // Get equivalent value and slider position from mousePosition.x
-                    *value = (maxValue - minValue)*((mousePoint.x - bounds.x - sliderWidth/2)/(bounds.width - sliderWidth)) + minValue;
+                    itemFocused = startIndex + i;
+                    if (GUI_BUTTON_RELEASED)
+                    {
+                        itemSelected = startIndex + i;
+                        result = 1;         // Item selected
+                    }
+                    break;
                 }
             }
-            else state = STATE_FOCUSED;
-        }
 
-        if (*value > maxValue) *value = maxValue;
-        else if (*value < minValue) *value = minValue;
-    }
+            if ((itemFocused == -1) && (index->typedItem >= 0)) itemFocused = index->typedItem;
 
-    // Slider bar limits check
-    float sliderValue = (((*value - minValue)/(maxValue - minValue))*(bounds.width - sliderWidth - 2*GuiGetStyle(SLIDER, BORDER_WIDTH)));
-    if (sliderWidth > 0)        // Slider
-    {
-        slider.x += sliderValue;
-        slider.width = (float)sliderWidth;
-        if (slider.x <= (bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH))) slider.x = bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH);
-        else if ((slider.x + slider.width) >= (bounds.x + bounds.width)) slider.x = bounds.x + bounds.width - slider.width - GuiGetStyle(SLIDER, BORDER_WIDTH);
-    }
-    else if (sliderWidth == 0)  // SliderBar
-    {
-        slider.x += GuiGetStyle(SLIDER, BORDER_WIDTH);
-        slider.width = sliderValue;
-        if (slider.width > bounds.width) slider.width = bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH);
+            itemBounds.y = bounds.y;
+        }
+        else
+        {
+            if (GuiCheckHover(mousePoint, bounds))
+            {
+                if (GUI_BUTTON_PRESSED)
+                {
+                    result = 1;
+                    state = STATE_PRESSED;
+                }
+                else state = STATE_FOCUSED;
+            }
+        }
     }
-
-    if (prevValue != *value) result = RESULT_CHANGED;
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(SLIDER, BORDER + (state*3))), GetColor(GuiGetStyle(SLIDER, (state != STATE_DISABLED)?  BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)));
+    if (editMode) GuiPanel(boundsOpen, NULL);
 
-    // Draw slider internal bar (depends on state)
-    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
-    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_FOCUSED)));
-    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_PRESSED)));
-    else if (state == STATE_DISABLED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_DISABLED)));
+    GuiDrawRectangle(bounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER + state*3)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE + state*3)));
+    GuiDrawText(GuiCopyTextItem(itemText), GetTextBounds(DROPDOWNBOX, bounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + state*3)));
 
-    // Draw left/right text if provided
-    if (textLeft != NULL)
+    if (editMode)
     {
-        Rectangle textBounds = { 0 };
-        textBounds.width = (float)GuiGetTextWidth(textLeft);
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x - textBounds.width - GuiGetStyle(SLIDER, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        // Draw visible items
+        for (int i = startIndex; i < (startIndex + visibleItems); i++)
+        {
+            // Update item rectangle y position for next item
+            if (direction == 0) itemBounds.y += itemsStep;
+            else itemBounds.y -= itemsStep;
 
-        GuiDrawText(textLeft, textBounds, TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+            const char *item = GuiCopyTextItem(text + index->offsets[i]);
+
+            if (i == itemSelected)
+            {
+                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_PRESSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_PRESSED)));
+                GuiDrawText(item, GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_PRESSED)));
+            }
+            else if (i == itemFocused)
+            {
+                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_FOCUSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_FOCUSED)));
+                GuiDrawText(item, GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_FOCUSED)));
+            }
+            else GuiDrawText(item, GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_NORMAL)));
+        }
+
+        if (useScrollBar)
+        {
+            // NOTE: Scroll bar width shared with list view style
+            Rectangle scrollBarBounds = {
+                boundsOpen.x + boundsOpen.width - GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
+                (direction == 0)? bounds.y + itemsStep : boundsOpen.y + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING),
+                (float)GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH), visibleItems*itemsStep - GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING)
+            };
+
+            // Calculate percentage of visible items and apply same percentage to scrollbar
+            float sliderSize = scrollBarBounds.height*visibleItems/itemCount;
+            int maxScroll = itemCount - visibleItems;
+
+            int prevSliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);   // Save default slider size
+            int prevScrollSpeed = GuiGetStyle(SCROLLBAR, SCROLL_SPEED); // Save default scroll speed
+            GuiSetStyleTemp(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)sliderSize);            // Change slider size
+            GuiSetStyleTemp(SCROLLBAR, SCROLL_SPEED, maxScroll); // Change scroll speed
+
+            // NOTE: Rolling up, first items are drawn at the bottom
+            if (direction == 0) startIndex = GuiScrollBar(scrollBarBounds, startIndex, 0, maxScroll);
+            else startIndex = maxScroll - GuiScrollBar(scrollBarBounds, maxScroll - startIndex, 0, maxScroll);
+
+            GuiSetStyleTemp(SCROLLBAR, SCROLL_SPEED, prevScrollSpeed); // Reset scroll speed to default
+            GuiSetStyleTemp(SCROLLBAR, SCROLL_SLIDER_SIZE, prevSliderSize); // Reset slider size to default
+        }
+
+        index->scroll = startIndex;
     }
 
-    if (textRight != NULL)
+    if (!GuiGetStyle(DROPDOWNBOX, DROPDOWN_ARROW_HIDDEN))
     {
-        Rectangle textBounds = { 0 };
-        textBounds.width = (float)GuiGetTextWidth(textRight);
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + bounds.width + GuiGetStyle(SLIDER, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
-
-        GuiDrawText(textRight, textBounds, TEXT_ALIGN_LEFT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+        // Draw arrows (using icon if available)
+#if defined(RAYGUI_NO_ICONS)
+        GuiDrawText("v", RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 2, 10, 10 },
+            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
+#else
+        GuiDrawText(direction? GuiIconText(ICON_ARROW_UP_FILL, NULL) : GuiIconText(ICON_ARROW_DOWN_FILL, NULL),
+            RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 6, 10, 10 },
+            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));   // ICON_ARROW_DOWN_FILL
+#endif
     }
     //--------------------------------------------------------------------
 
-    return result;
-}
+    *active = itemSelected;
 
-// Slider Bar control extended, returns selected value
-int GuiSliderBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue)
-{
-    int result = RESULT_NONE;
-    int preSliderWidth = GuiGetStyle(SLIDER, SLIDER_WIDTH);
-    GuiSetStyle(SLIDER, SLIDER_WIDTH, 0);
-    result = GuiSlider(bounds, textLeft, textRight, value, minValue, maxValue);
-    GuiSetStyle(SLIDER, SLIDER_WIDTH, preSliderWidth);
+    if (prevActive != *active) result = RESULT_CHANGED;
 
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiDropdownBox");
     return result;
 }
 
-// Progress Bar control extended, shows current progress value
-int GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue)
+// Text Box control
+// NOTE: Returns true on ENTER pressed (useful for data validation)
+int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
 {
+    #if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN)
+        #define RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN  20        // Frames to wait for autocursor movement
+    #endif
+    #if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY)
+        #define RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY      1        // Frames delay for autocursor movement
+    #endif
+
+    GuiGetControlID(bounds);
+    if (!editMode && GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiTextBox");
+
     int result = RESULT_NONE;
     GuiState state = guiState;
 
-    float temp = (maxValue - minValue)/2.0f;
-    if (value == NULL) value = &temp;
-    float prevValue = *value;
+    bool multiline = false;
+    int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);
 
-    // Progress bar
-    Rectangle progress = { bounds.x + GuiGetStyle(PROGRESSBAR, BORDER_WIDTH),
-                           bounds.y + GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) + GuiGetStyle(PROGRESSBAR, PROGRESS_PADDING), 0,
-                           bounds.height - GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) - 2*GuiGetStyle(PROGRESSBAR, PROGRESS_PADDING) -1 };
+    Rectangle textBounds = GetTextBounds(TEXTBOX, bounds);
+    int textLength = (text != NULL)? (int)strlen(text) : 0; // Get current text length
+    int thisCursorIndex = textBoxCursorIndex;
+    if (thisCursorIndex > textLength) thisCursorIndex = textLength;
+    int textWidth = GuiGetTextWidth(text) - GuiGetTextWidth(text + thisCursorIndex);
+    int textIndexOffset = 0; // Text index offset to start drawing in the box
 
-    // Update control
-    //--------------------------------------------------------------------
-    if (*value > maxValue) *value = maxValue;
+    // Cursor rectangle
+    // NOTE: Position X value should be updated
+    Rectangle cursor = {
+        textBounds.x + textWidth + GuiGetStyle(DEFAULT, TEXT_SPACING),
+        textBounds.y + textBounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE),
+        2,
+        (float)GuiGetStyle(DEFAULT, TEXT_SIZE)*2
+    };
 
-    // WARNING: Working with floats could lead to rounding issues
-    if ((state != STATE_DISABLED)) progress.width = ((float)*value/(maxValue - minValue))*(bounds.width - 2*GuiGetStyle(PROGRESSBAR, BORDER_WIDTH));
+    if (cursor.height >= bounds.height) cursor.height = bounds.height - GuiGetStyle(TEXTBOX, BORDER_WIDTH)*2;
+    if (cursor.y < (bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH))) cursor.y = bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH);
 
-    if (prevValue != *value) result = RESULT_CHANGED;
-    //--------------------------------------------------------------------
+    // Mouse cursor rectangle
+    // NOTE: Initialized outside of screen
+    Rectangle mouseCursor = cursor;
+    mouseCursor.x = -1;
+    mouseCursor.width = 1;
 
-    // Draw control
+    // Blink-cursor frame counter
+    //if (!autoCursorMode) blinkCursorFrameCounter++;
+    //else blinkCursorFrameCounter = 0;
+
+    // Update control
     //--------------------------------------------------------------------
-    if (state == STATE_DISABLED)
-    {
-        GuiDrawRectangle(bounds, GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(PROGRESSBAR, BORDER + (state*3))), BLANK);
-    }
-    else
+    // WARNING: Text editing is only supported under certain conditions:
+    if ((state != STATE_DISABLED) &&                // Control not disabled
+        !GuiGetStyle(TEXTBOX, TEXT_READONLY) &&     // TextBox not on read-only mode
+        !guiLocked &&                               // Gui not locked
+        !guiControlExclusiveMode &&                       // No gui slider on dragging
+        (wrapMode == TEXT_WRAP_NONE))               // No wrap mode
     {
-        if (*value > minValue)
-        {
-            // Draw progress bar with colored border, more visual
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height - 2 }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
-        }
-        else GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height+GuiGetStyle(PROGRESSBAR, BORDER_WIDTH)-1 }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
+        Vector2 mousePosition = GUI_POINTER_POSITION;
 
-        if (*value >= maxValue) GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height+GuiGetStyle(PROGRESSBAR, BORDER_WIDTH)-1}, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
-        else
+        if (editMode)
         {
-            // Draw borders not yet reached by value
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.y, bounds.width - (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) - (int)progress.width - 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.y + bounds.height - 1, bounds.width - (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) - (int)progress.width - 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height+GuiGetStyle(PROGRESSBAR, BORDER_WIDTH)-1 }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
-        }
+            // GLOBAL: Auto-cursor movement logic
+            // NOTE: Keystrokes are handled repeatedly when button is held down for some time
+            if (GUI_KEY_DOWN(KEY_LEFT) || GUI_KEY_DOWN(KEY_RIGHT) ||
+                GUI_KEY_DOWN(KEY_UP) || GUI_KEY_DOWN(KEY_DOWN) ||
+                GUI_KEY_DOWN(KEY_BACKSPACE) || GUI_KEY_DOWN(KEY_DELETE)) autoCursorCounter++;
+            else autoCursorCounter = 0;
 
-        // Draw slider internal progress bar (depends on state)
-        if (GuiGetStyle(PROGRESSBAR, PROGRESS_SIDE) == 0) // Left-->Right
-        {
-            GuiDrawRectangle(progress, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BASE_COLOR_PRESSED)));
-        }
-        else // Right-->Left
-        {
-            progress.x = bounds.x + bounds.width - progress.width - GuiGetStyle(PROGRESSBAR, BORDER_WIDTH);
-            GuiDrawRectangle(progress, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BASE_COLOR_PRESSED)));
-        }
-    }
+            bool autoCursorShouldTrigger = (autoCursorCounter > RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN) && ((autoCursorCounter % RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY) == 0);
 
-    // Draw left/right text if provided
-    if (textLeft != NULL)
-    {
-        Rectangle textBounds = { 0 };
-        textBounds.width = (float)GuiGetTextWidth(textLeft);
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x - textBounds.width - GuiGetStyle(PROGRESSBAR, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+            state = STATE_PRESSED;
 
-        GuiDrawText(textLeft, textBounds, TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
-    }
+            if (textBoxCursorIndex > textLength) textBoxCursorIndex = textLength;
 
-    if (textRight != NULL)
-    {
-        Rectangle textBounds = { 0 };
-        textBounds.width = (float)GuiGetTextWidth(textRight);
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + bounds.width + GuiGetStyle(PROGRESSBAR, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+            // If text does not fit in the textbox and current cursor position is out of bounds,
+            // adding an index offset to text for drawing only what requires depending on cursor
+            while (textWidth >= textBounds.width)
+            {
+                int nextCodepointSize = 0;
+                GetCodepointNext(text + textIndexOffset, &nextCodepointSize);
 
-        GuiDrawText(textRight, textBounds, TEXT_ALIGN_LEFT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
-    }
-    //--------------------------------------------------------------------
+                textIndexOffset += nextCodepointSize;
 
-    return result;
-}
+                textWidth = GuiGetTextWidth(text + textIndexOffset) - GuiGetTextWidth(text + textBoxCursorIndex);
+            }
 
-// Status Bar control
-int GuiStatusBar(Rectangle bounds, const char *text)
-{
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+            int codepoint = GUI_INPUT_KEY; // Get Unicode codepoint
+            if (multiline && GUI_KEY_PRESSED(KEY_ENTER)) codepoint = (int)'\n';
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+            // Encode codepoint as UTF-8
+            int codepointSize = 0;
+            const char *charEncoded = CodepointToUTF8(codepoint, &codepointSize);
 
-        // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            //if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            //else state = STATE_FOCUSED;
+            // Handle text paste action
+            if (GUI_KEY_PRESSED(KEY_V) && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
+            {
+                const char *pasteText = GUI_CLIPBOARD_TEXT;
+                if (pasteText != NULL)
+                {
+                    int pasteLength = 0;
+                    int pasteCodepoint;
+                    int pasteCodepointSize;
 
-            if (GUI_BUTTON_RELEASED) result = RESULT_PRESSED;
-        }
-    }
-    //--------------------------------------------------------------------
+                    // Count how many codepoints to copy, stopping at the first unwanted control character
+                    while (true)
+                    {
+                        pasteCodepoint = GetCodepointNext(pasteText + pasteLength, &pasteCodepointSize);
+                        if (textLength + pasteLength + pasteCodepointSize >= textSize) break;
+                        if (!(multiline && (pasteCodepoint == (int)'\n')) && !(pasteCodepoint >= 32)) break;
+                        pasteLength += pasteCodepointSize;
+                    }
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(STATUSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(STATUSBAR, BORDER + (state*3))), GetColor(GuiGetStyle(STATUSBAR, BASE + (state*3))));
-    GuiDrawText(text, GetTextBounds(STATUSBAR, bounds), GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT), GetColor(GuiGetStyle(STATUSBAR, TEXT + (state*3))));
-    //--------------------------------------------------------------------
+                    if (pasteLength > 0)
+                    {
+                        // Move forward data from cursor position
+                        for (int i = textLength + pasteLength; i > textBoxCursorIndex; i--) text[i] = text[i - pasteLength];
 
-    return result;
-}
+                        // Paste data in at cursor
+                        for (int i = 0; i < pasteLength; i++) text[textBoxCursorIndex + i] = pasteText[i];
 
-// Dummy rectangle control, intended for placeholding
-int GuiDummyRec(Rectangle bounds, const char *text)
-{
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+                        textBoxCursorIndex += pasteLength;
+                        textLength += pasteLength;
+                        text[textLength] = '\0';
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+                        //result = RESULT_CHANGED;
+                    }
+                }
+            }
+            else if (((multiline && (codepoint == (int)'\n')) || (codepoint >= 32)) && ((textLength + codepointSize) < textSize))
+            {
+                // Adding codepoint to text, at current cursor position
 
-        // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
+                // Move forward data from cursor position
+                for (int i = (textLength + codepointSize); i > textBoxCursorIndex; i--) text[i] = text[i - codepointSize];
 
-            if (GUI_BUTTON_RELEASED) result = RESULT_PRESSED;
-        }
-    }
-    //--------------------------------------------------------------------
+                // Add new codepoint in current cursor position
+                for (int i = 0; i < codepointSize; i++) text[textBoxCursorIndex + i] = charEncoded[i];
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state != STATE_DISABLED)? BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)));
-    GuiDrawText(text, GetTextBounds(DEFAULT, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(BUTTON, (state != STATE_DISABLED)? TEXT_COLOR_NORMAL : TEXT_COLOR_DISABLED)));
-    //------------------------------------------------------------------
+                textBoxCursorIndex += codepointSize;
+                textLength += codepointSize;
 
-    return result;
-}
+                // Make sure text last character is EOL
+                text[textLength] = '\0';
 
-// List View control
-int GuiListView(Rectangle bounds, const char *text, int *scrollIndex, int *active)
-{
-    int result = RESULT_NONE;
-    int itemCount = 0;
-    char **items = NULL;
+                //result = RESULT_CHANGED;
+            }
 
-    if (text != NULL) items = GuiTextSplit(text, ';', &itemCount);
+            // Move cursor to start
+            if ((textLength > 0) && GUI_KEY_PRESSED(KEY_HOME)) textBoxCursorIndex = 0;
 
-    result = GuiListViewEx(bounds, items, itemCount, scrollIndex, active, NULL);
+            // Move cursor to end
+            if ((textLength > textBoxCursorIndex) && GUI_KEY_PRESSED(KEY_END)) textBoxCursorIndex = textLength;
 
-    return result;
-}
+            // Delete related codepoints from text, after current cursor position
+            if ((textLength > textBoxCursorIndex) && GUI_KEY_PRESSED(KEY_DELETE) && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
+            {
+                int offset = textBoxCursorIndex;
+                int accCodepointSize = 0;
+                int nextCodepointSize;
+                int nextCodepoint;
 
-// List View control using text entries list and returning focus entry
-int GuiListViewEx(Rectangle bounds, char **text, int count, int *scrollIndex, int *active, int *focus)
-{
-    int result = RESULT_NONE;
-    GuiState state = guiState;
+                // Check characters of the same type to delete (either ASCII punctuation or anything non-whitespace)
+                // Not using isalnum() since it only works on ASCII characters
+                nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
+                bool puctuation = ispunct(nextCodepoint & 0xff);
+                while (offset < textLength)
+                {
+                    if ((puctuation && !ispunct(nextCodepoint & 0xff)) ||
+                        (!puctuation && (isspace(nextCodepoint & 0xff) || ispunct(nextCodepoint & 0xff)))) break;
 
-    int itemFocused = (focus == NULL)? -1 : *focus;
-    int itemSelected = (active == NULL)? -1 : *active;
-    int prevActive = (active == NULL)? 0 : *active;
+                    offset += nextCodepointSize;
+                    accCodepointSize += nextCodepointSize;
+                    nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
+                }
 
-    // Check if scroll bar is needed
-    bool useScrollBar = false;
-    if ((GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING))*count > bounds.height) useScrollBar = true;
+                // Check whitespace to delete (ASCII only)
+                while (offset < textLength)
+                {
+                    if (!isspace(nextCodepoint & 0xff)) break;
 
-    // Define base item rectangle [0]
-    Rectangle itemBounds = { 0 };
-    itemBounds.x = bounds.x + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING);
-    itemBounds.y = bounds.y + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING) + GuiGetStyle(DEFAULT, BORDER_WIDTH);
-    itemBounds.width = bounds.width - 2*GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING) - GuiGetStyle(DEFAULT, BORDER_WIDTH);
-    itemBounds.height = (float)GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT);
-    if (useScrollBar) itemBounds.width -= GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH);
+                    offset += nextCodepointSize;
+                    accCodepointSize += nextCodepointSize;
+                    nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
+                }
 
-    // Get items on the list
-    int visibleItems = (int)bounds.height/(GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING));
-    if (visibleItems > count) visibleItems = count;
+                // Move text after cursor forward (including final null terminator)
+                for (int i = offset; i <= textLength; i++) text[i - accCodepointSize] = text[i];
 
-    int startIndex = (scrollIndex == NULL)? 0 : *scrollIndex;
-    if ((startIndex < 0) || (startIndex > (count - visibleItems))) startIndex = 0;
-    int endIndex = startIndex + visibleItems;
+                textLength -= accCodepointSize;
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+                //result = RESULT_CHANGED;
+            }
+            else if ((textLength > textBoxCursorIndex) && (GUI_KEY_PRESSED(KEY_DELETE) ||
+                (GUI_KEY_DOWN(KEY_DELETE) && autoCursorShouldTrigger)))
+            {
+                // Delete single codepoint from text, after current cursor position
 
-        // Check mouse inside list view
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            state = STATE_FOCUSED;
+                int nextCodepointSize = 0;
+                GetCodepointNext(text + textBoxCursorIndex, &nextCodepointSize);
 
-            // Check focused and selected item
-            for (int i = 0; i < visibleItems; i++)
-            {
-                if (CheckCollisionPointRec(mousePoint, itemBounds))
-                {
-                    itemFocused = startIndex + i;
-                    if (GUI_BUTTON_PRESSED)
-                    {
-                        if (itemSelected == (startIndex + i)) itemSelected = -1;
-                        else itemSelected = startIndex + i;
-                    }
-                    break;
-                }
+                // Move text after cursor forward (including final null terminator)
+                for (int i = textBoxCursorIndex + nextCodepointSize; i <= textLength; i++) text[i - nextCodepointSize] = text[i];
 
-                // Update item rectangle y position for next item
-                itemBounds.y += (GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING));
+                textLength -= nextCodepointSize;
+
+                //result = RESULT_CHANGED;
             }
 
-            if (useScrollBar)
+            // Delete related codepoints from text, before current cursor position
+            if ((textBoxCursorIndex > 0) && GUI_KEY_PRESSED(KEY_BACKSPACE) &&
+                (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
             {
-                float scrollDelta = GUI_SCROLL_DELTA;
-                startIndex -= (int)scrollDelta;
+                int offset = textBoxCursorIndex;
+                int accCodepointSize = 0;
+                int prevCodepointSize = 0;
+                int prevCodepoint = 0;
 
-                if (startIndex < 0) startIndex = 0;
-                else if (startIndex > (count - visibleItems)) startIndex = count - visibleItems;
+                // Check whitespace to delete (ASCII only)
+                while (offset > 0)
+                {
+                    prevCodepoint = GetCodepointPrevious(text + offset, &prevCodepointSize);
+                    if (!isspace(prevCodepoint & 0xff)) break;
 
-                endIndex = startIndex + visibleItems;
-                if (endIndex > count) endIndex = count;
-            }
-        }
-        else itemFocused = -1;
+                    offset -= prevCodepointSize;
+                    accCodepointSize += prevCodepointSize;
+                }
 
-        // Reset item rectangle y to [0]
-        itemBounds.y = bounds.y + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING) + GuiGetStyle(DEFAULT, BORDER_WIDTH);
-    }
-    //--------------------------------------------------------------------
+                // Check characters of the same type to delete (either ASCII punctuation or anything non-whitespace)
+                // Not using isalnum() since it only works on ASCII characters
+                bool puctuation = ispunct(prevCodepoint & 0xff);
+                while (offset > 0)
+                {
+                    prevCodepoint = GetCodepointPrevious(text + offset, &prevCodepointSize);
+                    if ((puctuation && !ispunct(prevCodepoint & 0xff)) ||
+                        (!puctuation && (isspace(prevCodepoint & 0xff) || ispunct(prevCodepoint & 0xff)))) break;
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));     // Draw background
+                    offset -= prevCodepointSize;
+                    accCodepointSize += prevCodepointSize;
+                }
 
-    // Draw visible items
-    for (int i = 0; ((i < visibleItems) && (text != NULL)); i++)
-    {
-        if (GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_NORMAL)) GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_NORMAL)), BLANK);
+                // Move text after cursor forward (including final null terminator)
+                for (int i = textBoxCursorIndex; i <= textLength; i++) text[i - accCodepointSize] = text[i];
 
-        if (state == STATE_DISABLED)
-        {
-            if ((startIndex + i) == itemSelected) GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_DISABLED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_DISABLED)));
+                textLength -= accCodepointSize;
+                textBoxCursorIndex -= accCodepointSize;
 
-            GuiDrawText(text[startIndex + i], GetTextBounds(LISTVIEW, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_DISABLED)));
-        }
-        else
-        {
-            if (((startIndex + i) == itemSelected) && (active != NULL))
-            {
-                // Draw item selected
-                GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_PRESSED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_PRESSED)));
-                GuiDrawText(text[startIndex + i], GetTextBounds(LISTVIEW, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_PRESSED)));
-            }
-            else if (((startIndex + i) == itemFocused)) // && (focus != NULL)) // NOTE: Items focused, despite not returned
-            {
-                // Draw item focused
-                GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_FOCUSED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_FOCUSED)));
-                GuiDrawText(text[startIndex + i], GetTextBounds(LISTVIEW, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_FOCUSED)));
+                //result = RESULT_CHANGED;
             }
-            else
+            else if ((textBoxCursorIndex > 0) && (GUI_KEY_PRESSED(KEY_BACKSPACE) || (GUI_KEY_DOWN(KEY_BACKSPACE) && autoCursorShouldTrigger)))
             {
-                // Draw item normal (no rectangle)
-                GuiDrawText(text[startIndex + i], GetTextBounds(LISTVIEW, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_NORMAL)));
-            }
-        }
-
-        // Update item rectangle y position for next item
-        itemBounds.y += (GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING));
-    }
+                // Delete single codepoint from text, before current cursor position
 
-    if (useScrollBar)
-    {
-        Rectangle scrollBarBounds = {
-            bounds.x + bounds.width - GuiGetStyle(LISTVIEW, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
-            bounds.y + GuiGetStyle(LISTVIEW, BORDER_WIDTH), (float)GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
-            bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH)
-        };
+                int prevCodepointSize = 0;
 
-        // Calculate percentage of visible items and apply same percentage to scrollbar
-        float percentVisible = (float)(endIndex - startIndex)/count;
-        float sliderSize = bounds.height*percentVisible;
+                GetCodepointPrevious(text + textBoxCursorIndex, &prevCodepointSize);
 
-        int prevSliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);   // Save default slider size
-        int prevScrollSpeed = GuiGetStyle(SCROLLBAR, SCROLL_SPEED); // Save default scroll speed
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)sliderSize);            // Change slider size
-        GuiSetStyle(SCROLLBAR, SCROLL_SPEED, count - visibleItems); // Change scroll speed
+                // Move text after cursor forward (including final null terminator)
+                for (int i = textBoxCursorIndex; i <= textLength; i++) text[i - prevCodepointSize] = text[i];
 
-        startIndex = GuiScrollBar(scrollBarBounds, startIndex, 0, count - visibleItems);
+                textLength -= prevCodepointSize;
+                textBoxCursorIndex -= prevCodepointSize;
 
-        GuiSetStyle(SCROLLBAR, SCROLL_SPEED, prevScrollSpeed); // Reset scroll speed to default
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, prevSliderSize); // Reset slider size to default
-    }
-    //--------------------------------------------------------------------
+                //result = RESULT_CHANGED;
+            }
 
-    if (active != NULL) *active = itemSelected;
-    if (focus != NULL) *focus = itemFocused;
-    if (scrollIndex != NULL) *scrollIndex = startIndex;
+            // Move cursor position with keys
+            if ((textBoxCursorIndex > 0) && GUI_KEY_PRESSED(KEY_LEFT) && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
+            {
+                int offset = textBoxCursorIndex;
+                //int accCodepointSize = 0;
+                int prevCodepointSize = 0;
+                int prevCodepoint = 0;
 
-    if (prevActive != *active) result = RESULT_CHANGED;
+                // Check whitespace to skip (ASCII only)
+                while (offset > 0)
+                {
+                    prevCodepoint = GetCodepointPrevious(text + offset, &prevCodepointSize);
+                    if (!isspace(prevCodepoint & 0xff)) break;
 
-    return result;
-}
+                    offset -= prevCodepointSize;
+                    //accCodepointSize += prevCodepointSize;
+                }
 
-// Tab Bar control
-int GuiTabBar(Rectangle bounds, const char *text, int *hscroll, int *active)
-{
-    int result = RESULT_NONE;
-    int itemCount = 0;
-    char **items = NULL;
+                // Check characters of the same type to skip (either ASCII punctuation or anything non-whitespace)
+                // Not using isalnum() since it only works on ASCII characters
+                bool puctuation = ispunct(prevCodepoint & 0xff);
+                while (offset > 0)
+                {
+                    prevCodepoint = GetCodepointPrevious(text + offset, &prevCodepointSize);
+                    if ((puctuation && !ispunct(prevCodepoint & 0xff)) || (!puctuation && (isspace(prevCodepoint & 0xff) || ispunct(prevCodepoint & 0xff)))) break;
 
-    if (text != NULL) items = GuiTextSplit(text, ';', &itemCount);
+                    offset -= prevCodepointSize;
+                    //accCodepointSize += prevCodepointSize;
+                }
 
-    result = GuiTabBarEx(bounds, items, itemCount, hscroll, active, NULL);
+                textBoxCursorIndex = offset;
+            }
+            else if ((textBoxCursorIndex > 0) && (GUI_KEY_PRESSED(KEY_LEFT) || (GUI_KEY_DOWN(KEY_LEFT) && autoCursorShouldTrigger)))
+            {
+                int prevCodepointSize = 0;
+                GetCodepointPrevious(text + textBoxCursorIndex, &prevCodepointSize);
 
-    return result;
-}
+                textBoxCursorIndex -= prevCodepointSize;
+            }
+            else if ((textLength > textBoxCursorIndex) && GUI_KEY_PRESSED(KEY_RIGHT) && (GUI_KEY_DOWN(KEY_LEFT_CONTROL) || GUI_KEY_DOWN(KEY_RIGHT_CONTROL)))
+            {
+                int offset = textBoxCursorIndex;
+                //int accCodepointSize = 0;
+                int nextCodepointSize;
+                int nextCodepoint;
 
-// Tab Bar control, using text entries list and returning focus entry
-// NOTE: In case of tab close result, consider focused tab
-// TODO: Reeplace GuiToggle() usage for custom implementation for the TABS
-int GuiTabBarEx(Rectangle bounds, char **text, int count, int *hscroll, int *active, int *focus)
-{
-    int result = RESULT_NONE;
-    //GuiState state = guiState;
+                // Check characters of the same type to skip (either ASCII punctuation or anything non-whitespace)
+                // Not using isalnum() since it only works on ASCII characters
+                nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
+                bool puctuation = ispunct(nextCodepoint & 0xff);
+                while (offset < textLength)
+                {
+                    if ((puctuation && !ispunct(nextCodepoint & 0xff)) || (!puctuation && (isspace(nextCodepoint & 0xff) || ispunct(nextCodepoint & 0xff)))) break;
 
-    int tabItemsWidth = GuiGetStyle(TABBAR, TAB_ITEMS_WIDTH);
-    Rectangle tabBounds = { bounds.x, bounds.y, (float)tabItemsWidth, bounds.height };
+                    offset += nextCodepointSize;
+                    //accCodepointSize += nextCodepointSize;
+                    nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
+                }
 
-    if (*active < 0) *active = 0;
-    else if (*active > count - 1) *active = count - 1;
+                // Check whitespace to skip (ASCII only)
+                while (offset < textLength)
+                {
+                    if (!isspace(nextCodepoint & 0xff)) break;
 
-    int prevActive = (active == NULL)? 0 : *active;
+                    offset += nextCodepointSize;
+                    //accCodepointSize += nextCodepointSize;
+                    nextCodepoint = GetCodepointNext(text + offset, &nextCodepointSize);
+                }
 
-    int offsetX = 0;     // Required in case tabs go out of screen
-    offsetX = (*active*tabItemsWidth) - GetScreenWidth();
-    if (offsetX < 0) offsetX = 0;
+                textBoxCursorIndex = offset;
+            }
+            else if ((textLength > textBoxCursorIndex) && (GUI_KEY_PRESSED(KEY_RIGHT) || (GUI_KEY_DOWN(KEY_RIGHT) && autoCursorShouldTrigger)))
+            {
+                int nextCodepointSize = 0;
+                GetCodepointNext(text + textBoxCursorIndex, &nextCodepointSize);
 
-    bool toggle = false; // Required for individual toggles
+                textBoxCursorIndex += nextCodepointSize;
+            }
 
-    // Draw control
-    //--------------------------------------------------------------------
-    //if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode) // TODO: Support disabled
+            // Move cursor position with mouse
+            if (CheckCollisionPointRec(mousePosition, textBounds))
+            {
+                float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)guiFont.baseSize;
+                int codepointIndex = 0;
+                float glyphWidth = 0.0f;
+                float widthToMouseX = 0;
+                int mouseCursorIndex = 0;
 
-    for (int i = 0; i < count; i++)
-    {
-        tabBounds.x = bounds.x + (tabItemsWidth + 4)*i + offsetX;
+                for (int i = textIndexOffset; i < textLength; i += codepointSize)
+                {
+                    codepoint = GetCodepointNext(&text[i], &codepointSize);
+                    codepointIndex = GuiGetGlyphIndex(codepoint);
 
-        if (tabBounds.x < GetScreenWidth())
-        {
-            // Draw tabs as toggle controls
-            int textAlignment = GuiGetStyle(TOGGLE, TEXT_ALIGNMENT);
-            int textPadding = GuiGetStyle(TOGGLE, TEXT_PADDING);
-            GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-            GuiSetStyle(TOGGLE, TEXT_PADDING, 8);
+                    if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
+                    else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
 
-            if (i == (*active))
-            {
-                toggle = true;
-                GuiToggle(tabBounds, text[i], &toggle);
-            }
-            else
-            {
-                toggle = false;
-                GuiToggle(tabBounds, text[i], &toggle);
-                if (toggle) *active = i;
+                    if (mousePosition.x <= (textBounds.x + (widthToMouseX + glyphWidth/2)))
+                    {
+                        mouseCursor.x = textBounds.x + widthToMouseX;
+                        mouseCursorIndex = i;
+                        break;
+                    }
+
+                    widthToMouseX += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                }
+
+                // Check if mouse cursor is at the last position
+                int textEndWidth = GuiGetTextWidth(text + textIndexOffset);
+                if (GUI_POINTER_POSITION.x >= (textBounds.x + textEndWidth - glyphWidth/2))
+                {
+                    mouseCursor.x = textBounds.x + textEndWidth;
+                    mouseCursorIndex = textLength;
+                }
+
+                // Place cursor at required index on mouse click
+                if ((mouseCursor.x >= 0) && GUI_BUTTON_PRESSED)
+                {
+                    cursor.x = mouseCursor.x;
+                    textBoxCursorIndex = mouseCursorIndex;
+                }
             }
+            else mouseCursor.x = -1;
 
-            // Close tab with middle mouse button pressed
-            if (CheckCollisionPointRec(GUI_POINTER_POSITION, tabBounds) && GUI_BUTTON_PRESSED_MID) result = RESULT_TAB_CLOSE;
+            // Recalculate cursor position.y depending on textBoxCursorIndex
+            cursor.x = bounds.x + GuiGetStyle(TEXTBOX, TEXT_PADDING) + GuiGetTextWidth(text + textIndexOffset) - GuiGetTextWidth(text + textBoxCursorIndex) + GuiGetStyle(DEFAULT, TEXT_SPACING);
+            //if (multiline) cursor.y = GetTextLines()
 
-            GuiSetStyle(TOGGLE, TEXT_PADDING, textPadding);
-            GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, textAlignment);
+            // Finish text editing on ENTER or mouse click outside bounds
+            if ((!multiline && GUI_KEY_PRESSED(KEY_ENTER)) ||
+                (!CheckCollisionPointRec(mousePosition, bounds) && GUI_BUTTON_PRESSED))
+            {
+                textBoxCursorIndex = 0;     // GLOBAL: Reset the shared cursor index
+                autoCursorCounter = 0;      // GLOBAL: Reset counter for repeated keystrokes
 
-            if (GuiGetStyle(TABBAR, TAB_CLOSE_BUTTON))
+                //*editMode = false;
+                result = RESULT_PRESSED;
+            }
+        }
+        else
+        {
+            if (GuiCheckHover(mousePosition, bounds))
             {
-                // Draw tab close button
-                // NOTE: Only draw close button for current tab: if (CheckCollisionPointRec(mousePosition, tabBounds))
-                int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-                int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-                GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-                GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-#if defined(RAYGUI_NO_ICONS)
-                if (GuiButton(RAYGUI_CLITERAL(Rectangle){ tabBounds.x + tabBounds.width - 14 - 5, tabBounds.y + 5, 14, 14 }, "x")) result = RESULT_TAB_CLOSE;
-#else
-                if (GuiButton(RAYGUI_CLITERAL(Rectangle){ tabBounds.x + tabBounds.width - 14 - 5, tabBounds.y + 5, 14, 14 },
-                    GuiIconText(ICON_CROSS_SMALL, NULL))) result = RESULT_TAB_CLOSE;
-#endif
-                GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
-                GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
+                state = STATE_FOCUSED;
+
+                if (GUI_BUTTON_PRESSED)
+                {
+                    textBoxCursorIndex = textLength;   // GLOBAL: Place cursor index to the end of current text
+                    autoCursorCounter = 0;             // GLOBAL: Reset counter for repeated keystrokes
+
+                    //*editMode = true;
+                    result = RESULT_PRESSED;
+                }
             }
         }
     }
+    //--------------------------------------------------------------------
 
-    // Draw tab-bar bottom line
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, 1 }, 0, BLANK, GetColor(GuiGetStyle(TABBAR, BORDER_COLOR_NORMAL)));
+    // Draw control
     //--------------------------------------------------------------------
+    if (state == STATE_PRESSED)
+    {
+        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_PRESSED)));
+    }
+    else if (state == STATE_DISABLED)
+    {
+        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_DISABLED)));
+    }
+    else GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), BLANK);
 
-    // NOTE: In case of tab close result, consider focused tab
-    if ((result != RESULT_TAB_CLOSE) && (prevActive != *active)) result = RESULT_CHANGED;
+    // Draw text considering index offset if required
+    // NOTE: Text index offset depends on cursor position
+    GuiDrawText(text + textIndexOffset, textBounds, GuiGetStyle(TEXTBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TEXTBOX, TEXT + (state*3))));
+
+    // Draw cursor
+    if (editMode && !GuiGetStyle(TEXTBOX, TEXT_READONLY))
+    {
+        //if (autoCursorMode || ((blinkCursorFrameCounter/40)%2 == 0))
+        GuiDrawRectangle(cursor, 0, BLANK, GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)));
+
+        // Draw mouse position cursor (if required)
+        if (mouseCursor.x >= 0) GuiDrawRectangle(mouseCursor, 0, BLANK, GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)));
+    }
+    else if (state == STATE_FOCUSED) GuiTooltip(bounds);
+    //--------------------------------------------------------------------
 
+    RAYGUI_PROFILE_END("GuiTextBox");
     return result;
 }
 
-// Color Panel control
-int GuiColorPanel(Rectangle bounds, const char *text, Color *color)
+/*
+// Text Box control with multiple lines and word-wrap
+// NOTE: This text-box is readonly, no editing supported by default
+bool GuiTextBoxMulti(Rectangle bounds, char *text, int textSize, bool editMode)
 {
-    int result = RESULT_NONE;
+    bool pressed = false;
 
-    Vector3 vcolor = { (float)color->r/255.0f, (float)color->g/255.0f, (float)color->b/255.0f };
-    Vector3 hsv = ConvertRGBtoHSV(vcolor);
-    Vector3 prevHsv = hsv; // NOTE: Workaround to see if GuiColorPanelHSV() modifies the hsv
+    GuiSetStyleTemp(TEXTBOX, TEXT_READONLY, 1);
+    GuiSetStyleTemp(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_WORD);   // WARNING: If wrap mode enabled, text editing is not supported
+    GuiSetStyleTemp(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_TOP);
 
-    result = GuiColorPanelHSV(bounds, text, &hsv);
+    // TODO: Implement methods to calculate cursor position properly
+    pressed = GuiTextBox(bounds, text, textSize, editMode);
 
-    // Check if the hsv was changed, only then change the color
-    // This is required, because the Color->HSV->Color conversion has precision errors
-    // Thus the assignment from HSV to Color should only be made, if the HSV has a new user-entered value
-    // Otherwise GuiColorPanel would often modify it's color without user input
-    if ((hsv.x != prevHsv.x) || (hsv.y != prevHsv.y) || (hsv.z != prevHsv.z))
-    {
-        Vector3 rgb = ConvertHSVtoRGB(hsv);
-        *color = RAYGUI_CLITERAL(Color){ (unsigned char)(255.0f*rgb.x), (unsigned char)(255.0f*rgb.y), (unsigned char)(255.0f*rgb.z), color->a };
-    }
+    GuiSetStyleTemp(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);
+    GuiSetStyleTemp(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_NONE);
+    GuiSetStyleTemp(TEXTBOX, TEXT_READONLY, 0);
 
-    return result;
+    return pressed;
 }
+*/
 
-// Color Bar Alpha control
-// NOTE: Returns alpha value normalized [0..1]
-int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
+// Spinner control, returns selected value
+int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
 {
-    #if !defined(RAYGUI_COLORBARALPHA_CHECKED_SIZE)
-        #define RAYGUI_COLORBARALPHA_CHECKED_SIZE   10
-    #endif
+    GuiID id = GuiGetControlID(bounds);
+    if (!editMode && GuiIsCulledText(bounds, (text != NULL), (text != NULL))) return 0;    // Control outside clip region, not processed
 
-    int result = RESULT_NONE;
+    RAYGUI_PROFILE_BEGIN("GuiSpinner");
+    GuiPushControlID(id);
+
+    int result = 1;
     GuiState state = guiState;
 
-    float prevAlpha = *alpha;
-    Rectangle selector = { (float)bounds.x + (*alpha)*bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT)/2,
-        (float)bounds.y - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW),
-        (float)GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT),
-        (float)bounds.height + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)*2 };
+    int tempValue = *value;
+
+    Rectangle valueBoxBounds = {
+        bounds.x + GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH) + GuiGetStyle(VALUEBOX, SPINNER_BUTTON_SPACING),
+        bounds.y,
+        bounds.width - 2*(GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH) + GuiGetStyle(VALUEBOX, SPINNER_BUTTON_SPACING)), bounds.height };
+    Rectangle leftButtonBound = { (float)bounds.x, (float)bounds.y, (float)GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH), (float)bounds.height };
+    Rectangle rightButtonBound = { (float)bounds.x + bounds.width - GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH), (float)bounds.y,
+        (float)GuiGetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH), (float)bounds.height };
+
+    Rectangle textBounds = { 0 };
+    if (text != NULL)
+    {
+        textBounds.width = (float)GuiGetTextWidthCached(id, 0, text) + 2;
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x + bounds.width + GuiGetStyle(VALUEBOX, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        if (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(VALUEBOX, TEXT_PADDING);
+    }
 
     // Update control
     //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked)
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
         Vector2 mousePoint = GUI_POINTER_POSITION;
 
-        if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
-        {
-            if (GUI_BUTTON_DOWN)
-            {
-                if (CHECK_BOUNDS_ID(bounds, guiControlExclusiveRec))
-                {
-                    state = STATE_PRESSED;
-
-                    *alpha = (mousePoint.x - bounds.x)/bounds.width;
-                    if (*alpha <= 0.0f) *alpha = 0.0f;
-                    if (*alpha >= 1.0f) *alpha = 1.0f;
-                }
-            }
-            else
-            {
-                guiControlExclusiveMode = false;
-                guiControlExclusiveRec = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
-            }
-        }
-        else if (CheckCollisionPointRec(mousePoint, bounds) || CheckCollisionPointRec(mousePoint, selector))
+        // Check spinner state
+        if (CheckCollisionPointRec(mousePoint, bounds))
         {
-            if (GUI_BUTTON_DOWN)
-            {
-                state = STATE_PRESSED;
-                guiControlExclusiveMode = true;
-                guiControlExclusiveRec = bounds; // Store bounds as an identifier when dragging starts
-
-                *alpha = (mousePoint.x - bounds.x)/bounds.width;
-                if (*alpha <= 0.0f) *alpha = 0.0f;
-                if (*alpha >= 1.0f) *alpha = 1.0f;
-                //selector.x = bounds.x + (int)(((alpha - 0)/(100 - 0))*(bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH))) - selector.width/2;
-            }
+            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
         }
     }
 
-    if (prevAlpha != *alpha) result = RESULT_CHANGED;
-    //--------------------------------------------------------------------
-
-    // Draw control
-    //--------------------------------------------------------------------
-    // Draw alpha bar: checked background
-    if (state != STATE_DISABLED)
+#if defined(RAYGUI_NO_ICONS)
+    if (GuiButton(leftButtonBound, "<")) tempValue--;
+    if (GuiButton(rightButtonBound, ">")) tempValue++;
+#else
+    if (GuiButton(leftButtonBound, GuiIconText(ICON_ARROW_LEFT_FILL, NULL))) tempValue--;
+    if (GuiButton(rightButtonBound, GuiIconText(ICON_ARROW_RIGHT_FILL, NULL))) tempValue++;
+#endif
+
+    if (!editMode)
     {
-        int checksX = (int)bounds.width/RAYGUI_COLORBARALPHA_CHECKED_SIZE;
-        int checksY = (int)bounds.height/RAYGUI_COLORBARALPHA_CHECKED_SIZE;
+        if (tempValue < minValue) tempValue = minValue;
+        if (tempValue > maxValue) tempValue = maxValue;
+    }
+    //--------------------------------------------------------------------
 
-        for (int x = 0; x < checksX; x++)
-        {
-            for (int y = 0; y < checksY; y++)
-            {
-                Rectangle check = { bounds.x + x*RAYGUI_COLORBARALPHA_CHECKED_SIZE, bounds.y + y*RAYGUI_COLORBARALPHA_CHECKED_SIZE, RAYGUI_COLORBARALPHA_CHECKED_SIZE, RAYGUI_COLORBARALPHA_CHECKED_SIZE };
-                GuiDrawRectangle(check, 0, BLANK, ((x + y)%2)? Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.4f) : Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.4f));
-            }
-        }
+    // Draw control
+    //--------------------------------------------------------------------
+    result = GuiValueBox(valueBoxBounds, NULL, &tempValue, minValue, maxValue, editMode);
 
-        DrawRectangleGradientEx(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
-    }
-    else DrawRectangleGradientEx(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
+    // Draw value selector custom buttons
+    // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
+    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
+    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiSetStyleTemp(BUTTON, BORDER_WIDTH, GuiGetStyle(VALUEBOX, BORDER_WIDTH));
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 
-    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
+    GuiSetStyleTemp(BUTTON, BORDER_WIDTH, tempBorderWidth);
 
-    // Draw alpha bar: selector
-    GuiDrawRectangle(selector, 0, BLANK, GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)));
+    // Draw text label if provided
+    GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
     //--------------------------------------------------------------------
 
+    //if (tempValue != *value) result = RESULT_CHANGED; // WARNING: Stops editing
+
+    *value = tempValue;
+
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiSpinner");
     return result;
 }
 
-// Color Bar Hue control
-// Returns hue value normalized [0..1]
-// NOTE: Other similar bars (for reference):
-//      Color GuiColorBarSat() [WHITE->color]
-//      Color GuiColorBarValue() [BLACK->color], HSV/HSL
-//      float GuiColorBarLuminance() [BLACK->WHITE]
-int GuiColorBarHue(Rectangle bounds, const char *text, float *hue)
+// Value Box control, updates input text with numbers
+int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
 {
+    #if !defined(RAYGUI_VALUEBOX_MAX_CHARS)
+        #define RAYGUI_VALUEBOX_MAX_CHARS  32
+    #endif
+
+    GuiID id = GuiGetControlID(bounds);
+    if (!editMode && GuiIsCulledText(bounds, (text != NULL), (text != NULL))) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiValueBox");
+
     int result = RESULT_NONE;
     GuiState state = guiState;
 
-    float prevHue = *hue;
-    Rectangle selector = { (float)bounds.x - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (float)bounds.y + (*hue)/360.0f*bounds.height - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT)/2, (float)bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)*2, (float)GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT) };
+    //int prevValue = *value;
+    char textValue[RAYGUI_VALUEBOX_MAX_CHARS + 1] = { 0 };
+    snprintf(textValue, RAYGUI_VALUEBOX_MAX_CHARS + 1, "%i", *value);
+
+    Rectangle textBounds = { 0 };
+    if (text != NULL)
+    {
+        textBounds.width = (float)GuiGetTextWidthCached(id, 0, text) + 2;
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x + bounds.width + GuiGetStyle(VALUEBOX, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        if (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(VALUEBOX, TEXT_PADDING);
+    }
 
     // Update control
     //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked)
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
         Vector2 mousePoint = GUI_POINTER_POSITION;
+        bool valueHasChanged = false;
 
-        if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
+        if (editMode)
         {
-            if (GUI_BUTTON_DOWN)
+            state = STATE_PRESSED;
+
+            int keyCount = (int)strlen(textValue);
+
+            // Add or remove minus symbol
+            if (GUI_KEY_PRESSED(KEY_MINUS))
             {
-                if (CHECK_BOUNDS_ID(bounds, guiControlExclusiveRec))
+                if (textValue[0] == '-')
                 {
-                    state = STATE_PRESSED;
+                    for (int i = 0 ; i < keyCount; i++) textValue[i] = textValue[i + 1];
 
-                    *hue = (mousePoint.y - bounds.y)*360/bounds.height;
-                    if (*hue <= 0.0f) *hue = 0.0f;
-                    if (*hue >= 359.0f) *hue = 359.0f;
+                    keyCount--;
+                    valueHasChanged = true;
+                }
+                else if (keyCount < RAYGUI_VALUEBOX_MAX_CHARS)
+                {
+                    if (keyCount == 0)
+                    {
+                        textValue[0] = '0';
+                        textValue[1] = '\0';
+                        keyCount++;
+                    }
+
+                    for (int i = keyCount ; i > -1; i--) textValue[i + 1] = textValue[i];
+
+                    textValue[0] = '-';
+                    keyCount++;
+                    valueHasChanged = true;
                 }
             }
-            else
+
+            // Add new digit to text value
+            if ((keyCount >= 0) && (keyCount < RAYGUI_VALUEBOX_MAX_CHARS) && (GuiGetTextWidth(textValue) < bounds.width))
             {
-                guiControlExclusiveMode = false;
-                guiControlExclusiveRec = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
+                int key = GUI_INPUT_KEY;
+
+                // Only allow keys in range [48..57]
+                if ((key >= 48) && (key <= 57))
+                {
+                    textValue[keyCount] = (char)key;
+                    keyCount++;
+                    valueHasChanged = true;
+                }
             }
-        }
-        else if (CheckCollisionPointRec(mousePoint, bounds) || CheckCollisionPointRec(mousePoint, selector))
-        {
-            if (GUI_BUTTON_DOWN)
+
+            // Delete text
+            if ((keyCount > 0) && GUI_KEY_PRESSED(KEY_BACKSPACE))
             {
-                state = STATE_PRESSED;
-                guiControlExclusiveMode = true;
-                guiControlExclusiveRec = bounds; // Store bounds as an identifier when dragging starts
+                keyCount--;
+                textValue[keyCount] = '\0';
+                valueHasChanged = true;
+            }
 
-                *hue = (mousePoint.y - bounds.y)*360/bounds.height;
-                if (*hue <= 0.0f) *hue = 0.0f;
-                if (*hue >= 359.0f) *hue = 359.0f;
+            if (valueHasChanged) *value = TextToInteger(textValue);
 
-            }
-            else state = STATE_FOCUSED;
+            // NOTE: Values are not clamped until user input finishes
+            //if (*value > maxValue) *value = maxValue;
+            //else if (*value < minValue) *value = minValue;
 
-            /*if (GUI_KEY_DOWN(KEY_UP))
+            if ((GUI_KEY_PRESSED(KEY_ENTER) || GUI_KEY_PRESSED(KEY_KP_ENTER)) || (!CheckCollisionPointRec(mousePoint, bounds) && GUI_BUTTON_PRESSED))
             {
-                hue -= 2.0f;
-                if (hue <= 0.0f) hue = 0.0f;
+                if (*value > maxValue) *value = maxValue;
+                else if (*value < minValue) *value = minValue;
+
+                result = RESULT_PRESSED;
             }
-            else if (GUI_KEY_DOWN(KEY_DOWN))
+        }
+        else
+        {
+            if (*value > maxValue) *value = maxValue;
+            else if (*value < minValue) *value = minValue;
+
+            if (GuiCheckHover(mousePoint, bounds))
             {
-                hue += 2.0f;
-                if (hue >= 360.0f) hue = 360.0f;
-            }*/
+                state = STATE_FOCUSED;
+
+                if (GUI_BUTTON_PRESSED) result = RESULT_PRESSED;
+            }
         }
     }
 
-    if (prevHue != *hue) result = RESULT_CHANGED;
+    //if (prevValue != *value) result = RESULT_CHANGED;
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    if (state != STATE_DISABLED)
-    {
-        // Draw hue bar:color bars
-        // NOTE: Using DrawRectangleGradientEx(bounds, color1, color2, color2, color1);
-        DrawRectangleGradientEx(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, bounds.width, bounds.height/6.0f }, 
-            Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha),
-            Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha));
-        DrawRectangleGradientEx(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 1*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
-            Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha),
-            Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha));
-        DrawRectangleGradientEx(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 2*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
-            Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha),
-            Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha));
-        DrawRectangleGradientEx(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 3*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
-            Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha),
-            Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha));
-        DrawRectangleGradientEx(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 4*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
-            Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha),
-            Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha));
-        DrawRectangleGradientEx(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 5*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
-            Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha),
-            Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha));
-    }
-    else
+    Color baseColor = BLANK;
+    if (state == STATE_PRESSED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_PRESSED));
+    else if (state == STATE_DISABLED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_DISABLED));
+
+    GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
+    GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(VALUEBOX, TEXT + (state*3))));
+
+    // Draw cursor rectangle
+    if (editMode)
     {
-        DrawRectangleGradientEx(bounds,
-            Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha),
-            Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha));
+        // NOTE: ValueBox internal text is always centered
+        Rectangle cursor = { bounds.x + GuiGetTextWidth(textValue)/2 + bounds.width/2 + 1,
+            bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH) + 2,
+            2, bounds.height - GuiGetStyle(TEXTBOX, BORDER_WIDTH)*2 - 4 };
+        if (cursor.height > bounds.height) cursor.height = bounds.height - GuiGetStyle(TEXTBOX, BORDER_WIDTH)*2;
+        GuiDrawRectangle(cursor, 0, BLANK, GetColor(GuiGetStyle(VALUEBOX, BORDER_COLOR_PRESSED)));
     }
 
-    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
-
-    // Draw hue bar: selector
-    GuiDrawRectangle(selector, 0, BLANK, GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)));
+    // Draw text label if provided
+    GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
     //--------------------------------------------------------------------
 
+    RAYGUI_PROFILE_END("GuiValueBox");
     return result;
 }
 
-// Color Picker control
-// NOTE: It's divided in multiple controls:
-//      Color GuiColorPanel(Rectangle bounds, Color color)
-//      float GuiColorBarAlpha(Rectangle bounds, float alpha)
-//      float GuiColorBarHue(Rectangle bounds, float value)
-// NOTE: bounds define GuiColorPanel() size
-// NOTE: this picker converts RGB to HSV, which can cause the Hue control to jump. If you have this problem, consider using the HSV variant instead
-int GuiColorPicker(Rectangle bounds, const char *text, Color *color)
+// Floating point Value Box control, updates input val_str with numbers
+int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float *value, bool editMode)
 {
-    int result = RESULT_NONE;
-
-    Color temp = { 200, 0, 0, 255 };
-    if (color == NULL) color = &temp;
-
-    result = GuiColorPanel(bounds, NULL, color);
-
-    Rectangle boundsHue = { (float)bounds.x + bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_PADDING), (float)bounds.y, (float)GuiGetStyle(COLORPICKER, HUEBAR_WIDTH), (float)bounds.height };
-    //Rectangle boundsAlpha = { bounds.x, bounds.y + bounds.height + GuiGetStyle(COLORPICKER, BARS_PADDING), bounds.width, GuiGetStyle(COLORPICKER, BARS_THICK) };
-
-    // NOTE: this conversion can cause low hue-resolution, if the r, g and b value are very similar, which causes the hue bar to shift around when only the GuiColorPanel is used
-    Vector3 hsv = ConvertRGBtoHSV(RAYGUI_CLITERAL(Vector3){ (*color).r/255.0f, (*color).g/255.0f, (*color).b/255.0f });
-
-    result = GuiColorBarHue(boundsHue, NULL, &hsv.x);
-
-    //color.a = (unsigned char)(GuiColorBarAlpha(boundsAlpha, (float)color.a/255.0f)*255.0f);
-    Vector3 rgb = ConvertHSVtoRGB(hsv);
+    #if !defined(RAYGUI_VALUEBOX_MAX_CHARS)
+        #define RAYGUI_VALUEBOX_MAX_CHARS  32
+    #endif
 
-    *color = RAYGUI_CLITERAL(Color){ (unsigned char)roundf(rgb.x*255.0f), (unsigned char)roundf(rgb.y*255.0f), (unsigned char)roundf(rgb.z*255.0f), (*color).a };
+    GuiID id = GuiGetControlID(bounds);
+    if (!editMode && GuiIsCulledText(bounds, (text != NULL), (text != NULL))) return 0;    // Control outside clip region, not processed
 
-    return result;
-}
+    RAYGUI_PROFILE_BEGIN("GuiValueBoxFloat");
 
-// Color Picker control that avoids conversion to RGB and back to HSV on each call, thus avoiding jittering
-// The user can call ConvertHSVtoRGB() to convert *colorHsv value to RGB
-// NOTE: It's divided in multiple controls:
-//      int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
-//      int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
-//      float GuiColorBarHue(Rectangle bounds, float value)
-// NOTE: bounds define GuiColorPanelHSV() size
-int GuiColorPickerHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
-{
     int result = RESULT_NONE;
+    GuiState state = guiState;
 
-    Vector3 tempHsv = { 0 };
+    //float prevValue = *value;
 
-    if (colorHsv == NULL)
+    Rectangle textBounds = { 0 };
+    if (text != NULL)
     {
-        const Vector3 tempColor = { 200.0f/255.0f, 0.0f, 0.0f };
-        tempHsv = ConvertRGBtoHSV(tempColor);
-        colorHsv = &tempHsv;
+        textBounds.width = (float)GuiGetTextWidthCached(id, 0, text) + 2;
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x + bounds.width + GuiGetStyle(VALUEBOX, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        if (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(VALUEBOX, TEXT_PADDING);
     }
 
-    result = GuiColorPanelHSV(bounds, NULL, colorHsv);
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
 
-    Rectangle boundsHue = { (float)bounds.x + bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_PADDING), (float)bounds.y, (float)GuiGetStyle(COLORPICKER, HUEBAR_WIDTH), (float)bounds.height };
+        bool valueHasChanged = false;
 
-    if (result == RESULT_NONE) result = GuiColorBarHue(boundsHue, NULL, &colorHsv->x);
+        if (editMode)
+        {
+            state = STATE_PRESSED;
+
+            int keyCount = (int)strlen(textValue);
+
+            // Add or remove minus symbol
+            if (GUI_KEY_PRESSED(KEY_MINUS))
+            {
+                if (textValue[0] == '-')
+                {
+                    for (int i = 0; i < keyCount; i++) textValue[i] = textValue[i + 1];
+
+                    keyCount--;
+                    valueHasChanged = true;
+                }
+                else if (keyCount < (RAYGUI_VALUEBOX_MAX_CHARS - 1))
+                {
+                    if (keyCount == 0)
+                    {
+                        textValue[0] = '0';
+                        textValue[1] = '\0';
+                        keyCount++;
+                    }
+
+                    for (int i = keyCount; i > -1; i--) textValue[i + 1] = textValue[i];
+
+                    textValue[0] = '-';
+                    keyCount++;
+                    valueHasChanged = true;
+                }
+            }
+
+            // Only allow keys in range [48..57]
+            if (keyCount < RAYGUI_VALUEBOX_MAX_CHARS)
+            {
+                if (GuiGetTextWidth(textValue) < bounds.width)
+                {
+                    int key = GUI_INPUT_KEY;
+                    if (((key >= 48) && (key <= 57)) ||
+                        (key == '.') ||
+                        ((keyCount == 0) && (key == '+')) ||  // NOTE: Sign can only be in first position
+                        ((keyCount == 0) && (key == '-')))
+                    {
+                        textValue[keyCount] = (char)key;
+                        keyCount++;
+
+                        valueHasChanged = true;
+                    }
+                }
+            }
+
+            // Pressed backspace
+            if (GUI_KEY_PRESSED(KEY_BACKSPACE))
+            {
+                if (keyCount > 0)
+                {
+                    keyCount--;
+                    textValue[keyCount] = '\0';
+                    valueHasChanged = true;
+                }
+            }
 
+            if (valueHasChanged) *value = TextToFloat(textValue);
+
+            if ((GUI_KEY_PRESSED(KEY_ENTER) || GUI_KEY_PRESSED(KEY_KP_ENTER)) ||
+                (!CheckCollisionPointRec(mousePoint, bounds) && GUI_BUTTON_PRESSED)) result = RESULT_PRESSED;
+        }
+        else
+        {
+            if (GuiCheckHover(mousePoint, bounds))
+            {
+                state = STATE_FOCUSED;
+
+                if (GUI_BUTTON_PRESSED) result = RESULT_PRESSED;
+            }
+        }
+    }
+
+    //if (prevValue != *value) result = RESULT_CHANGED;
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    Color baseColor = BLANK;
+    if (state == STATE_PRESSED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_PRESSED));
+    else if (state == STATE_DISABLED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_DISABLED));
+
+    GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
+    GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(VALUEBOX, TEXT + (state*3))));
+
+    // Draw cursor
+    if (editMode)
+    {
+        // NOTE: ValueBox internal text is always centered
+        Rectangle cursor = {bounds.x + GuiGetTextWidth(textValue)/2 + bounds.width/2 + 1,
+                            bounds.y + 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), 4,
+                            bounds.height - 4*GuiGetStyle(VALUEBOX, BORDER_WIDTH)};
+        GuiDrawRectangle(cursor, 0, BLANK, GetColor(GuiGetStyle(VALUEBOX, BORDER_COLOR_PRESSED)));
+    }
+
+    // Draw text label if provided
+    GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT,
+                GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    //--------------------------------------------------------------------
+
+    RAYGUI_PROFILE_END("GuiValueBoxFloat");
     return result;
 }
 
-// Color Panel control - HSV variant
-int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
+// Slider control with pro parameters
+// NOTE: Other GuiSlider*() controls use this one
+int GuiSlider(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue)
 {
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulledText(bounds, (textLeft != NULL), (textRight != NULL))) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiSlider");
+
     int result = RESULT_NONE;
     GuiState state = guiState;
 
-    Vector3 prevColorHsv = *colorHsv;
-    Vector2 pickerSelector = { 0 };
-    const Color colWhite = { 255, 255, 255, 255 };
-    const Color colBlack = { 0, 0, 0, 255 };
+    float temp = (maxValue - minValue)/2.0f;
+    if (value == NULL) value = &temp;
 
-    pickerSelector.x = bounds.x + (float)colorHsv->y*bounds.width;            // HSV: Saturation
-    pickerSelector.y = bounds.y + (1.0f - (float)colorHsv->z)*bounds.height;  // HSV: Value
+    float prevValue = *value;
 
-    Vector3 maxHue = { colorHsv->x, 1.0f, 1.0f };
-    Vector3 rgbHue = ConvertHSVtoRGB(maxHue);
-    Color maxHueCol = { (unsigned char)(255.0f*rgbHue.x), (unsigned char)(255.0f*rgbHue.y), (unsigned char)(255.0f*rgbHue.z), 255 };
+    int sliderWidth = GuiGetStyle(SLIDER, SLIDER_WIDTH);
+
+    Rectangle slider = { bounds.x, bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH) + GuiGetStyle(SLIDER, SLIDER_PADDING),
+                         0, bounds.height - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - 2*GuiGetStyle(SLIDER, SLIDER_PADDING) };
 
     // Update control
     //--------------------------------------------------------------------
@@ -4281,1989 +5921,6310 @@ int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
         {
             if (GUI_BUTTON_DOWN)
             {
-                if (CHECK_BOUNDS_ID(bounds, guiControlExclusiveRec))
+                if (id == guiControlExclusiveId)
                 {
-                    pickerSelector = mousePoint;
-
-                    if (pickerSelector.x < bounds.x) pickerSelector.x = bounds.x;
-                    if (pickerSelector.x > bounds.x + bounds.width) pickerSelector.x = bounds.x + bounds.width;
-                    if (pickerSelector.y < bounds.y) pickerSelector.y = bounds.y;
-                    if (pickerSelector.y > bounds.y + bounds.height) pickerSelector.y = bounds.y + bounds.height;
-
-                    // Calculate color from picker
-                    Vector2 colorPick = { pickerSelector.x - bounds.x, pickerSelector.y - bounds.y };
-
-                    colorPick.x /= (float)bounds.width; // Get normalized value on x
-                    colorPick.y /= (float)bounds.height; // Get normalized value on y
-
-                    colorHsv->y = colorPick.x;
-                    colorHsv->z = 1.0f - colorPick.y;
+                    state = STATE_PRESSED;
+                    // Get equivalent value and slider position from mousePosition.x
+                    *value = (maxValue - minValue)*((mousePoint.x - bounds.x - sliderWidth/2)/(bounds.width - sliderWidth)) + minValue;
                 }
             }
             else
             {
                 guiControlExclusiveMode = false;
-                guiControlExclusiveRec = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
+                guiControlExclusiveId = 0;
             }
         }
-        else if (CheckCollisionPointRec(mousePoint, bounds))
+        else if (GuiCheckHover(mousePoint, bounds))
         {
             if (GUI_BUTTON_DOWN)
             {
                 state = STATE_PRESSED;
                 guiControlExclusiveMode = true;
-                guiControlExclusiveRec = bounds;
-                pickerSelector = mousePoint;
-
-                // Calculate color from picker
-                Vector2 colorPick = { pickerSelector.x - bounds.x, pickerSelector.y - bounds.y };
+                guiControlExclusiveId = id; // Store control id when dragging starts
 
-                colorPick.x /= (float)bounds.width;     // Get normalized value on x
-                colorPick.y /= (float)bounds.height;    // Get normalized value on y
-
-                colorHsv->y = colorPick.x;
-                colorHsv->z = 1.0f - colorPick.y;
+                if (!CheckCollisionPointRec(mousePoint, slider))
+                {
+                    // Get equivalent value and slider position from mousePosition.x
+                    *value = (maxValue - minValue)*((mousePoint.x - bounds.x - sliderWidth/2)/(bounds.width - sliderWidth)) + minValue;
+                }
             }
             else state = STATE_FOCUSED;
         }
+
+        if (*value > maxValue) *value = maxValue;
+        else if (*value < minValue) *value = minValue;
     }
 
-    if ((prevColorHsv.x != colorHsv->x) ||
-        (prevColorHsv.y != colorHsv->y) ||
-        (prevColorHsv.z != colorHsv->z)) result = RESULT_CHANGED;
+    // Slider bar limits check
+    float sliderValue = (((*value - minValue)/(maxValue - minValue))*(bounds.width - sliderWidth - 2*GuiGetStyle(SLIDER, BORDER_WIDTH)));
+    if (sliderWidth > 0)        // Slider
+    {
+        slider.x += sliderValue;
+        slider.width = (float)sliderWidth;
+        if (slider.x <= (bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH))) slider.x = bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH);
+        else if ((slider.x + slider.width) >= (bounds.x + bounds.width)) slider.x = bounds.x + bounds.width - slider.width - GuiGetStyle(SLIDER, BORDER_WIDTH);
+    }
+    else if (sliderWidth == 0)  // SliderBar
+    {
+        slider.x += GuiGetStyle(SLIDER, BORDER_WIDTH);
+        slider.width = sliderValue;
+        if (slider.width > bounds.width) slider.width = bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH);
+    }
+
+    if (prevValue != *value) result = RESULT_CHANGED;
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    if (state != STATE_DISABLED)
+    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(SLIDER, BORDER + (state*3))), GetColor(GuiGetStyle(SLIDER, (state != STATE_DISABLED)?  BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)));
+
+    // Draw slider internal bar (depends on state)
+    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
+    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_FOCUSED)));
+    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_PRESSED)));
+    else if (state == STATE_DISABLED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_DISABLED)));
+
+    // Draw left/right text if provided
+    if (textLeft != NULL)
     {
-        DrawRectangleGradientEx(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
-        DrawRectangleGradientEx(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
+        Rectangle textBounds = { 0 };
+        textBounds.width = (float)GuiGetTextWidthCached(id, 0, textLeft);
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x - textBounds.width - GuiGetStyle(SLIDER, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        // Draw color picker: selector
-        Rectangle selector = { pickerSelector.x - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, pickerSelector.y - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE) };
-        GuiDrawRectangle(selector, 0, BLANK, colWhite);
+        GuiDrawText(textLeft, textBounds, TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
     }
-    else
+
+    if (textRight != NULL)
     {
-        DrawRectangleGradientEx(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
-    }
+        Rectangle textBounds = { 0 };
+        textBounds.width = (float)GuiGetTextWidthCached(id, 1, textRight);
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x + bounds.width + GuiGetStyle(SLIDER, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+        GuiDrawText(textRight, textBounds, TEXT_ALIGN_LEFT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    }
     //--------------------------------------------------------------------
 
+    RAYGUI_PROFILE_END("GuiSlider");
     return result;
 }
 
-// Message Box control
-// NOTE: Button pressed is returned through btnActive parameter, 0 for window close button
-int GuiMessageBox(Rectangle bounds, const char *title, const char *message, const char *btnText, int *btnActive)
+// Slider Bar control extended, returns selected value
+int GuiSliderBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue)
 {
-    #if !defined(RAYGUI_MESSAGEBOX_BUTTON_HEIGHT)
-        #define RAYGUI_MESSAGEBOX_BUTTON_HEIGHT    24
-    #endif
-    #if !defined(RAYGUI_MESSAGEBOX_BUTTON_PADDING)
-        #define RAYGUI_MESSAGEBOX_BUTTON_PADDING   12
-    #endif
+    if (GuiIsCulledText(bounds, (textLeft != NULL), (textRight != NULL)))    // Control outside clip region, not processed
+    {
+        GuiGetControlID(bounds);    // Id taken by GuiSlider() when processed, keeps controls sequence
+        return 0;
+    }
+
+    RAYGUI_PROFILE_BEGIN("GuiSliderBar");
 
     int result = RESULT_NONE;
+    int preSliderWidth = GuiGetStyle(SLIDER, SLIDER_WIDTH);
+    GuiSetStyleTemp(SLIDER, SLIDER_WIDTH, 0);
+    result = GuiSlider(bounds, textLeft, textRight, value, minValue, maxValue);
+    GuiSetStyleTemp(SLIDER, SLIDER_WIDTH, preSliderWidth);
 
-    int buttonCount = 0;
-    char **btnTextList = GuiTextSplit(btnText, ';', &buttonCount);
-    Rectangle buttonBounds = { 0 };
-    buttonBounds.x = bounds.x + RAYGUI_MESSAGEBOX_BUTTON_PADDING;
-    buttonBounds.y = bounds.y + bounds.height - RAYGUI_MESSAGEBOX_BUTTON_HEIGHT - RAYGUI_MESSAGEBOX_BUTTON_PADDING;
-    buttonBounds.width = (bounds.width - RAYGUI_MESSAGEBOX_BUTTON_PADDING*(buttonCount + 1))/buttonCount;
-    buttonBounds.height = RAYGUI_MESSAGEBOX_BUTTON_HEIGHT;
+    RAYGUI_PROFILE_END("GuiSliderBar");
+    return result;
+}
 
-    //int textWidth = GuiGetTextWidth(message) + 2;
+// Progress Bar control extended, shows current progress value
+int GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue)
+{
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulledText(bounds, (textLeft != NULL), (textRight != NULL))) return 0;    // Control outside clip region, not processed
 
-    Rectangle textBounds = { 0 };
-    textBounds.x = bounds.x + RAYGUI_MESSAGEBOX_BUTTON_PADDING;
-    textBounds.y = bounds.y + RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT + RAYGUI_MESSAGEBOX_BUTTON_PADDING;
-    textBounds.width = bounds.width - RAYGUI_MESSAGEBOX_BUTTON_PADDING*2;
-    textBounds.height = bounds.height - RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 3*RAYGUI_MESSAGEBOX_BUTTON_PADDING - RAYGUI_MESSAGEBOX_BUTTON_HEIGHT;
+    RAYGUI_PROFILE_BEGIN("GuiProgressBar");
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (GuiWindowBox(bounds, title) == RESULT_PRESSED)
-    {
-        *btnActive = 0;
-        result = RESULT_PRESSED;
-    }
+    int result = RESULT_NONE;
+    GuiState state = guiState;
 
-    int prevTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-    GuiLabel(textBounds, message);
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, prevTextAlignment);
+    float temp = (maxValue - minValue)/2.0f;
+    if (value == NULL) value = &temp;
+    float prevValue = *value;
 
-    prevTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-
-    for (int i = 0; i < buttonCount; i++)
-    {
-        if (GuiButton(buttonBounds, btnTextList[i]))
-        {
-            *btnActive = i + 1;
-            result = RESULT_PRESSED;
-        }
-        buttonBounds.x += (buttonBounds.width + RAYGUI_MESSAGEBOX_BUTTON_PADDING);
-    }
+    // Progress bar
+    Rectangle progress = { bounds.x + GuiGetStyle(PROGRESSBAR, BORDER_WIDTH),
+                           bounds.y + GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) + GuiGetStyle(PROGRESSBAR, PROGRESS_PADDING), 0,
+                           bounds.height - GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) - 2*GuiGetStyle(PROGRESSBAR, PROGRESS_PADDING) -1 };
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, prevTextAlignment);
+    // Update control
     //--------------------------------------------------------------------
+    if (*value > maxValue) *value = maxValue;
 
-    return result;
-}
-
-// Text Input Box control
-// NOTE: Button pressed is returned through btnActive parameter, 0 for window close button
-int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, char *text, int textSize, const char *btnText, int *btnActive, bool *secretViewActive)
-{
-    #if !defined(RAYGUI_TEXTINPUTBOX_BUTTON_HEIGHT)
-        #define RAYGUI_TEXTINPUTBOX_BUTTON_HEIGHT      24
-    #endif
-    #if !defined(RAYGUI_TEXTINPUTBOX_BUTTON_PADDING)
-        #define RAYGUI_TEXTINPUTBOX_BUTTON_PADDING     12
-    #endif
-    #if !defined(RAYGUI_TEXTINPUTBOX_HEIGHT)
-        #define RAYGUI_TEXTINPUTBOX_HEIGHT             26
-    #endif
-
-    int result = RESULT_NONE;
-
-    // Used to enable text edit mode
-    // WARNING: No more than one GuiTextInputBox() should be open at the same time
-    static bool textEditMode = false;
-
-    int buttonCount = 0;
-    char **btnTextList = GuiTextSplit(btnText, ';', &buttonCount);
-    Rectangle buttonBounds = { 0 };
-    buttonBounds.x = bounds.x + RAYGUI_TEXTINPUTBOX_BUTTON_PADDING;
-    buttonBounds.y = bounds.y + bounds.height - RAYGUI_TEXTINPUTBOX_BUTTON_HEIGHT - RAYGUI_TEXTINPUTBOX_BUTTON_PADDING;
-    buttonBounds.width = (bounds.width - RAYGUI_TEXTINPUTBOX_BUTTON_PADDING*(buttonCount + 1))/buttonCount;
-    buttonBounds.height = RAYGUI_TEXTINPUTBOX_BUTTON_HEIGHT;
-
-    int messageInputHeight = (int)bounds.height - RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - GuiGetStyle(STATUSBAR, BORDER_WIDTH) - RAYGUI_TEXTINPUTBOX_BUTTON_HEIGHT - 2*RAYGUI_TEXTINPUTBOX_BUTTON_PADDING;
-
-    Rectangle textBounds = { 0 };
-    if (message != NULL)
-    {
-        int textSize = GuiGetTextWidth(message) + 2;
-
-        textBounds.x = bounds.x + bounds.width/2 - textSize/2;
-        textBounds.y = bounds.y + RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT + messageInputHeight/4 - (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
-        textBounds.width = (float)textSize;
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-    }
+    // WARNING: Working with floats could lead to rounding issues
+    if ((state != STATE_DISABLED)) progress.width = ((float)*value/(maxValue - minValue))*(bounds.width - 2*GuiGetStyle(PROGRESSBAR, BORDER_WIDTH));
 
-    Rectangle textBoxBounds = { 0 };
-    textBoxBounds.x = bounds.x + RAYGUI_TEXTINPUTBOX_BUTTON_PADDING;
-    textBoxBounds.y = bounds.y + RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - RAYGUI_TEXTINPUTBOX_HEIGHT/2;
-    if (message == NULL) textBoxBounds.y = bounds.y + 24 + RAYGUI_TEXTINPUTBOX_BUTTON_PADDING;
-    else textBoxBounds.y += (messageInputHeight/2 + messageInputHeight/4);
-    textBoxBounds.width = bounds.width - RAYGUI_TEXTINPUTBOX_BUTTON_PADDING*2;
-    textBoxBounds.height = RAYGUI_TEXTINPUTBOX_HEIGHT;
+    if (prevValue != *value) result = RESULT_CHANGED;
+    //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    if (GuiWindowBox(bounds, title) == RESULT_PRESSED)
-    {
-        *btnActive = 0;
-        result = RESULT_PRESSED;
-    }
-
-    // Draw message if available
-    if (message != NULL)
-    {
-        int prevTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-        GuiLabel(textBounds, message);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, prevTextAlignment);
-    }
-
-    int prevTextBoxAlignment = GuiGetStyle(TEXTBOX, TEXT_ALIGNMENT);
-    GuiSetStyle(TEXTBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-
-    if (secretViewActive != NULL)
+    if (state == STATE_DISABLED)
     {
-        static char stars[] = "****************";
-        if (GuiTextBox(RAYGUI_CLITERAL(Rectangle){ textBoxBounds.x, textBoxBounds.y, textBoxBounds.width - 4 - RAYGUI_TEXTINPUTBOX_HEIGHT, textBoxBounds.height },
-            ((*secretViewActive == 1) || textEditMode)? text : stars, textSize, textEditMode) == RESULT_PRESSED) textEditMode = !textEditMode;
-
-#if defined(RAYGUI_NO_ICONS)
-        GuiToggle(RAYGUI_CLITERAL(Rectangle){ textBoxBounds.x + textBoxBounds.width - RAYGUI_TEXTINPUTBOX_HEIGHT, textBoxBounds.y, RAYGUI_TEXTINPUTBOX_HEIGHT, RAYGUI_TEXTINPUTBOX_HEIGHT },
-            (*secretViewActive == 1)? "O" : "*", secretViewActive);
-#else
-        GuiToggle(RAYGUI_CLITERAL(Rectangle){ textBoxBounds.x + textBoxBounds.width - RAYGUI_TEXTINPUTBOX_HEIGHT, textBoxBounds.y, RAYGUI_TEXTINPUTBOX_HEIGHT, RAYGUI_TEXTINPUTBOX_HEIGHT },
-            (*secretViewActive == 1)? GuiIconText(ICON_EYE_ON, NULL) : GuiIconText(ICON_EYE_OFF, NULL), secretViewActive);
-#endif
+        GuiDrawRectangle(bounds, GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(PROGRESSBAR, BORDER + (state*3))), BLANK);
     }
     else
     {
-        if (GuiTextBox(textBoxBounds, text, textSize, textEditMode) == RESULT_PRESSED)
-            textEditMode = !textEditMode;
-    }
-
-    GuiSetStyle(TEXTBOX, TEXT_ALIGNMENT, prevTextBoxAlignment);
+        if (*value > minValue)
+        {
+            // Draw progress bar with colored border, more visual
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height - 2 }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
+        }
+        else GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height+GuiGetStyle(PROGRESSBAR, BORDER_WIDTH)-1 }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
 
-    int prevBtnTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+        if (*value >= maxValue) GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height+GuiGetStyle(PROGRESSBAR, BORDER_WIDTH)-1}, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
+        else
+        {
+            // Draw borders not yet reached by value
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.y, bounds.width - (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) - (int)progress.width - 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.y + bounds.height - 1, bounds.width - (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) - (int)progress.width - 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height+GuiGetStyle(PROGRESSBAR, BORDER_WIDTH)-1 }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
+        }
 
-    for (int i = 0; i < buttonCount; i++)
-    {
-        if (GuiButton(buttonBounds, btnTextList[i]))
+        // Draw slider internal progress bar (depends on state)
+        if (GuiGetStyle(PROGRESSBAR, PROGRESS_SIDE) == 0) // Left-->Right
         {
-            *btnActive = i + 1;
-            result = RESULT_PRESSED;
+            GuiDrawRectangle(progress, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BASE_COLOR_PRESSED)));
+        }
+        else // Right-->Left
+        {
+            progress.x = bounds.x + bounds.width - progress.width - GuiGetStyle(PROGRESSBAR, BORDER_WIDTH);
+            GuiDrawRectangle(progress, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BASE_COLOR_PRESSED)));
         }
+    }
+
+    // Draw left/right text if provided
+    if (textLeft != NULL)
+    {
+        Rectangle textBounds = { 0 };
+        textBounds.width = (float)GuiGetTextWidthCached(id, 0, textLeft);
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x - textBounds.width - GuiGetStyle(PROGRESSBAR, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        buttonBounds.x += (buttonBounds.width + RAYGUI_MESSAGEBOX_BUTTON_PADDING);
+        GuiDrawText(textLeft, textBounds, TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
     }
 
-    if (result == RESULT_PRESSED) textEditMode = false;
+    if (textRight != NULL)
+    {
+        Rectangle textBounds = { 0 };
+        textBounds.width = (float)GuiGetTextWidthCached(id, 1, textRight);
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x + bounds.width + GuiGetStyle(PROGRESSBAR, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, prevBtnTextAlignment);
+        GuiDrawText(textRight, textBounds, TEXT_ALIGN_LEFT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    }
     //--------------------------------------------------------------------
 
+    RAYGUI_PROFILE_END("GuiProgressBar");
     return result;
 }
 
-// Grid control
-// NOTE: Returns grid mouse-hover selected cell
-// About drawing lines at subpixel spacing, simple put, not easy solution:
-// REF: https://stackoverflow.com/questions/4435450/2d-opengl-drawing-lines-that-dont-exactly-fit-pixel-raster
-int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vector2 *mouseCell)
+// Status Bar control
+int GuiStatusBar(Rectangle bounds, const char *text)
 {
-    // Grid lines alpha amount
-    #if !defined(RAYGUI_GRID_ALPHA)
-        #define RAYGUI_GRID_ALPHA    0.15f
-    #endif
+    GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiStatusBar");
 
     int result = RESULT_NONE;
     GuiState state = guiState;
 
-    Vector2 mousePoint = GUI_POINTER_POSITION;
-    Vector2 currentMouseCell = { -1, -1 };
-
-    float spaceWidth = spacing/(float)subdivs;
-    int linesV = (int)(bounds.width/spaceWidth) + 1;
-    int linesH = (int)(bounds.height/spaceWidth) + 1;
-
-    int color = GuiGetStyle(DEFAULT, LINE_COLOR);
-
     // Update control
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        Vector2 mousePoint = GUI_POINTER_POSITION;
+
+        // Check checkbox state
+        if (GuiCheckHover(mousePoint, bounds))
         {
-            // NOTE: Cell values must be the upper left of the cell the mouse is in
-            currentMouseCell.x = floorf((mousePoint.x - bounds.x)/spacing);
-            currentMouseCell.y = floorf((mousePoint.y - bounds.y)/spacing);
+            //if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
+            //else state = STATE_FOCUSED;
 
-            result = RESULT_PRESSED;
+            if (GUI_BUTTON_RELEASED) result = RESULT_PRESSED;
         }
     }
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    if (state == STATE_DISABLED) color = GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED);
+    GuiDrawRectangle(bounds, GuiGetStyle(STATUSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(STATUSBAR, BORDER + (state*3))), GetColor(GuiGetStyle(STATUSBAR, BASE + (state*3))));
+    GuiDrawText(text, GetTextBounds(STATUSBAR, bounds), GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT), GetColor(GuiGetStyle(STATUSBAR, TEXT + (state*3))));
+    //--------------------------------------------------------------------
 
-    if (subdivs > 0)
+    RAYGUI_PROFILE_END("GuiStatusBar");
+    return result;
+}
+
+// Dummy rectangle control, intended for placeholding
+int GuiDummyRec(Rectangle bounds, const char *text)
+{
+    GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiDummyRec");
+
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        // Draw vertical grid lines
-        for (int i = 0; i < linesV; i++)
-        {
-            Rectangle lineV = { bounds.x + spacing*i/subdivs, bounds.y, 1, bounds.height + 1 };
-            GuiDrawRectangle(lineV, 0, BLANK, ((i%subdivs) == 0)? GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*4) : GuiFade(GetColor(color), RAYGUI_GRID_ALPHA));
-        }
+        Vector2 mousePoint = GUI_POINTER_POSITION;
 
-        // Draw horizontal grid lines
-        for (int i = 0; i < linesH; i++)
+        // Check button state
+        if (GuiCheckHover(mousePoint, bounds))
         {
-            Rectangle lineH = { bounds.x, bounds.y + spacing*i/subdivs, bounds.width + 1, 1 };
-            GuiDrawRectangle(lineH, 0, BLANK, ((i%subdivs) == 0)? GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*4) : GuiFade(GetColor(color), RAYGUI_GRID_ALPHA));
+            if (GUI_BUTTON_DOWN) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
+
+            if (GUI_BUTTON_RELEASED) result = RESULT_PRESSED;
         }
     }
+    //--------------------------------------------------------------------
 
-    if (mouseCell != NULL) *mouseCell = currentMouseCell;
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state != STATE_DISABLED)? BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)));
+    GuiDrawText(text, GetTextBounds(DEFAULT, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(BUTTON, (state != STATE_DISABLED)? TEXT_COLOR_NORMAL : TEXT_COLOR_DISABLED)));
+    //------------------------------------------------------------------
 
+    RAYGUI_PROFILE_END("GuiDummyRec");
     return result;
 }
 
-//----------------------------------------------------------------------------------
-// Tooltip management functions
-// NOTE: Tooltips requires some global variables: tooltipPtr
-//----------------------------------------------------------------------------------
-// Enable gui tooltips (global state)
-void GuiEnableTooltip(void) { guiTooltip = true; }
+// List View control
+int GuiListView(Rectangle bounds, const char *text, int *scrollIndex, int *active)
+{
+    RAYGUI_PROFILE_BEGIN("GuiListView");
 
-// Disable gui tooltips (global state)
-void GuiDisableTooltip(void) { guiTooltip = false; }
+    int result = RESULT_NONE;
+    int itemCount = 0;
+    char **items = NULL;
 
-// Set tooltip string
-void GuiSetTooltip(const char *tooltip) { guiTooltipPtr = tooltip; }
+    if (text != NULL) items = GuiTextSplit(text, ';', &itemCount);
 
-//----------------------------------------------------------------------------------
-// Styles loading functions
-//----------------------------------------------------------------------------------
+    result = GuiListViewEx(bounds, items, itemCount, scrollIndex, active, NULL);
 
-// Load raygui style file (.rgs)
-// NOTE: By default a binary file is expected, that file could contain a custom font,
-// in that case, custom font image atlas is GRAY+ALPHA and pixel data can be compressed (DEFLATE)
-void GuiLoadStyle(const char *fileName)
-{
-    #define MAX_LINE_BUFFER_SIZE    256
+    RAYGUI_PROFILE_END("GuiListView");
+    return result;
+}
 
-    bool tryBinary = false;
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
+// List View control using text entries list and returning focus entry
+int GuiListViewEx(Rectangle bounds, char **text, int count, int *scrollIndex, int *active, int *focus)
+{
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds))    // Control outside clip region, not processed
+    {
+        if (focus != NULL) *focus = -1;
+        return 0;
+    }
 
-    // Try reading the files as text file first
-    FILE *rgsFile = fopen(fileName, "rt");
+    RAYGUI_PROFILE_BEGIN("GuiListViewEx");
+    GuiPushControlID(id);
 
-    if (rgsFile != NULL)
-    {
-        char buffer[MAX_LINE_BUFFER_SIZE] = { 0 };
-        fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
+    int result = RESULT_NONE;
+    GuiState state = guiState;
 
-        if (buffer[0] == '#')
+    int itemFocused = (focus == NULL)? -1 : *focus;
+    int itemSelected = (active == NULL)? -1 : *active;
+    int prevActive = (active == NULL)? 0 : *active;
+
+    // Check if scroll bar is needed
+    bool useScrollBar = false;
+    if ((GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING))*count > bounds.height) useScrollBar = true;
+
+    // Define base item rectangle [0]
+    Rectangle itemBounds = { 0 };
+    itemBounds.x = bounds.x + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING);
+    itemBounds.y = bounds.y + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING) + GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    itemBounds.width = bounds.width - 2*GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING) - GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    itemBounds.height = (float)GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT);
+    if (useScrollBar) itemBounds.width -= GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH);
+
+    // Get items on the list
+    int visibleItems = (int)bounds.height/(GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING));
+    if (visibleItems > count) visibleItems = count;
+
+    int startIndex = (scrollIndex == NULL)? 0 : *scrollIndex;
+    if ((startIndex < 0) || (startIndex > (count - visibleItems))) startIndex = 0;
+    int endIndex = startIndex + visibleItems;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
+
+        // Check mouse inside list view
+        if (GuiCheckHover(mousePoint, bounds))
         {
-            int controlId = 0;
-            int propertyId = 0;
-            unsigned int propertyValue = 0;
-            unsigned int version = 0;
+            state = STATE_FOCUSED;
 
-            while (!feof(rgsFile))
+            // Check focused and selected item
+            for (int i = 0; i < visibleItems; i++)
             {
-                switch (buffer[0])
+                if (CheckCollisionPointRec(mousePoint, itemBounds))
                 {
-                    case 'v':
+                    itemFocused = startIndex + i;
+                    if (GUI_BUTTON_PRESSED)
                     {
-                        sscanf(buffer, "v %d", &version);
+                        if (itemSelected == (startIndex + i)) itemSelected = -1;
+                        else itemSelected = startIndex + i;
                     }
-                    case 'p':
-                    {
-                        // Style property: p <control_id> <property_id> <property_value> <property_name>
+                    break;
+                }
 
-                        sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue);
-                        GuiSetStyle(controlId, propertyId, (int)propertyValue);
+                // Update item rectangle y position for next item
+                itemBounds.y += (GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING));
+            }
 
-                    } break;
-                    case 'f':
-                    {
-                        // Style font: f <gen_font_size> <font_file> <charmap_file>
+            if (useScrollBar)
+            {
+                float scrollDelta = GUI_SCROLL_DELTA;
+                startIndex -= (int)scrollDelta;
 
-                        int fontSize = 0;
-                        char charmapFileName[32] = { 0 };
-                        char fontFileName[32] = { 0 };
+                if (startIndex < 0) startIndex = 0;
+                else if (startIndex > (count - visibleItems)) startIndex = count - visibleItems;
 
-                        if (version >= 600) sscanf(buffer, "f %d %31s %31[^\r\n]s", &fontSize, fontFileName, charmapFileName);
-                        else sscanf(buffer, "f %d %31s %31[^\r\n]s", &fontSize, charmapFileName, fontFileName);
+                endIndex = startIndex + visibleItems;
+                if (endIndex > count) endIndex = count;
+            }
+        }
+        else itemFocused = -1;
 
-                        // GLOBAL: Copy font file name into guiFontName
-                        snprintf(guiFontName, 32, "%s", fontFileName);
+        // Reset item rectangle y to [0]
+        itemBounds.y = bounds.y + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING) + GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    }
+    //--------------------------------------------------------------------
 
-                        Font font = { 0 };
-                        int *codepoints = NULL;
-                        int codepointCount = 0;
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));     // Draw background
 
-                        if (charmapFileName[0] != '0')
-                        {
-                            // Load text data from file
-                            // NOTE: Expected an UTF-8 array of codepoints, no separation
-                            char *textData = LoadFileText(TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
-                            codepoints = LoadCodepoints(textData, &codepointCount);
-                            UnloadFileText(textData);
-                        }
+    // Draw visible items
+    for (int i = 0; ((i < visibleItems) && (text != NULL)); i++)
+    {
+        if (GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_NORMAL)) GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_NORMAL)), BLANK);
 
-                        if (fontFileName[0] != '\0')
-                        {
-                            // In case a font is already loaded and it is not default internal font, unload it
-                            if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
+        if (state == STATE_DISABLED)
+        {
+            if ((startIndex + i) == itemSelected) GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_DISABLED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_DISABLED)));
 
-                            if (codepointCount > 0) font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, codepoints, codepointCount);
-                            else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);   // Default to 95 standard codepoints
-                        }
+            GuiDrawText(text[startIndex + i], GetTextBounds(LISTVIEW, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_DISABLED)));
+        }
+        else
+        {
+            if (((startIndex + i) == itemSelected) && (active != NULL))
+            {
+                // Draw item selected
+                GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_PRESSED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_PRESSED)));
+                GuiDrawText(text[startIndex + i], GetTextBounds(LISTVIEW, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_PRESSED)));
+            }
+            else if (((startIndex + i) == itemFocused)) // && (focus != NULL)) // NOTE: Items focused, despite not returned
+            {
+                // Draw item focused
+                GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_FOCUSED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_FOCUSED)));
+                GuiDrawText(text[startIndex + i], GetTextBounds(LISTVIEW, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_FOCUSED)));
+            }
+            else
+            {
+                // Draw item normal (no rectangle)
+                GuiDrawText(text[startIndex + i], GetTextBounds(LISTVIEW, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_NORMAL)));
+            }
+        }
 
-                        // If font texture not properly loaded, revert to default font and size/spacing
-                        if (font.texture.id == 0)
-                        {
-                            font = GetFontDefault();
-                            GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
-                            GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
-                        }
+        // Update item rectangle y position for next item
+        itemBounds.y += (GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING));
+    }
 
-                        UnloadCodepoints(codepoints);
+    if (useScrollBar)
+    {
+        Rectangle scrollBarBounds = {
+            bounds.x + bounds.width - GuiGetStyle(LISTVIEW, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
+            bounds.y + GuiGetStyle(LISTVIEW, BORDER_WIDTH), (float)GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
+            bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH)
+        };
 
-                        if ((font.texture.id > 0) && (font.glyphCount > 0)) GuiSetFont(font);
+        // Calculate percentage of visible items and apply same percentage to scrollbar
+        float percentVisible = (float)(endIndex - startIndex)/count;
+        float sliderSize = bounds.height*percentVisible;
 
-                    } break;
-                    default: break;
-                }
+        int prevSliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);   // Save default slider size
+        int prevScrollSpeed = GuiGetStyle(SCROLLBAR, SCROLL_SPEED); // Save default scroll speed
+        GuiSetStyleTemp(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)sliderSize);            // Change slider size
+        GuiSetStyleTemp(SCROLLBAR, SCROLL_SPEED, count - visibleItems); // Change scroll speed
 
-                fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
-            }
-        }
-        else tryBinary = true;
+        startIndex = GuiScrollBar(scrollBarBounds, startIndex, 0, count - visibleItems);
 
-        fclose(rgsFile);
+        GuiSetStyleTemp(SCROLLBAR, SCROLL_SPEED, prevScrollSpeed); // Reset scroll speed to default
+        GuiSetStyleTemp(SCROLLBAR, SCROLL_SLIDER_SIZE, prevSliderSize); // Reset slider size to default
     }
+    //--------------------------------------------------------------------
 
-    if (tryBinary)
+    if (active != NULL) *active = itemSelected;
+    if (focus != NULL) *focus = itemFocused;
+    if (scrollIndex != NULL) *scrollIndex = startIndex;
+
+    if (prevActive != *active) result = RESULT_CHANGED;
+
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiListViewEx");
+    return result;
+}
+
+// Tab Bar control
+int GuiTabBar(Rectangle bounds, const char *text, int *hscroll, int *active)
+{
+    RAYGUI_PROFILE_BEGIN("GuiTabBar");
+
+    int result = RESULT_NONE;
+    int itemCount = 0;
+    char **items = NULL;
+
+    if (text != NULL) items = GuiTextSplit(text, ';', &itemCount);
+
+    result = GuiTabBarEx(bounds, items, itemCount, hscroll, active, NULL);
+
+    RAYGUI_PROFILE_END("GuiTabBar");
+    return result;
+}
+
+// Tab Bar control, using text entries list and returning focus entry
+// NOTE: Tabs are measured once and retained (tabs offsets prefix sums), only tabs visible inside bounds
+// are verified, drawn and hit-tested; hscroll is the tabs scroll in pixels, clamped to bounds
+// NOTE: In case of tab close result, consider focused tab
+// TODO: Reeplace GuiToggle() usage for custom implementation for the TABS
+int GuiTabBarEx(Rectangle bounds, char **text, int count, int *hscroll, int *active, int *focus)
+{
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds))    // Control outside clip region, not processed
     {
-        rgsFile = fopen(fileName, "rb");
+        if (focus != NULL) *focus = -1;
+        return 0;
+    }
 
-        if (rgsFile != NULL)
+    RAYGUI_PROFILE_BEGIN("GuiTabBarEx");
+    GuiPushControlID(id);
+
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    if ((text == NULL) || (count < 0)) count = 0;
+
+    int activeTab = (active == NULL)? 0 : *active;
+    if (activeTab > count - 1) activeTab = count - 1;
+    if (activeTab < 0) activeTab = 0;
+
+    int prevActive = activeTab;
+    int tabFocused = -1;
+
+    GuiTabBarCacheEntry *tabs = (count > 0)? GuiGetTabBarCache(id, text, count) : NULL;
+
+    if (tabs != NULL)
+    {
+        // Update tabs scroll, driven by tab bar bounds
+        //--------------------------------------------------------------------
+        float scroll = (float)((hscroll != NULL)? *hscroll : tabs->scroll);
+
+        // NOTE: Tab bar is registered for hit-testing before tabs (tabs are on top of it),
+        // wheel scrolling is not blocked by tabs, pointer is checked directly on bar bounds
+#if defined(RAYGUI_HITTEST)
+        GuiCheckHover(GUI_POINTER_POSITION, bounds);
+#endif
+        if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
         {
-            fseek(rgsFile, 0, SEEK_END);
-            int fileDataSize = ftell(rgsFile);
-            fseek(rgsFile, 0, SEEK_SET);
+            Vector2 mousePoint = GUI_POINTER_POSITION;
 
-            if (fileDataSize > 0)
+            if (CheckCollisionPointRec(mousePoint, bounds) && ((guiClipCount == 0) || CheckCollisionPointRec(mousePoint, GuiGetClip())))
             {
-                unsigned char *fileData = (unsigned char *)RAYGUI_CALLOC(fileDataSize, sizeof(unsigned char));
-                if (fileData != NULL)
-                {
-                    fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
+                scroll -= GUI_SCROLL_DELTA*GuiGetStyle(TABBAR, TAB_ITEMS_WIDTH);
+            }
+        }
 
-                    GuiLoadStyleFromMemory(fileData, fileDataSize);
+        // Verify visible tabs text, re-measured tabs could change visible tabs range
+        GuiUpdateTabBarCache(tabs, text, GuiGetTabBarIndex(tabs, scroll), GuiGetTabBarIndex(tabs, scroll + bounds.width));
 
-                    RAYGUI_FREE(fileData);
-                }
-            }
+        // Scroll active tab into view when changed
+        if (activeTab != tabs->active)
+        {
+            GuiUpdateTabBarCache(tabs, text, activeTab, activeTab);
 
-            fclose(rgsFile);
+            float tabEnd = tabs->offsets[activeTab + 1] - RAYGUI_TABBAR_TAB_SPACING*guiScale;
+            if (tabEnd > (scroll + bounds.width)) scroll = tabEnd - bounds.width;
+            if (tabs->offsets[activeTab] < scroll) scroll = tabs->offsets[activeTab];
         }
-    }
-}
 
-// Load style from memory
-// WARNING: Binary files only
-void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
-{
-    // Style File Structure (.rgs)
-    // ------------------------------------------------------
-    // Offset  | Size    | Type       | Description
-    // ------------------------------------------------------
-    // 0       | 4       | char       | Signature: "rGS "
-    // 4       | 2       | short      | Version: 200, 400, 600
-    // 6       | 2       | short      | reserved
-    // 8       | 4       | int        | Num properties (only changed ones from default style)
+        float contentWidth = tabs->offsets[count] - RAYGUI_TABBAR_TAB_SPACING*guiScale;
+        if (scroll > (contentWidth - bounds.width)) scroll = contentWidth - bounds.width;
+        if (scroll < 0) scroll = 0;
+        //--------------------------------------------------------------------
 
-    // Properties Data (8 bytes per property)
-    // WARNING: Only properties required that differ from default (light) internal style
-    // foreach (property)
-    // {
-    //   8+8*i  | 2       | short      | ControlId
-    //   8+8*i  | 2       | short      | PropertyId
-    //   8+8*i  | 4       | int        | PropertyValue
-    // }
+        // Draw control
+        //--------------------------------------------------------------------
+        //if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode) // TODO: Support disabled
 
-    // Custom Font Data : Parameters (64 bytes)
-    // ...     | 4       | int        | Font data size (0 - no font, no more fields added!)
-    // ...     | 32      | char       | Font filename (with extension) - VERSION: >=600
-    // ...     | 4       | int        | Font base size
-    // ...     | 4       | int        | Font glyph count [glyphCount]
-    // ...     | 4       | int        | Font type (0-NORMAL, 1-SDF)
-    // ...     | 16      | Rectangle  | Font white rectangle
+        // NOTE: Tabs partially out of bounds are clipped to bounds
+        bool clip = (contentWidth > bounds.width);
+        if (clip) GuiPushClip(bounds);
 
-    // Custom Font Data : Image (20 bytes + imData)
-    // NOTE: Font image atlas is always converted to GRAY+ALPHA
-    // and atlas image data can be compressed (DEFLATE)
-    // ...     | 4       | int        | Image data size (uncompressed)
-    // ...     | 4       | int        | Image data size (compressed)
-    // ...     | 4       | int        | Image width
-    // ...     | 4       | int        | Image height
-    // ...     | 4       | int        | Image format: GRAY+ALPHA (expected)
-    // ...     | imSize  | byte       | Image data (comp or uncomp)
+        int firstTab = GuiGetTabBarIndex(tabs, scroll);
+        int lastTab = GuiGetTabBarIndex(tabs, scroll + bounds.width);
 
-    // Custom Font Data : Recs (32 bytes*glyphCount)
-    // NOTE: Font recs data can be compressed (DEFLATE)
-    // ...     | 4       | int        | Recs data compressed size (0 - not compressed, 1-compressed) - VERSION: >=400
-    //
-    // if (compRecsSize == 0)
-    // {
-    //    NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
-    //    foreach (glyph)
-    //    {
-    //       ...  | 16      | Rectangle  | Glyph rectangle (in image)
-    //    }
-    // }
-    // else
-    // {
-    //    ...  | compRecsSize | byte  | Rectangles data
-    // }
-    //
-
-    // Custom Font Data : Glyph Info (32 bytes*glyphCount)
-    // NOTE: Font glyphs info data can be compressed (DEFLATE)
-    // ...     | 4       | int        | Glyphs data compressed size (0 - not compressed) - VERSION: >=400
-    //
-    // if (compGlyphsSize == 0)
-    // {
-    //    NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
-    //    foreach (glyph)
-    //    {
-    //      ...   | 4       | int        | Glyph value
-    //      ...   | 4       | int        | Glyph offset X
-    //      ...   | 4       | int        | Glyph offset Y
-    //      ...   | 4       | int        | Glyph advance X
-    //    }
-    // }
-    // else
-    // {
-    //    ...  | compGlyphsSize | byte | Glyphs data
-    // }
-    // ------------------------------------------------------
-
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
-
-    char signature[5] = { 0 };
-    short version = 0;
-    short reserved = 0;
-    int propertyCount = 0;
+        int textAlignment = GuiGetStyle(TOGGLE, TEXT_ALIGNMENT);
+        int textPadding = GuiGetStyle(TOGGLE, TEXT_PADDING);
+        bool toggle = false; // Required for individual toggles
 
-    memcpy(signature, fileDataPtr, 4);
-    memcpy(&version, fileDataPtr + 4, sizeof(short));
-    memcpy(&reserved, fileDataPtr + 4 + 2, sizeof(short));
-    memcpy(&propertyCount, fileDataPtr + 4 + 2 + 2, sizeof(int));
-    fileDataPtr += 12;
+        for (int i = firstTab; i <= lastTab; i++)
+        {
+            Rectangle tabBounds = { bounds.x + tabs->offsets[i] - scroll, bounds.y, tabs->offsets[i + 1] - tabs->offsets[i] - RAYGUI_TABBAR_TAB_SPACING*guiScale, bounds.height };
 
-    if ((signature[0] == 'r') &&
-        (signature[1] == 'G') &&
-        (signature[2] == 'S') &&
-        (signature[3] == ' '))
-    {
-        short controlId = 0;
-        short propertyId = 0;
-        unsigned int propertyValue = 0;
+            // Draw tabs as toggle controls
+            GuiSetStyleTemp(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+            GuiSetStyleTemp(TOGGLE, TEXT_PADDING, (int)(RAYGUI_TABBAR_TAB_PADDING*guiScale + 0.5f));
 
-        for (int i = 0; i < propertyCount; i++)
-        {
-            memcpy(&controlId, fileDataPtr, sizeof(short));
-            memcpy(&propertyId, fileDataPtr + 2, sizeof(short));
-            memcpy(&propertyValue, fileDataPtr + 2 + 2, sizeof(unsigned int));
-            fileDataPtr += 8;
+            guiHoverLast = false;
 
-            if (controlId == 0) // DEFAULT control
+            if (i == activeTab)
             {
-                // If a DEFAULT property is loaded, it is propagated to all controls
-                // NOTE: All DEFAULT properties should be defined first in the file
-                GuiSetStyle(0, (int)propertyId, propertyValue);
-
-                if (propertyId < RAYGUI_MAX_PROPS_BASE) for (int j = 1; j < RAYGUI_MAX_CONTROLS; j++) GuiSetStyle(j, (int)propertyId, propertyValue);
+                toggle = true;
+                GuiToggle(tabBounds, text[i], &toggle);
+            }
+            else
+            {
+                toggle = false;
+                GuiToggle(tabBounds, text[i], &toggle);
+                if (toggle) activeTab = i;
             }
-            else GuiSetStyle((int)controlId, (int)propertyId, propertyValue);
-        }
 
-        // Load custom font if available
-        // NOTE: Font texture loading requires raylib
-        int fontDataSize = 0;
-        memcpy(&fontDataSize, fileDataPtr, sizeof(int));
-        fileDataPtr += 4;
+            GuiSetStyleTemp(TOGGLE, TEXT_PADDING, textPadding);
+            GuiSetStyleTemp(TOGGLE, TEXT_ALIGNMENT, textAlignment);
 
-        if (fontDataSize > 0)
-        {
-            Font font = { 0 };
-            int fontType = 0;   // 0-Normal, 1-SDF
+            // Tab focus is driven by tab toggle hover (or its close button hover)
+            bool tabHover = guiHoverLast;
 
-            // WARNING: Version 600 adds 32 bytes for the font filename (with extension)
-            if (version >= 600)
+            if (GuiGetStyle(TABBAR, TAB_CLOSE_BUTTON))
             {
-                // GLOBAL: Copy font file name into guiFontName
-                memcpy(guiFontName, fileDataPtr, 32);
-                fileDataPtr += 32;
+                // Draw tab close button
+                // NOTE: Only draw close button for current tab: if (CheckCollisionPointRec(mousePosition, tabBounds))
+                float closeSize = RAYGUI_TABBAR_CLOSE_SIZE*guiScale;
+                float closeMargin = RAYGUI_TABBAR_CLOSE_MARGIN*guiScale;
+                Rectangle closeBounds = { tabBounds.x + tabBounds.width - closeSize - closeMargin, tabBounds.y + closeMargin, closeSize, closeSize };
+                int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
+                int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+                GuiSetStyleTemp(BUTTON, BORDER_WIDTH, 1);
+                GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+#if defined(RAYGUI_NO_ICONS)
+                if (GuiButton(closeBounds, "x")) result = RESULT_TAB_CLOSE;
+#else
+                if (GuiButton(closeBounds, GuiIconText(ICON_CROSS_SMALL, NULL))) result = RESULT_TAB_CLOSE;
+#endif
+                tabHover = tabHover || guiHoverLast;
+                GuiSetStyleTemp(BUTTON, BORDER_WIDTH, tempBorderWidth);
+                GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
             }
-            else memset(guiFontName, 0, 32);
-
-            memcpy(&font.baseSize, fileDataPtr, sizeof(int));
-            memcpy(&font.glyphCount, fileDataPtr + 4, sizeof(int));
-            memcpy(&fontType, fileDataPtr + 4 + 4, sizeof(int));
-            fileDataPtr += 12;
 
-            // Load font white rectangle
-            Rectangle fontWhiteRec = { 0 };
-            memcpy(&fontWhiteRec, fileDataPtr, sizeof(Rectangle));
-            fileDataPtr += 16;
+            if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode && tabHover)
+            {
+                tabFocused = i;
 
-            // Load font image parameters
-            int fontImageUncompSize = 0;
-            int fontImageCompSize = 0;
-            memcpy(&fontImageUncompSize, fileDataPtr, sizeof(int));
-            memcpy(&fontImageCompSize, fileDataPtr + 4, sizeof(int));
-            fileDataPtr += 8;
+                // Close tab with middle mouse button pressed
+                if (GUI_BUTTON_PRESSED_MID) result = RESULT_TAB_CLOSE;
+            }
+        }
 
-            Image imFont = { 0 };
-            imFont.mipmaps = 1;
-            memcpy(&imFont.width, fileDataPtr, sizeof(int));
-            memcpy(&imFont.height, fileDataPtr + 4, sizeof(int));
-            memcpy(&imFont.format, fileDataPtr + 4 + 4, sizeof(int));
-            fileDataPtr += 12;
+        if (clip) GuiPopClip();
 
-            if ((fontImageCompSize > 0) && (fontImageCompSize != fontImageUncompSize))
-            {
-                // Compressed font atlas image data (DEFLATE), it requires DecompressData()
-                int dataUncompSize = 0;
-                unsigned char *compData = (unsigned char *)RAYGUI_CALLOC(fontImageCompSize, sizeof(unsigned char));
-                memcpy(compData, fileDataPtr, fontImageCompSize);
-                fileDataPtr += fontImageCompSize;
+        tabs->active = prevActive;  // Tab activated on this frame is scrolled into view on next frame
+        tabs->scroll = (int)scroll;
+        if (hscroll != NULL) *hscroll = (int)scroll;
+    }
 
-                imFont.data = DecompressData(compData, fontImageCompSize, &dataUncompSize);
+    // Draw tab-bar bottom line
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, 1 }, 0, BLANK, GetColor(GuiGetStyle(TABBAR, BORDER_COLOR_NORMAL)));
+    //--------------------------------------------------------------------
 
-                // Security check, dataUncompSize must match the provided fontImageUncompSize
-                if (dataUncompSize != fontImageUncompSize) RAYGUI_LOG("WARNING: Uncompressed font atlas image data could be corrupted");
+    if (active != NULL) *active = activeTab;
+    if (focus != NULL) *focus = tabFocused;
 
-                RAYGUI_FREE(compData);
-            }
-            else
-            {
-                // Font atlas image data is not compressed
-                imFont.data = (unsigned char *)RAYGUI_CALLOC(fontImageUncompSize, sizeof(unsigned char));
-                memcpy(imFont.data, fileDataPtr, fontImageUncompSize);
-                fileDataPtr += fontImageUncompSize;
-            }
+    // NOTE: In case of tab close result, consider focused tab
+    if ((result != RESULT_TAB_CLOSE) && (prevActive != activeTab)) result = RESULT_CHANGED;
 
-            // Load font recs data (glyphs position and size in the image atlas)
-            int recsDataSize = font.glyphCount*sizeof(Rectangle);
-            int recsDataCompressedSize = 0;
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiTabBarEx");
+    return result;
+}
 
-            // WARNING: Version 400 adds the compression size parameter
-            if (version >= 400)
-            {
-                // RGS files version 400 support compressed recs data
-                memcpy(&recsDataCompressedSize, fileDataPtr, sizeof(int));
-                fileDataPtr += sizeof(int);
-            }
+// Color Panel control
+int GuiColorPanel(Rectangle bounds, const char *text, Color *color)
+{
+    GuiID id = GuiGetControlID(bounds);
 
-            if ((recsDataCompressedSize > 0) && (recsDataCompressedSize != recsDataSize))
-            {
-                // Recs data is compressed, uncompress it
-                unsigned char *recsDataCompressed = (unsigned char *)RAYGUI_CALLOC(recsDataCompressedSize, sizeof(unsigned char));
+    RAYGUI_PROFILE_BEGIN("GuiColorPanel");
+    GuiPushControlID(id);
 
-                memcpy(recsDataCompressed, fileDataPtr, recsDataCompressedSize);
-                fileDataPtr += recsDataCompressedSize;
+    int result = RESULT_NONE;
 
-                int recsDataUncompSize = 0;
-                font.recs = (Rectangle *)DecompressData(recsDataCompressed, recsDataCompressedSize, &recsDataUncompSize);
+    // Get retained hsv, color is only converted if it was changed outside the control
+    // NOTE: It also keeps hue and saturation for colors without them (grays)
+    Vector3 hsv = GuiGetColorHSVCached(id, *color);
+    Vector3 prevHsv = hsv; // NOTE: Workaround to see if GuiColorPanelHSV() modifies the hsv
 
-                // Security check, data uncompressed size must match the expected original data size
-                if (recsDataUncompSize != recsDataSize) RAYGUI_LOG("WARNING: Uncompressed font recs data could be corrupted");
+    result = GuiColorPanelHSV(bounds, text, &hsv);
 
-                RAYGUI_FREE(recsDataCompressed);
-            }
-            else
-            {
-                // Recs data is uncompressed
-                font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));
-                for (int i = 0; i < font.glyphCount; i++)
-                {
-                    memcpy(&font.recs[i], fileDataPtr, sizeof(Rectangle));
-                    fileDataPtr += sizeof(Rectangle);
-                }
-            }
+    // Check if the hsv was changed, only then change the color
+    // This is required, because the Color->HSV->Color conversion has precision errors
+    // Thus the assignment from HSV to Color should only be made, if the HSV has a new user-entered value
+    // Otherwise GuiColorPanel would often modify it's color without user input
+    if ((hsv.x != prevHsv.x) || (hsv.y != prevHsv.y) || (hsv.z != prevHsv.z))
+    {
+        Vector3 rgb = ConvertHSVtoRGB(hsv);
+        *color = RAYGUI_CLITERAL(Color){ (unsigned char)(255.0f*rgb.x), (unsigned char)(255.0f*rgb.y), (unsigned char)(255.0f*rgb.z), color->a };
 
-            // Load font glyphs info data
-            int glyphsDataSize = font.glyphCount*16;    // 16 bytes data per glyph
-            int glyphsDataCompressedSize = 0;
+        GuiSetColorHSVCached(id, *color, hsv);
+    }
 
-            // WARNING: Version 400 adds the compression size parameter
-            if (version >= 400)
-            {
-                // RGS files version 400 support compressed glyphs data
-                memcpy(&glyphsDataCompressedSize, fileDataPtr, sizeof(int));
-                fileDataPtr += sizeof(int);
-            }
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiColorPanel");
+    return result;
+}
 
-            // Allocate required glyphs space to fill with data
-            font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+// Color Bar Alpha control
+// NOTE: Returns alpha value normalized [0..1]
+int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
+{
+    #if !defined(RAYGUI_COLORBARALPHA_CHECKED_SIZE)
+        #define RAYGUI_COLORBARALPHA_CHECKED_SIZE   10
+    #endif
 
-            if ((glyphsDataCompressedSize > 0) && (glyphsDataCompressedSize != glyphsDataSize))
-            {
-                // Glyphs data is compressed, uncompress it
-                unsigned char *glypsDataCompressed = (unsigned char *)RAYGUI_CALLOC(glyphsDataCompressedSize, sizeof(unsigned char));
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds) && GuiIsCulled(RAYGUI_CLITERAL(Rectangle){ bounds.x - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT)/2, bounds.y - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW),
+        bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT), bounds.height + 2*GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW) })) return 0;    // Control outside clip region, not processed
 
-                memcpy(glypsDataCompressed, fileDataPtr, glyphsDataCompressedSize);
-                fileDataPtr += glyphsDataCompressedSize;
+    RAYGUI_PROFILE_BEGIN("GuiColorBarAlpha");
 
-                int glyphsDataUncompSize = 0;
-                unsigned char *glyphsDataUncomp = DecompressData(glypsDataCompressed, glyphsDataCompressedSize, &glyphsDataUncompSize);
+    int result = RESULT_NONE;
+    GuiState state = guiState;
 
-                // Security check, data uncompressed size must match the expected original data size
-                if (glyphsDataUncompSize != glyphsDataSize) RAYGUI_LOG("WARNING: Uncompressed font glyphs data could be corrupted");
+    float prevAlpha = *alpha;
+    Rectangle selector = { (float)bounds.x + (*alpha)*bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT)/2,
+        (float)bounds.y - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW),
+        (float)GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT),
+        (float)bounds.height + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)*2 };
 
-                unsigned char *glyphsDataUncompPtr = glyphsDataUncomp;
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
 
-                for (int i = 0; i < font.glyphCount; i++)
+        if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
+        {
+            if (GUI_BUTTON_DOWN)
+            {
+                if (id == guiControlExclusiveId)
                 {
-                    memcpy(&font.glyphs[i].value, glyphsDataUncompPtr, sizeof(int));
-                    memcpy(&font.glyphs[i].offsetX, glyphsDataUncompPtr + 4, sizeof(int));
-                    memcpy(&font.glyphs[i].offsetY, glyphsDataUncompPtr + 8, sizeof(int));
-                    memcpy(&font.glyphs[i].advanceX, glyphsDataUncompPtr + 12, sizeof(int));
-                    glyphsDataUncompPtr += 16;
-                }
+                    state = STATE_PRESSED;
 
-                RAYGUI_FREE(glypsDataCompressed);
-                RAYGUI_FREE(glyphsDataUncomp);
+                    *alpha = (mousePoint.x - bounds.x)/bounds.width;
+                    if (*alpha <= 0.0f) *alpha = 0.0f;
+                    if (*alpha >= 1.0f) *alpha = 1.0f;
+                }
             }
             else
             {
-                // Glyphs data is uncompressed
-                for (int i = 0; i < font.glyphCount; i++)
-                {
-                    memcpy(&font.glyphs[i].value, fileDataPtr, sizeof(int));
-                    memcpy(&font.glyphs[i].offsetX, fileDataPtr + 4, sizeof(int));
+                guiControlExclusiveMode = false;
+                guiControlExclusiveId = 0;
+            }
+        }
+        else if (GuiCheckHover(mousePoint, bounds) || CheckCollisionPointRec(mousePoint, selector))
+        {
+            if (GUI_BUTTON_DOWN)
+            {
+                state = STATE_PRESSED;
+                guiControlExclusiveMode = true;
+                guiControlExclusiveId = id; // Store control id when dragging starts
+
+                *alpha = (mousePoint.x - bounds.x)/bounds.width;
+                if (*alpha <= 0.0f) *alpha = 0.0f;
+                if (*alpha >= 1.0f) *alpha = 1.0f;
+                //selector.x = bounds.x + (int)(((alpha - 0)/(100 - 0))*(bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH))) - selector.width/2;
+            }
+            else state = STATE_FOCUSED;
+        }
+    }
+
+    if (prevAlpha != *alpha) result = RESULT_CHANGED;
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    // Draw alpha bar: checked background
+    if (state != STATE_DISABLED)
+    {
+        GuiDrawCheckerboard(bounds, RAYGUI_COLORBARALPHA_CHECKED_SIZE, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.4f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.4f));
+
+        GuiCmdDrawRectangleGradient(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
+    }
+    else GuiCmdDrawRectangleGradient(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
+
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+
+    // Draw alpha bar: selector
+    GuiDrawRectangle(selector, 0, BLANK, GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)));
+    //--------------------------------------------------------------------
+
+    RAYGUI_PROFILE_END("GuiColorBarAlpha");
+    return result;
+}
+
+// Color Bar Hue control
+// Returns hue value normalized [0..1]
+// NOTE: Other similar bars (for reference):
+//      Color GuiColorBarSat() [WHITE->color]
+//      Color GuiColorBarValue() [BLACK->color], HSV/HSL
+//      float GuiColorBarLuminance() [BLACK->WHITE]
+int GuiColorBarHue(Rectangle bounds, const char *text, float *hue)
+{
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds) && GuiIsCulled(RAYGUI_CLITERAL(Rectangle){ bounds.x - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), bounds.y - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT)/2,
+        bounds.width + 2*GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), bounds.height + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT) })) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiColorBarHue");
+
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    float prevHue = *hue;
+    Rectangle selector = { (float)bounds.x - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (float)bounds.y + (*hue)/360.0f*bounds.height - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT)/2, (float)bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)*2, (float)GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT) };
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
+
+        if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
+        {
+            if (GUI_BUTTON_DOWN)
+            {
+                if (id == guiControlExclusiveId)
+                {
+                    state = STATE_PRESSED;
+
+                    *hue = (mousePoint.y - bounds.y)*360/bounds.height;
+                    if (*hue <= 0.0f) *hue = 0.0f;
+                    if (*hue >= 359.0f) *hue = 359.0f;
+                }
+            }
+            else
+            {
+                guiControlExclusiveMode = false;
+                guiControlExclusiveId = 0;
+            }
+        }
+        else if (GuiCheckHover(mousePoint, bounds) || CheckCollisionPointRec(mousePoint, selector))
+        {
+            if (GUI_BUTTON_DOWN)
+            {
+                state = STATE_PRESSED;
+                guiControlExclusiveMode = true;
+                guiControlExclusiveId = id; // Store control id when dragging starts
+
+                *hue = (mousePoint.y - bounds.y)*360/bounds.height;
+                if (*hue <= 0.0f) *hue = 0.0f;
+                if (*hue >= 359.0f) *hue = 359.0f;
+
+            }
+            else state = STATE_FOCUSED;
+
+            /*if (GUI_KEY_DOWN(KEY_UP))
+            {
+                hue -= 2.0f;
+                if (hue <= 0.0f) hue = 0.0f;
+            }
+            else if (GUI_KEY_DOWN(KEY_DOWN))
+            {
+                hue += 2.0f;
+                if (hue >= 360.0f) hue = 360.0f;
+            }*/
+        }
+    }
+
+    if (prevHue != *hue) result = RESULT_CHANGED;
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (state != STATE_DISABLED)
+    {
+        // Draw hue bar:color bars
+        // NOTE: Using DrawRectangleGradientEx(bounds, color1, color2, color2, color1);
+        GuiCmdDrawRectangleGradient(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, bounds.width, bounds.height/6.0f }, 
+            Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha),
+            Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha));
+        GuiCmdDrawRectangleGradient(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 1*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
+            Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha),
+            Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha));
+        GuiCmdDrawRectangleGradient(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 2*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
+            Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha),
+            Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha));
+        GuiCmdDrawRectangleGradient(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 3*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
+            Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha),
+            Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha));
+        GuiCmdDrawRectangleGradient(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 4*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
+            Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha),
+            Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha));
+        GuiCmdDrawRectangleGradient(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 5*(bounds.height/6.0f), bounds.width, bounds.height/6.0f }, 
+            Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha),
+            Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha));
+    }
+    else
+    {
+        GuiCmdDrawRectangleGradient(bounds,
+            Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha),
+            Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha));
+    }
+
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+
+    // Draw hue bar: selector
+    GuiDrawRectangle(selector, 0, BLANK, GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)));
+    //--------------------------------------------------------------------
+
+    RAYGUI_PROFILE_END("GuiColorBarHue");
+    return result;
+}
+
+// Color Picker control
+// NOTE: It's divided in multiple controls:
+//      Color GuiColorPanel(Rectangle bounds, Color color)
+//      float GuiColorBarAlpha(Rectangle bounds, float alpha)
+//      float GuiColorBarHue(Rectangle bounds, float value)
+// NOTE: bounds define GuiColorPanel() size
+// NOTE: this picker converts RGB to HSV, which can cause the Hue control to jump. If you have this problem, consider using the HSV variant instead
+int GuiColorPicker(Rectangle bounds, const char *text, Color *color)
+{
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds) && GuiIsCulled(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT)/2,
+        bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_PADDING) + GuiGetStyle(COLORPICKER, HUEBAR_WIDTH) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW),
+        bounds.height + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT) })) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiColorPicker");
+    GuiPushControlID(id);
+
+    int result = RESULT_NONE;
+
+    Color temp = { 200, 0, 0, 255 };
+    if (color == NULL) color = &temp;
+
+    Rectangle boundsHue = { (float)bounds.x + bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_PADDING), (float)bounds.y, (float)GuiGetStyle(COLORPICKER, HUEBAR_WIDTH), (float)bounds.height };
+    //Rectangle boundsAlpha = { bounds.x, bounds.y + bounds.height + GuiGetStyle(COLORPICKER, BARS_PADDING), bounds.width, GuiGetStyle(COLORPICKER, BARS_THICK) };
+
+    // Get retained hsv, color is only converted if it was changed outside the control,
+    // avoiding low hue-resolution on similar r, g and b values (hue bar shifting around)
+    Vector3 hsv = GuiGetColorHSVCached(id, *color);
+    Vector3 prevHsv = hsv;
+
+    result = GuiColorPanelHSV(bounds, NULL, &hsv);
+    result = GuiColorBarHue(boundsHue, NULL, &hsv.x);
+
+    //color.a = (unsigned char)(GuiColorBarAlpha(boundsAlpha, (float)color.a/255.0f)*255.0f);
+    if ((hsv.x != prevHsv.x) || (hsv.y != prevHsv.y) || (hsv.z != prevHsv.z))
+    {
+        Vector3 rgb = ConvertHSVtoRGB(hsv);
+        *color = RAYGUI_CLITERAL(Color){ (unsigned char)roundf(rgb.x*255.0f), (unsigned char)roundf(rgb.y*255.0f), (unsigned char)roundf(rgb.z*255.0f), (*color).a };
+
+        GuiSetColorHSVCached(id, *color, hsv);
+    }
+
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiColorPicker");
+    return result;
+}
+
+// Color Picker control that avoids conversion to RGB and back to HSV on each call, thus avoiding jittering
+// The user can call ConvertHSVtoRGB() to convert *colorHsv value to RGB
+// NOTE: It's divided in multiple controls:
+//      int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
+//      int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
+//      float GuiColorBarHue(Rectangle bounds, float value)
+// NOTE: bounds define GuiColorPanelHSV() size
+int GuiColorPickerHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
+{
+    GuiID id = GuiGetControlID(bounds);
+
+    RAYGUI_PROFILE_BEGIN("GuiColorPickerHSV");
+    GuiPushControlID(id);
+
+    int result = RESULT_NONE;
+
+    Vector3 tempHsv = { 0 };
+
+    if (colorHsv == NULL)
+    {
+        const Vector3 tempColor = { 200.0f/255.0f, 0.0f, 0.0f };
+        tempHsv = ConvertRGBtoHSV(tempColor);
+        colorHsv = &tempHsv;
+    }
+
+    result = GuiColorPanelHSV(bounds, NULL, colorHsv);
+
+    Rectangle boundsHue = { (float)bounds.x + bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_PADDING), (float)bounds.y, (float)GuiGetStyle(COLORPICKER, HUEBAR_WIDTH), (float)bounds.height };
+
+    if (result == RESULT_NONE) result = GuiColorBarHue(boundsHue, NULL, &colorHsv->x);
+
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiColorPickerHSV");
+    return result;
+}
+
+// Color Panel control - HSV variant
+int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
+{
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiColorPanelHSV");
+
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    Vector3 prevColorHsv = *colorHsv;
+    Vector2 pickerSelector = { 0 };
+    const Color colWhite = { 255, 255, 255, 255 };
+    const Color colBlack = { 0, 0, 0, 255 };
+
+    pickerSelector.x = bounds.x + (float)colorHsv->y*bounds.width;            // HSV: Saturation
+    pickerSelector.y = bounds.y + (1.0f - (float)colorHsv->z)*bounds.height;  // HSV: Value
+
+    Vector3 maxHue = { colorHsv->x, 1.0f, 1.0f };
+    Vector3 rgbHue = ConvertHSVtoRGB(maxHue);
+    Color maxHueCol = { (unsigned char)(255.0f*rgbHue.x), (unsigned char)(255.0f*rgbHue.y), (unsigned char)(255.0f*rgbHue.z), 255 };
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
+
+        if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
+        {
+            if (GUI_BUTTON_DOWN)
+            {
+                if (id == guiControlExclusiveId)
+                {
+                    pickerSelector = mousePoint;
+
+                    if (pickerSelector.x < bounds.x) pickerSelector.x = bounds.x;
+                    if (pickerSelector.x > bounds.x + bounds.width) pickerSelector.x = bounds.x + bounds.width;
+                    if (pickerSelector.y < bounds.y) pickerSelector.y = bounds.y;
+                    if (pickerSelector.y > bounds.y + bounds.height) pickerSelector.y = bounds.y + bounds.height;
+
+                    // Calculate color from picker
+                    Vector2 colorPick = { pickerSelector.x - bounds.x, pickerSelector.y - bounds.y };
+
+                    colorPick.x /= (float)bounds.width; // Get normalized value on x
+                    colorPick.y /= (float)bounds.height; // Get normalized value on y
+
+                    colorHsv->y = colorPick.x;
+                    colorHsv->z = 1.0f - colorPick.y;
+                }
+            }
+            else
+            {
+                guiControlExclusiveMode = false;
+                guiControlExclusiveId = 0;
+            }
+        }
+        else if (GuiCheckHover(mousePoint, bounds))
+        {
+            if (GUI_BUTTON_DOWN)
+            {
+                state = STATE_PRESSED;
+                guiControlExclusiveMode = true;
+                guiControlExclusiveId = id;
+                pickerSelector = mousePoint;
+
+                // Calculate color from picker
+                Vector2 colorPick = { pickerSelector.x - bounds.x, pickerSelector.y - bounds.y };
+
+                colorPick.x /= (float)bounds.width;     // Get normalized value on x
+                colorPick.y /= (float)bounds.height;    // Get normalized value on y
+
+                colorHsv->y = colorPick.x;
+                colorHsv->z = 1.0f - colorPick.y;
+            }
+            else state = STATE_FOCUSED;
+        }
+    }
+
+    if ((prevColorHsv.x != colorHsv->x) ||
+        (prevColorHsv.y != colorHsv->y) ||
+        (prevColorHsv.z != colorHsv->z)) result = RESULT_CHANGED;
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (state != STATE_DISABLED)
+    {
+        GuiCmdDrawRectangleGradient(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
+        GuiCmdDrawRectangleGradient(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
+
+        // Draw color picker: selector
+        Rectangle selector = { pickerSelector.x - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, pickerSelector.y - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE) };
+        GuiDrawRectangle(selector, 0, BLANK, colWhite);
+    }
+    else
+    {
+        GuiCmdDrawRectangleGradient(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
+    }
+
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+    //--------------------------------------------------------------------
+
+    RAYGUI_PROFILE_END("GuiColorPanelHSV");
+    return result;
+}
+
+// Color Palette control
+// NOTE: Swatches fill bounds on a grid of provided columns (below header bar if text provided), only swatches
+// inside clip region are drawn, as one rectangles stream; hovered swatch is computed from pointer position
+int GuiColorPalette(Rectangle bounds, const char *text, const Color *colors, int count, int columns, int *active)
+{
+    #if !defined(RAYGUI_COLORPALETTE_BATCH_SIZE)
+        #define RAYGUI_COLORPALETTE_BATCH_SIZE   64
+    #endif
+
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiColorPalette");
+    GuiPushControlID(id);
+
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    int temp = -1;
+    if (active == NULL) active = &temp;
+
+    // Text will be drawn as a header bar (if provided)
+    if (text != NULL)
+    {
+        float statusBarHeight = (float)(int)(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*guiScale + 0.5f);
+
+        GuiStatusBar(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, bounds.width, statusBarHeight }, text);
+
+        // Move swatches bounds after the header bar
+        bounds.y += statusBarHeight - 1;
+        bounds.height -= statusBarHeight - 1;
+    }
+
+    if ((colors == NULL) || (count <= 0) || (columns <= 0) || (bounds.height <= 0))
+    {
+        GuiPopID();
+        RAYGUI_PROFILE_END("GuiColorPalette");
+        return result;
+    }
+
+    int rows = (count + columns - 1)/columns;
+    float cellWidth = bounds.width/columns;
+    float cellHeight = bounds.height/rows;
+    int itemFocused = -1;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
+
+        if (GuiCheckHover(mousePoint, bounds))
+        {
+            state = STATE_FOCUSED;
+
+            int col = (int)((mousePoint.x - bounds.x)/cellWidth);
+            int row = (int)((mousePoint.y - bounds.y)/cellHeight);
+            if (col >= columns) col = columns - 1;
+            if (row >= rows) row = rows - 1;
+
+            if ((row*columns + col) < count) itemFocused = row*columns + col;
+
+            if ((itemFocused >= 0) && GUI_BUTTON_PRESSED && (*active != itemFocused))
+            {
+                *active = itemFocused;
+                result = RESULT_CHANGED;
+            }
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    // Draw swatches inside clip region, cells edges rounded to pixels to avoid gaps
+    Rectangle clip = GuiGetClip();
+    int firstCol = (clip.x > bounds.x)? (int)((clip.x - bounds.x)/cellWidth) : 0;
+    int firstRow = (clip.y > bounds.y)? (int)((clip.y - bounds.y)/cellHeight) : 0;
+    int lastCol = ((clip.x + clip.width) < (bounds.x + bounds.width))? (int)((clip.x + clip.width - bounds.x)/cellWidth) : columns - 1;
+    int lastRow = ((clip.y + clip.height) < (bounds.y + bounds.height))? (int)((clip.y + clip.height - bounds.y)/cellHeight) : rows - 1;
+    if (lastCol >= columns) lastCol = columns - 1;
+    if (lastRow >= rows) lastRow = rows - 1;
+
+    float alpha = (state == STATE_DISABLED)? guiAlpha*0.3f : guiAlpha;
+    Rectangle swatchRecs[RAYGUI_COLORPALETTE_BATCH_SIZE] = { 0 };
+    Color swatchColors[RAYGUI_COLORPALETTE_BATCH_SIZE] = { 0 };
+    int swatches = 0;
+
+    for (int row = firstRow; row <= lastRow; row++)
+    {
+        float y0 = (float)(int)(bounds.y + row*cellHeight);
+        float y1 = (float)(int)(bounds.y + (row + 1)*cellHeight);
+
+        for (int col = firstCol; col <= lastCol; col++)
+        {
+            int index = row*columns + col;
+            if (index >= count) break;
+
+            float x0 = (float)(int)(bounds.x + col*cellWidth);
+            float x1 = (float)(int)(bounds.x + (col + 1)*cellWidth);
+
+            swatchRecs[swatches] = RAYGUI_CLITERAL(Rectangle){ x0, y0, x1 - x0, y1 - y0 };
+            swatchColors[swatches] = GuiFade(colors[index], alpha);
+            swatches++;
+
+            if (swatches == RAYGUI_COLORPALETTE_BATCH_SIZE)
+            {
+                GuiCmdDrawRectangles(swatchRecs, swatchColors, swatches);
+                RAYGUI_STATS_ADD(rectangles, swatches);
+                swatches = 0;
+            }
+        }
+    }
+
+    if (swatches > 0)
+    {
+        GuiCmdDrawRectangles(swatchRecs, swatchColors, swatches);
+        RAYGUI_STATS_ADD(rectangles, swatches);
+    }
+
+    // Draw focused and selected swatches borders
+    if ((*active >= 0) && (*active < count))
+    {
+        Rectangle cell = { (float)(int)(bounds.x + (*active%columns)*cellWidth), (float)(int)(bounds.y + (*active/columns)*cellHeight), 0, 0 };
+        cell.width = (float)(int)(bounds.x + (*active%columns + 1)*cellWidth) - cell.x;
+        cell.height = (float)(int)(bounds.y + (*active/columns + 1)*cellHeight) - cell.y;
+        GuiDrawRectangle(cell, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_PRESSED)), BLANK);
+    }
+
+    if ((itemFocused >= 0) && (itemFocused != *active))
+    {
+        Rectangle cell = { (float)(int)(bounds.x + (itemFocused%columns)*cellWidth), (float)(int)(bounds.y + (itemFocused/columns)*cellHeight), 0, 0 };
+        cell.width = (float)(int)(bounds.x + (itemFocused%columns + 1)*cellWidth) - cell.x;
+        cell.height = (float)(int)(bounds.y + (itemFocused/columns + 1)*cellHeight) - cell.y;
+        GuiDrawRectangle(cell, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_FOCUSED)), BLANK);
+    }
+
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+    //--------------------------------------------------------------------
+
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiColorPalette");
+    return result;
+}
+
+// Sort color palette by hue or value
+// NOTE: Stable sort (equal keys keep palette order), temporary memory allocated for sorting keys
+void GuiColorPaletteSort(Color *colors, int count, int mode)
+{
+    if ((colors == NULL) || (count < 2)) return;
+
+    RAYGUI_PROFILE_BEGIN("GuiColorPaletteSort");
+
+    Vector3 *hsv = (Vector3 *)RAYGUI_MALLOC(count*sizeof(Vector3));
+    int *indices = (int *)RAYGUI_MALLOC(2*count*sizeof(int));
+    Color *sorted = (Color *)RAYGUI_MALLOC(count*sizeof(Color));
+
+    if ((hsv != NULL) && (indices != NULL) && (sorted != NULL))
+    {
+        GuiColorsToHSV(colors, hsv, count);
+
+        // Sort keys: primary key (hue or value) and secondary key (value or hue)
+        // NOTE: Keys are reused on hsv array, x: primary, y: secondary
+        for (int i = 0; i < count; i++)
+        {
+            Vector3 key = { (mode == PALETTE_SORT_VALUE)? hsv[i].z : hsv[i].x, (mode == PALETTE_SORT_VALUE)? hsv[i].x : hsv[i].z, 0 };
+            hsv[i] = key;
+            indices[i] = i;
+        }
+
+        // Bottom-up merge sort on indices, stable
+        int *src = indices;
+        int *dst = indices + count;
+
+        for (int width = 1; width < count; width *= 2)
+        {
+            for (int start = 0; start < count; start += 2*width)
+            {
+                int mid = (start + width < count)? start + width : count;
+                int end = (start + 2*width < count)? start + 2*width : count;
+                int i = start, j = mid, k = start;
+
+                while ((i < mid) && (j < end))
+                {
+                    Vector3 a = hsv[src[i]];
+                    Vector3 b = hsv[src[j]];
+
+                    // Take right element only if strictly lower (stability)
+                    if ((b.x < a.x) || ((b.x == a.x) && (b.y < a.y))) dst[k++] = src[j++];
+                    else dst[k++] = src[i++];
+                }
+
+                while (i < mid) dst[k++] = src[i++];
+                while (j < end) dst[k++] = src[j++];
+            }
+
+            int *swap = src;
+            src = dst;
+            dst = swap;
+        }
+
+        for (int i = 0; i < count; i++) sorted[i] = colors[src[i]];
+        memcpy(colors, sorted, count*sizeof(Color));
+    }
+    else RAYGUI_LOG("WARNING: Failed to allocate palette sorting data\n");
+
+    RAYGUI_FREE(hsv);
+    RAYGUI_FREE(indices);
+    RAYGUI_FREE(sorted);
+
+    RAYGUI_PROFILE_END("GuiColorPaletteSort");
+}
+
+// Convert colors array to Hue-Saturation-Value
+// NOTE: Same results as ConvertRGBtoHSV(), written without data-dependent branches (selects only)
+// so compilers are able to vectorize the loop (compiler dependent, some require -fno-trapping-math)
+void GuiColorsToHSV(const Color *colors, Vector3 *hsv, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float r = colors[i].r/255.0f;
+        float g = colors[i].g/255.0f;
+        float b = colors[i].b/255.0f;
+
+        float max = (r > g)? r : g;
+        max = (max > b)? max : b;
+        float min = (r < g)? r : g;
+        min = (min < b)? min : b;
+
+        float delta = max - min;
+        bool gray = (delta < 0.00001f) | (max <= 0.0f);
+        bool maxR = (r >= max);
+        bool maxG = (g >= max);
+        float divisor = gray? 1.0f : delta;
+
+        // Hue sector selected before the single division: red (0), green (2) or blue (4)
+        float num = maxR? (g - b) : (maxG? (b - r) : (r - g));
+        float offset = maxR? 0.0f : (maxG? 2.0f : 4.0f);
+        float hue = (offset + num/divisor)*60.0f;
+        hue += (hue < 0.0f)? 360.0f : 0.0f;
+
+        hsv[i].x = gray? 0.0f : hue;
+        hsv[i].y = gray? 0.0f : delta/((max > 0.0f)? max : 1.0f);
+        hsv[i].z = max;
+    }
+}
+
+// Convert Hue-Saturation-Value array to colors
+// NOTE: Sector selection computed arithmetically (no switch), same vectorization notes as GuiColorsToHSV()
+void GuiColorsFromHSV(const Vector3 *hsv, Color *colors, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float h = (hsv[i].x >= 360.0f)? 0.0f : hsv[i].x/60.0f;
+        float s = (hsv[i].y > 0.0f)? hsv[i].y : 0.0f;
+        float v = hsv[i].z;
+
+        // Channel n: v - v*s*clamp(min(k, 4 - k), 0, 1), k = (n + h) mod 6, n = 5 (red), 3 (green), 1 (blue)
+        float kr = 5.0f + h;
+        float kg = 3.0f + h;
+        float kb = 1.0f + h;
+        kr = (kr >= 6.0f)? kr - 6.0f : kr;
+        kg = (kg >= 6.0f)? kg - 6.0f : kg;
+        kb = (kb >= 6.0f)? kb - 6.0f : kb;
+
+        float fr = (kr < (4.0f - kr))? kr : (4.0f - kr);
+        float fg = (kg < (4.0f - kg))? kg : (4.0f - kg);
+        float fb = (kb < (4.0f - kb))? kb : (4.0f - kb);
+        fr = (fr < 0.0f)? 0.0f : ((fr > 1.0f)? 1.0f : fr);
+        fg = (fg < 0.0f)? 0.0f : ((fg > 1.0f)? 1.0f : fg);
+        fb = (fb < 0.0f)? 0.0f : ((fb > 1.0f)? 1.0f : fb);
+
+        colors[i].r = (unsigned char)(255.0f*(v - v*s*fr));
+        colors[i].g = (unsigned char)(255.0f*(v - v*s*fg));
+        colors[i].b = (unsigned char)(255.0f*(v - v*s*fb));
+        colors[i].a = 255;
+    }
+}
+
+// Message Box control
+// NOTE: Button pressed is returned through btnActive parameter, 0 for window close button
+int GuiMessageBox(Rectangle bounds, const char *title, const char *message, const char *btnText, int *btnActive)
+{
+    #if !defined(RAYGUI_MESSAGEBOX_BUTTON_HEIGHT)
+        #define RAYGUI_MESSAGEBOX_BUTTON_HEIGHT    24
+    #endif
+    #if !defined(RAYGUI_MESSAGEBOX_BUTTON_PADDING)
+        #define RAYGUI_MESSAGEBOX_BUTTON_PADDING   12
+    #endif
+
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiMessageBox");
+    GuiPushControlID(id);
+
+    int result = RESULT_NONE;
+
+    float buttonHeight = RAYGUI_MESSAGEBOX_BUTTON_HEIGHT*guiScale;
+    float buttonPadding = RAYGUI_MESSAGEBOX_BUTTON_PADDING*guiScale;
+    float statusBarHeight = (float)(int)(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*guiScale + 0.5f);
+
+    int buttonCount = 0;
+    char **btnTextList = GuiTextSplit(btnText, ';', &buttonCount);
+    Rectangle buttonBounds = { 0 };
+    buttonBounds.x = bounds.x + buttonPadding;
+    buttonBounds.y = bounds.y + bounds.height - buttonHeight - buttonPadding;
+    buttonBounds.width = (bounds.width - buttonPadding*(buttonCount + 1))/buttonCount;
+    buttonBounds.height = buttonHeight;
+
+    //int textWidth = GuiGetTextWidth(message) + 2;
+
+    Rectangle textBounds = { 0 };
+    textBounds.x = bounds.x + buttonPadding;
+    textBounds.y = bounds.y + statusBarHeight + buttonPadding;
+    textBounds.width = bounds.width - buttonPadding*2;
+    textBounds.height = bounds.height - statusBarHeight - 3*buttonPadding - buttonHeight;
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (GuiWindowBox(bounds, title) == RESULT_PRESSED)
+    {
+        *btnActive = 0;
+        result = RESULT_PRESSED;
+    }
+
+    int prevTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
+    GuiSetStyleTemp(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiLabel(textBounds, message);
+    GuiSetStyleTemp(LABEL, TEXT_ALIGNMENT, prevTextAlignment);
+
+    prevTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+
+    for (int i = 0; i < buttonCount; i++)
+    {
+        if (GuiButton(buttonBounds, btnTextList[i]))
+        {
+            *btnActive = i + 1;
+            result = RESULT_PRESSED;
+        }
+        buttonBounds.x += (buttonBounds.width + buttonPadding);
+    }
+
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, prevTextAlignment);
+    //--------------------------------------------------------------------
+
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiMessageBox");
+    return result;
+}
+
+// Text Input Box control
+// NOTE: Button pressed is returned through btnActive parameter, 0 for window close button
+int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, char *text, int textSize, const char *btnText, int *btnActive, bool *secretViewActive)
+{
+    #if !defined(RAYGUI_TEXTINPUTBOX_BUTTON_HEIGHT)
+        #define RAYGUI_TEXTINPUTBOX_BUTTON_HEIGHT      24
+    #endif
+    #if !defined(RAYGUI_TEXTINPUTBOX_BUTTON_PADDING)
+        #define RAYGUI_TEXTINPUTBOX_BUTTON_PADDING     12
+    #endif
+    #if !defined(RAYGUI_TEXTINPUTBOX_HEIGHT)
+        #define RAYGUI_TEXTINPUTBOX_HEIGHT             26
+    #endif
+
+    GuiID id = GuiGetControlID(bounds);
+    if (GuiIsCulled(bounds)) return 0;    // Control outside clip region, not processed
+
+    RAYGUI_PROFILE_BEGIN("GuiTextInputBox");
+    GuiPushControlID(id);
+
+    int result = RESULT_NONE;
+
+    // Used to enable text edit mode
+    // WARNING: No more than one GuiTextInputBox() should be open at the same time
+    bool textEditMode = guiContext->textInputBoxEditMode;
+
+    float buttonHeight = RAYGUI_TEXTINPUTBOX_BUTTON_HEIGHT*guiScale;
+    float buttonPadding = RAYGUI_TEXTINPUTBOX_BUTTON_PADDING*guiScale;
+    float textBoxHeight = RAYGUI_TEXTINPUTBOX_HEIGHT*guiScale;
+    float statusBarHeight = (float)(int)(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*guiScale + 0.5f);
+
+    int buttonCount = 0;
+    char **btnTextList = GuiTextSplit(btnText, ';', &buttonCount);
+    Rectangle buttonBounds = { 0 };
+    buttonBounds.x = bounds.x + buttonPadding;
+    buttonBounds.y = bounds.y + bounds.height - buttonHeight - buttonPadding;
+    buttonBounds.width = (bounds.width - buttonPadding*(buttonCount + 1))/buttonCount;
+    buttonBounds.height = buttonHeight;
+
+    int messageInputHeight = (int)(bounds.height - statusBarHeight - GuiGetStyle(STATUSBAR, BORDER_WIDTH) - buttonHeight - 2*buttonPadding);
+
+    Rectangle textBounds = { 0 };
+    if (message != NULL)
+    {
+        int textSize = GuiGetTextWidth(message) + 2;
+
+        textBounds.x = bounds.x + bounds.width/2 - textSize/2;
+        textBounds.y = bounds.y + statusBarHeight + messageInputHeight/4 - (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        textBounds.width = (float)textSize;
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    }
+
+    Rectangle textBoxBounds = { 0 };
+    textBoxBounds.x = bounds.x + buttonPadding;
+    textBoxBounds.y = bounds.y + statusBarHeight - textBoxHeight/2;
+    if (message == NULL) textBoxBounds.y = bounds.y + statusBarHeight + buttonPadding;
+    else textBoxBounds.y += (messageInputHeight/2 + messageInputHeight/4);
+    textBoxBounds.width = bounds.width - buttonPadding*2;
+    textBoxBounds.height = textBoxHeight;
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (GuiWindowBox(bounds, title) == RESULT_PRESSED)
+    {
+        *btnActive = 0;
+        result = RESULT_PRESSED;
+    }
+
+    // Draw message if available
+    if (message != NULL)
+    {
+        int prevTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
+        GuiSetStyleTemp(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+        GuiLabel(textBounds, message);
+        GuiSetStyleTemp(LABEL, TEXT_ALIGNMENT, prevTextAlignment);
+    }
+
+    int prevTextBoxAlignment = GuiGetStyle(TEXTBOX, TEXT_ALIGNMENT);
+    GuiSetStyleTemp(TEXTBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+
+    if (secretViewActive != NULL)
+    {
+        static char stars[] = "****************";
+        if (GuiTextBox(RAYGUI_CLITERAL(Rectangle){ textBoxBounds.x, textBoxBounds.y, textBoxBounds.width - 4 - textBoxHeight, textBoxBounds.height },
+            ((*secretViewActive == 1) || textEditMode)? text : stars, textSize, textEditMode) == RESULT_PRESSED) textEditMode = !textEditMode;
+
+#if defined(RAYGUI_NO_ICONS)
+        GuiToggle(RAYGUI_CLITERAL(Rectangle){ textBoxBounds.x + textBoxBounds.width - textBoxHeight, textBoxBounds.y, textBoxHeight, textBoxHeight },
+            (*secretViewActive == 1)? "O" : "*", secretViewActive);
+#else
+        GuiToggle(RAYGUI_CLITERAL(Rectangle){ textBoxBounds.x + textBoxBounds.width - textBoxHeight, textBoxBounds.y, textBoxHeight, textBoxHeight },
+            (*secretViewActive == 1)? GuiIconText(ICON_EYE_ON, NULL) : GuiIconText(ICON_EYE_OFF, NULL), secretViewActive);
+#endif
+    }
+    else
+    {
+        if (GuiTextBox(textBoxBounds, text, textSize, textEditMode) == RESULT_PRESSED)
+            textEditMode = !textEditMode;
+    }
+
+    GuiSetStyleTemp(TEXTBOX, TEXT_ALIGNMENT, prevTextBoxAlignment);
+
+    int prevBtnTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+
+    for (int i = 0; i < buttonCount; i++)
+    {
+        if (GuiButton(buttonBounds, btnTextList[i]))
+        {
+            *btnActive = i + 1;
+            result = RESULT_PRESSED;
+        }
+
+        buttonBounds.x += (buttonBounds.width + buttonPadding);
+    }
+
+    if (result == RESULT_PRESSED) textEditMode = false;
+    guiContext->textInputBoxEditMode = textEditMode;
+
+    GuiSetStyleTemp(BUTTON, TEXT_ALIGNMENT, prevBtnTextAlignment);
+    //--------------------------------------------------------------------
+
+    GuiPopID();
+    RAYGUI_PROFILE_END("GuiTextInputBox");
+    return result;
+}
+
+// Grid control
+// NOTE: Returns grid mouse-hover selected cell
+// About drawing lines at subpixel spacing, simple put, not easy solution:
+// REF: https://stackoverflow.com/questions/4435450/2d-opengl-drawing-lines-that-dont-exactly-fit-pixel-raster
+int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vector2 *mouseCell)
+{
+    // Grid lines alpha amount
+    #if !defined(RAYGUI_GRID_ALPHA)
+        #define RAYGUI_GRID_ALPHA    0.15f
+    #endif
+
+    GuiGetControlID(bounds);
+
+    RAYGUI_PROFILE_BEGIN("GuiGrid");
+
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+
+    Vector2 mousePoint = GUI_POINTER_POSITION;
+    Vector2 currentMouseCell = { -1, -1 };
+
+    float spaceWidth = spacing/(float)subdivs;
+    int linesV = (int)(bounds.width/spaceWidth) + 1;
+    int linesH = (int)(bounds.height/spaceWidth) + 1;
+
+    int color = GuiGetStyle(DEFAULT, LINE_COLOR);
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    {
+        if (GuiCheckHover(mousePoint, bounds))
+        {
+            // NOTE: Cell values must be the upper left of the cell the mouse is in
+            currentMouseCell.x = floorf((mousePoint.x - bounds.x)/spacing);
+            currentMouseCell.y = floorf((mousePoint.y - bounds.y)/spacing);
+
+            result = RESULT_PRESSED;
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (state == STATE_DISABLED) color = GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED);
+
+    if (subdivs > 0)
+    {
+        // Draw vertical grid lines
+        for (int i = 0; i < linesV; i++)
+        {
+            Rectangle lineV = { bounds.x + spacing*i/subdivs, bounds.y, 1, bounds.height + 1 };
+            GuiDrawRectangle(lineV, 0, BLANK, ((i%subdivs) == 0)? GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*4) : GuiFade(GetColor(color), RAYGUI_GRID_ALPHA));
+        }
+
+        // Draw horizontal grid lines
+        for (int i = 0; i < linesH; i++)
+        {
+            Rectangle lineH = { bounds.x, bounds.y + spacing*i/subdivs, bounds.width + 1, 1 };
+            GuiDrawRectangle(lineH, 0, BLANK, ((i%subdivs) == 0)? GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*4) : GuiFade(GetColor(color), RAYGUI_GRID_ALPHA));
+        }
+    }
+
+    if (mouseCell != NULL) *mouseCell = currentMouseCell;
+
+    RAYGUI_PROFILE_END("GuiGrid");
+    return result;
+}
+
+// Grid control, infinite canvas with pan and zoom
+// NOTE: Offset is the canvas point at bounds top-left and zoom the screen pixels per canvas unit,
+// mouse wheel zooms around pointer and secondary button drags the canvas; lines closer than
+// RAYGUI_GRID_MIN_LINE_SPACING pixels are not drawn (next subdivision level is used), so lines count
+// only depends on bounds size, independently of zoom, all lines drawn as one rectangles stream
+int GuiGridEx(Rectangle bounds, const char *text, float spacing, int subdivs, Vector2 *offset, float *zoom, Vector2 *mouseCell)
+{
+    // Grid lines alpha amount
+    #if !defined(RAYGUI_GRID_ALPHA)
+        #define RAYGUI_GRID_ALPHA    0.15f
+    #endif
+    // Minimum screen distance between lines, denser levels are not drawn
+    #if !defined(RAYGUI_GRID_MIN_LINE_SPACING)
+        #define RAYGUI_GRID_MIN_LINE_SPACING     4
+    #endif
+    #if !defined(RAYGUI_GRID_ZOOM_MIN)
+        #define RAYGUI_GRID_ZOOM_MIN          0.001f
+    #endif
+    #if !defined(RAYGUI_GRID_ZOOM_MAX)
+        #define RAYGUI_GRID_ZOOM_MAX          1000.0f
+    #endif
+    // Zoom factor per mouse wheel step
+    #if !defined(RAYGUI_GRID_ZOOM_STEP)
+        #define RAYGUI_GRID_ZOOM_STEP         1.1f
+    #endif
+
+    GuiID id = GuiGetControlID(bounds);
+
+    RAYGUI_PROFILE_BEGIN("GuiGridEx");
+
+    int result = RESULT_NONE;
+    GuiState state = guiState;
+    (void)text;     // Grid has no text, parameter kept for controls signature consistency
+
+    Vector2 tempOffset = { 0 };
+    float tempZoom = 1.0f;
+    if (offset == NULL) offset = &tempOffset;
+    if (zoom == NULL) zoom = &tempZoom;
+    if (*zoom < RAYGUI_GRID_ZOOM_MIN) *zoom = RAYGUI_GRID_ZOOM_MIN;
+    else if (*zoom > RAYGUI_GRID_ZOOM_MAX) *zoom = RAYGUI_GRID_ZOOM_MAX;
+
+    Vector2 mousePoint = GUI_POINTER_POSITION;
+    Vector2 currentMouseCell = { -1, -1 };
+
+    // Retained pan state: panning flag and previous pointer position
+    bool valid = false;
+    unsigned char *data = (unsigned char *)GuiGetControlCache(id, 2, &valid);
+    bool panning = false;
+    Vector2 panPoint = { 0 };
+    if (valid)
+    {
+        memcpy(&panning, data, sizeof(bool));
+        memcpy(&panPoint, data + sizeof(bool), sizeof(Vector2));
+    }
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    {
+        bool hover = GuiCheckHover(mousePoint, bounds);
+
+        if (panning && GUI_BUTTON_DOWN_ALT)
+        {
+            offset->x -= (mousePoint.x - panPoint.x)/(*zoom);
+            offset->y -= (mousePoint.y - panPoint.y)/(*zoom);
+            if ((mousePoint.x != panPoint.x) || (mousePoint.y != panPoint.y)) result = RESULT_CHANGED;
+        }
+        else panning = hover && GUI_BUTTON_DOWN_ALT;
+
+        if (hover)
+        {
+            float wheel = GUI_SCROLL_DELTA;
+
+            if (wheel != 0.0f)
+            {
+                // Zoom around pointer, canvas point under pointer does not move
+                Vector2 point = { offset->x + (mousePoint.x - bounds.x)/(*zoom), offset->y + (mousePoint.y - bounds.y)/(*zoom) };
+
+                *zoom *= powf(RAYGUI_GRID_ZOOM_STEP, wheel);
+                if (*zoom < RAYGUI_GRID_ZOOM_MIN) *zoom = RAYGUI_GRID_ZOOM_MIN;
+                else if (*zoom > RAYGUI_GRID_ZOOM_MAX) *zoom = RAYGUI_GRID_ZOOM_MAX;
+
+                offset->x = point.x - (mousePoint.x - bounds.x)/(*zoom);
+                offset->y = point.y - (mousePoint.y - bounds.y)/(*zoom);
+                result = RESULT_CHANGED;
+            }
+
+            // NOTE: Cell values must be the upper left of the cell the mouse is in, in canvas cells
+            if (spacing > 0.0f)
+            {
+                currentMouseCell.x = floorf((offset->x + (mousePoint.x - bounds.x)/(*zoom))/spacing);
+                currentMouseCell.y = floorf((offset->y + (mousePoint.y - bounds.y)/(*zoom))/spacing);
+            }
+
+            if (result == RESULT_NONE) result = RESULT_PRESSED;
+        }
+    }
+    else panning = false;
+
+    panPoint = mousePoint;
+    if (data != NULL)
+    {
+        memcpy(data, &panning, sizeof(bool));
+        memcpy(data + sizeof(bool), &panPoint, sizeof(Vector2));
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    int color = GuiGetStyle(DEFAULT, LINE_COLOR);
+    if (state == STATE_DISABLED) color = GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED);
+
+    if ((spacing > 0.0f) && (subdivs > 0))
+    {
+        // Select finest subdivision level with lines at least RAYGUI_GRID_MIN_LINE_SPACING pixels apart,
+        // coarser levels are multiples of subdivs (multiples of 2 if grid has no subdivisions)
+        int levelFactor = (subdivs > 1)? subdivs : 2;
+        double step = (double)spacing/subdivs;
+        for (int i = 0; (i < 64) && ((step*(*zoom)) < RAYGUI_GRID_MIN_LINE_SPACING); i++) step *= levelFactor;
+
+        // Finest level fades in with its lines density (until next level would be selected), every coarser
+        // level a line belongs to adds RAYGUI_GRID_ALPHA, so lines alpha does not jump when zoom crosses levels
+        float fade = (float)((step*(*zoom) - RAYGUI_GRID_MIN_LINE_SPACING)/(RAYGUI_GRID_MIN_LINE_SPACING*(levelFactor - 1)));
+        if (fade > 1.0f) fade = 1.0f;
+        Color levelColors[5] = { 0 };
+        for (int i = 0; i < 5; i++) levelColors[i] = GuiFade(GetColor(color), guiAlpha*RAYGUI_GRID_ALPHA*(((i + fade) < 4.0f)? i + fade : 4.0f));
+
+        // Draw only lines inside bounds and clip region
+        Rectangle view = GuiGetClip();
+        float minX = (view.x > bounds.x)? view.x : bounds.x;
+        float minY = (view.y > bounds.y)? view.y : bounds.y;
+        float maxX = ((view.x + view.width) < (bounds.x + bounds.width))? view.x + view.width : bounds.x + bounds.width;
+        float maxY = ((view.y + view.height) < (bounds.y + bounds.height))? view.y + view.height : bounds.y + bounds.height;
+
+        // Draw vertical and horizontal grid lines
+        for (int axis = 0; axis < 2; axis++)
+        {
+            float screenMin = (axis == 0)? minX : minY;
+            float screenMax = (axis == 0)? maxX : maxY;
+            float origin = (axis == 0)? bounds.x : bounds.y;
+            double canvasOffset = (axis == 0)? offset->x : offset->y;
+
+            if ((screenMax <= screenMin) || ((step*(*zoom)) < RAYGUI_GRID_MIN_LINE_SPACING)) continue;
+
+            long long first = (long long)ceil((canvasOffset + (screenMin - origin)/(*zoom))/step);
+            long long last = (long long)floor((canvasOffset + (screenMax - origin)/(*zoom))/step);
+
+            for (long long i = first; i <= last; i++)
+            {
+                // Line level, number of coarser levels the line belongs to
+                int level = 0;
+                for (long long index = i; (level < 4) && ((index%levelFactor) == 0); index /= levelFactor) level++;
+
+                if (levelColors[level].a == 0) continue;
+
+                int position = (int)(origin + (i*step - canvasOffset)*(*zoom));
+
+                if (axis == 0) GuiCmdDrawRectangle(position, (int)minY, 1, (int)(maxY - minY), levelColors[level]);
+                else GuiCmdDrawRectangle((int)minX, position, (int)(maxX - minX), 1, levelColors[level]);
+            }
+
+            RAYGUI_STATS_ADD(rectangles, (last >= first)? (int)(last - first + 1) : 0);
+        }
+    }
+
+    if (mouseCell != NULL) *mouseCell = currentMouseCell;
+
+    RAYGUI_PROFILE_END("GuiGridEx");
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Tooltip management functions
+// NOTE: Tooltips requires some global variables: tooltipPtr
+//----------------------------------------------------------------------------------
+// Enable gui tooltips (global state)
+void GuiEnableTooltip(void) { guiTooltip = true; }
+
+// Disable gui tooltips (global state)
+void GuiDisableTooltip(void) { guiTooltip = false; }
+
+// Set tooltip string
+void GuiSetTooltip(const char *tooltip) { guiTooltipPtr = tooltip; }
+
+//----------------------------------------------------------------------------------
+// Styles loading functions
+//----------------------------------------------------------------------------------
+
+// Load raygui style file (.rgs)
+// NOTE: By default a binary file is expected, that file could contain a custom font,
+// in that case, custom font image atlas is GRAY+ALPHA and pixel data can be compressed (DEFLATE)
+// NOTE: Text style font with a charset of RAYGUI_GLYPH_CACHE_MIN_CODEPOINTS (512) or more codepoints
+// is loaded as a lazy font (GuiLoadFontLazy()), glyphs rasterized on first use (raylib only)
+void GuiLoadStyle(const char *fileName)
+{
+    #define MAX_LINE_BUFFER_SIZE    256
+
+    RAYGUI_PROFILE_BEGIN("GuiLoadStyle");
+
+    bool tryBinary = false;
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+    // Style properties are loaded unscaled, resolved for gui scale once loaded
+    float scale = guiScale;
+    guiScale = 1.0f;
+
+    // Try reading the files as text file first
+    FILE *rgsFile = fopen(fileName, "rt");
+
+    if (rgsFile != NULL)
+    {
+        char buffer[MAX_LINE_BUFFER_SIZE] = { 0 };
+        fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
+
+        if (buffer[0] == '#')
+        {
+            int controlId = 0;
+            int propertyId = 0;
+            unsigned int propertyValue = 0;
+            unsigned int version = 0;
+
+            while (!feof(rgsFile))
+            {
+                switch (buffer[0])
+                {
+                    case 'v':
+                    {
+                        sscanf(buffer, "v %d", &version);
+                    }
+                    case 'p':
+                    {
+                        // Style property: p <control_id> <property_id> <property_value> <property_name>
+
+                        sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue);
+                        GuiSetStyle(controlId, propertyId, (int)propertyValue);
+
+                    } break;
+                    case 'f':
+                    {
+                        // Style font: f <gen_font_size> <font_file> <charmap_file>
+
+                        int fontSize = 0;
+                        char charmapFileName[32] = { 0 };
+                        char fontFileName[32] = { 0 };
+
+                        if (version >= 600) sscanf(buffer, "f %d %31s %31[^\r\n]s", &fontSize, fontFileName, charmapFileName);
+                        else sscanf(buffer, "f %d %31s %31[^\r\n]s", &fontSize, charmapFileName, fontFileName);
+
+                        // GLOBAL: Copy font file name into guiFontName
+                        snprintf(guiFontName, 32, "%s", fontFileName);
+
+                        // Font and charset files are kept, font atlas is generated at gui scale, matching
+                        // resolved text size, and generated again by GuiSetScale() on scale changes
+                        guiStyleFontFile[0] = '\0';
+                        guiStyleFontCharset[0] = '\0';
+                        guiStyleFontSize = fontSize;
+
+                        if (fontFileName[0] != '\0') snprintf(guiStyleFontFile, RAYGUI_STYLE_FONT_PATH_SIZE, "%s", TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName));
+                        if ((charmapFileName[0] != '0') && (charmapFileName[0] != '\0')) snprintf(guiStyleFontCharset, RAYGUI_STYLE_FONT_PATH_SIZE, "%s", TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
+
+                        // If font not properly loaded, revert to default font and size/spacing
+                        if ((guiStyleFontFile[0] == '\0') || !GuiLoadStyleFontFile(scale))
+                        {
+                            guiStyleFontFile[0] = '\0';
+
+                            GuiSetFont(GetFontDefault());
+                            GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
+                            GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
+                        }
+
+                    } break;
+                    default: break;
+                }
+
+                fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
+            }
+        }
+        else tryBinary = true;
+
+        fclose(rgsFile);
+    }
+
+    if (tryBinary)
+    {
+        rgsFile = fopen(fileName, "rb");
+
+        if (rgsFile != NULL)
+        {
+            fseek(rgsFile, 0, SEEK_END);
+            int fileDataSize = ftell(rgsFile);
+            fseek(rgsFile, 0, SEEK_SET);
+
+            if (fileDataSize > 0)
+            {
+                unsigned char *fileData = (unsigned char *)RAYGUI_CALLOC(fileDataSize, sizeof(unsigned char));
+                if (fileData != NULL)
+                {
+                    fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
+
+                    GuiLoadStyleFromMemory(fileData, fileDataSize);
+
+                    RAYGUI_FREE(fileData);
+                }
+            }
+
+            fclose(rgsFile);
+        }
+    }
+
+    guiScale = scale;
+    GuiResolveStyle();
+
+    RAYGUI_PROFILE_END("GuiLoadStyle");
+}
+
+// Load style from memory
+// WARNING: Binary files only
+void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
+{
+    // Style File Structure (.rgs)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGS "
+    // 4       | 2       | short      | Version: 200, 400, 600
+    // 6       | 2       | short      | reserved
+    // 8       | 4       | int        | Num properties (only changed ones from default style)
+
+    // Properties Data (8 bytes per property)
+    // WARNING: Only properties required that differ from default (light) internal style
+    // foreach (property)
+    // {
+    //   8+8*i  | 2       | short      | ControlId
+    //   8+8*i  | 2       | short      | PropertyId
+    //   8+8*i  | 4       | int        | PropertyValue
+    // }
+
+    // Custom Font Data : Parameters (64 bytes)
+    // ...     | 4       | int        | Font data size (0 - no font, no more fields added!)
+    // ...     | 32      | char       | Font filename (with extension) - VERSION: >=600
+    // ...     | 4       | int        | Font base size
+    // ...     | 4       | int        | Font glyph count [glyphCount]
+    // ...     | 4       | int        | Font type (0-NORMAL, 1-SDF)
+    // ...     | 16      | Rectangle  | Font white rectangle
+
+    // Custom Font Data : Image (20 bytes + imData)
+    // NOTE: Font image atlas is always converted to GRAY+ALPHA
+    // and atlas image data can be compressed (DEFLATE)
+    // ...     | 4       | int        | Image data size (uncompressed)
+    // ...     | 4       | int        | Image data size (compressed)
+    // ...     | 4       | int        | Image width
+    // ...     | 4       | int        | Image height
+    // ...     | 4       | int        | Image format: GRAY+ALPHA (expected)
+    // ...     | imSize  | byte       | Image data (comp or uncomp)
+
+    // Custom Font Data : Recs (32 bytes*glyphCount)
+    // NOTE: Font recs data can be compressed (DEFLATE)
+    // ...     | 4       | int        | Recs data compressed size (0 - not compressed, 1-compressed) - VERSION: >=400
+    //
+    // if (compRecsSize == 0)
+    // {
+    //    NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
+    //    foreach (glyph)
+    //    {
+    //       ...  | 16      | Rectangle  | Glyph rectangle (in image)
+    //    }
+    // }
+    // else
+    // {
+    //    ...  | compRecsSize | byte  | Rectangles data
+    // }
+    //
+
+    // Custom Font Data : Glyph Info (32 bytes*glyphCount)
+    // NOTE: Font glyphs info data can be compressed (DEFLATE)
+    // ...     | 4       | int        | Glyphs data compressed size (0 - not compressed) - VERSION: >=400
+    //
+    // if (compGlyphsSize == 0)
+    // {
+    //    NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
+    //    foreach (glyph)
+    //    {
+    //      ...   | 4       | int        | Glyph value
+    //      ...   | 4       | int        | Glyph offset X
+    //      ...   | 4       | int        | Glyph offset Y
+    //      ...   | 4       | int        | Glyph advance X
+    //    }
+    // }
+    // else
+    // {
+    //    ...  | compGlyphsSize | byte | Glyphs data
+    // }
+    // ------------------------------------------------------
+
+    // Indexed Style File Structure (.rgs) - VERSION: >=700
+    // NOTE: Sections are located from the table of contents, aligned to 16 bytes and
+    // stored with fixed layouts, so they can be used in place (i.e. memory mapped file data)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGS "
+    // 4       | 2       | short      | Version: 700
+    // 6       | 2       | short      | Num sections [sectionCount]
+    // 8       | 4       | int        | Data size (full file size)
+    // 12      | 4       | int        | Checksum: FNV-1a 32-bit of data after header [16..dataSize]
+
+    // Table Of Contents (16 bytes per section)
+    // foreach (section)
+    // {
+    //   16+16*i | 4     | int        | Section type: 1-STYLE, 2-FONT, 3-ATLAS, 4-RECS, 5-GLYPHS
+    //   16+16*i | 4     | int        | Section offset (from file start, multiple of 16)
+    //   16+16*i | 4     | int        | Section size
+    //   16+16*i | 4     | int        | Section param: STYLE: props per control, ATLAS: uncompressed size, RECS/GLYPHS: glyph count
+    // }
+
+    // Section STYLE: Resolved style table (controls*propsPerControl*4 bytes)
+    // NOTE: Full style table with DEFAULT properties already propagated, unscaled values
+    // ...     | 4       | int        | Property value [control*propsPerControl + property]
+
+    // Section FONT: Font parameters (80 bytes)
+    // ...     | 32      | char       | Font filename (with extension)
+    // ...     | 4       | int        | Font base size
+    // ...     | 4       | int        | Font glyph count [glyphCount]
+    // ...     | 4       | int        | Font type (0-NORMAL, 1-SDF)
+    // ...     | 4       | int        | Atlas image width
+    // ...     | 4       | int        | Atlas image height
+    // ...     | 4       | int        | Atlas image format: GRAY+ALPHA (expected)
+    // ...     | 8       | int        | reserved
+    // ...     | 16      | Rectangle  | Font white rectangle
+
+    // Section ATLAS: Font atlas image data (compressed (DEFLATE) if size differs from param)
+    // Section RECS: Font recs data (16 bytes*glyphCount), Rectangle per glyph
+    // Section GLYPHS: Font glyphs info data (16 bytes*glyphCount), value, offsetX, offsetY, advanceX
+    // ------------------------------------------------------
+
+    RAYGUI_PROFILE_BEGIN("GuiLoadStyleFromMemory");
+
+    // Style properties are loaded unscaled, resolved for gui scale once loaded
+    float scale = guiScale;
+    guiScale = 1.0f;
+
+    unsigned char *fileDataPtr = (unsigned char *)fileData;
+
+    char signature[5] = { 0 };
+    short version = 0;
+    short reserved = 0;
+    int propertyCount = 0;
+
+    memcpy(signature, fileDataPtr, 4);
+    memcpy(&version, fileDataPtr + 4, sizeof(short));
+    memcpy(&reserved, fileDataPtr + 4 + 2, sizeof(short));
+    memcpy(&propertyCount, fileDataPtr + 4 + 2 + 2, sizeof(int));
+    fileDataPtr += 12;
+
+    bool validSignature = ((signature[0] == 'r') &&
+                           (signature[1] == 'G') &&
+                           (signature[2] == 'S') &&
+                           (signature[3] == ' '));
+
+    // Indexed style data is not parsed sequentially, sections are located from its table of contents
+    if (validSignature && (version >= 700)) GuiLoadStyleIndexed(fileData, dataSize);
+    else if (validSignature)
+    {
+        short controlId = 0;
+        short propertyId = 0;
+        unsigned int propertyValue = 0;
+
+        for (int i = 0; i < propertyCount; i++)
+        {
+            memcpy(&controlId, fileDataPtr, sizeof(short));
+            memcpy(&propertyId, fileDataPtr + 2, sizeof(short));
+            memcpy(&propertyValue, fileDataPtr + 2 + 2, sizeof(unsigned int));
+            fileDataPtr += 8;
+
+            if (controlId == 0) // DEFAULT control
+            {
+                // If a DEFAULT property is loaded, it is propagated to all controls
+                // NOTE: All DEFAULT properties should be defined first in the file
+                GuiSetStyle(0, (int)propertyId, propertyValue);
+
+                if (propertyId < RAYGUI_MAX_PROPS_BASE) for (int j = 1; j < RAYGUI_MAX_CONTROLS; j++) GuiSetStyle(j, (int)propertyId, propertyValue);
+            }
+            else GuiSetStyle((int)controlId, (int)propertyId, propertyValue);
+        }
+
+        // Load custom font if available
+        // NOTE: Font texture loading requires raylib
+        int fontDataSize = 0;
+        memcpy(&fontDataSize, fileDataPtr, sizeof(int));
+        fileDataPtr += 4;
+
+        if (fontDataSize > 0)
+        {
+            Font font = { 0 };
+            int fontType = 0;   // 0-Normal, 1-SDF
+
+            // WARNING: Version 600 adds 32 bytes for the font filename (with extension)
+            if (version >= 600)
+            {
+                // GLOBAL: Copy font file name into guiFontName
+                memcpy(guiFontName, fileDataPtr, 32);
+                fileDataPtr += 32;
+            }
+            else memset(guiFontName, 0, 32);
+
+            memcpy(&font.baseSize, fileDataPtr, sizeof(int));
+            memcpy(&font.glyphCount, fileDataPtr + 4, sizeof(int));
+            memcpy(&fontType, fileDataPtr + 4 + 4, sizeof(int));
+            fileDataPtr += 12;
+
+            // Load font white rectangle
+            Rectangle fontWhiteRec = { 0 };
+            memcpy(&fontWhiteRec, fileDataPtr, sizeof(Rectangle));
+            fileDataPtr += 16;
+
+            // Load font image parameters
+            int fontImageUncompSize = 0;
+            int fontImageCompSize = 0;
+            memcpy(&fontImageUncompSize, fileDataPtr, sizeof(int));
+            memcpy(&fontImageCompSize, fileDataPtr + 4, sizeof(int));
+            fileDataPtr += 8;
+
+            Image imFont = { 0 };
+            imFont.mipmaps = 1;
+            memcpy(&imFont.width, fileDataPtr, sizeof(int));
+            memcpy(&imFont.height, fileDataPtr + 4, sizeof(int));
+            memcpy(&imFont.format, fileDataPtr + 4 + 4, sizeof(int));
+            fileDataPtr += 12;
+
+            if ((fontImageCompSize > 0) && (fontImageCompSize != fontImageUncompSize))
+            {
+                // Compressed font atlas image data (DEFLATE), it requires DecompressData()
+                int dataUncompSize = 0;
+                unsigned char *compData = (unsigned char *)RAYGUI_CALLOC(fontImageCompSize, sizeof(unsigned char));
+                memcpy(compData, fileDataPtr, fontImageCompSize);
+                fileDataPtr += fontImageCompSize;
+
+                imFont.data = DecompressData(compData, fontImageCompSize, &dataUncompSize);
+
+                // Security check, dataUncompSize must match the provided fontImageUncompSize
+                if (dataUncompSize != fontImageUncompSize) RAYGUI_LOG("WARNING: Uncompressed font atlas image data could be corrupted");
+
+                RAYGUI_FREE(compData);
+            }
+            else
+            {
+                // Font atlas image data is not compressed
+                imFont.data = (unsigned char *)RAYGUI_CALLOC(fontImageUncompSize, sizeof(unsigned char));
+                memcpy(imFont.data, fileDataPtr, fontImageUncompSize);
+                fileDataPtr += fontImageUncompSize;
+            }
+
+            // Load font recs data (glyphs position and size in the image atlas)
+            int recsDataSize = font.glyphCount*sizeof(Rectangle);
+            int recsDataCompressedSize = 0;
+
+            // WARNING: Version 400 adds the compression size parameter
+            if (version >= 400)
+            {
+                // RGS files version 400 support compressed recs data
+                memcpy(&recsDataCompressedSize, fileDataPtr, sizeof(int));
+                fileDataPtr += sizeof(int);
+            }
+
+            if ((recsDataCompressedSize > 0) && (recsDataCompressedSize != recsDataSize))
+            {
+                // Recs data is compressed, uncompress it
+                unsigned char *recsDataCompressed = (unsigned char *)RAYGUI_CALLOC(recsDataCompressedSize, sizeof(unsigned char));
+
+                memcpy(recsDataCompressed, fileDataPtr, recsDataCompressedSize);
+                fileDataPtr += recsDataCompressedSize;
+
+                int recsDataUncompSize = 0;
+                font.recs = (Rectangle *)DecompressData(recsDataCompressed, recsDataCompressedSize, &recsDataUncompSize);
+
+                // Security check, data uncompressed size must match the expected original data size
+                if (recsDataUncompSize != recsDataSize) RAYGUI_LOG("WARNING: Uncompressed font recs data could be corrupted");
+
+                RAYGUI_FREE(recsDataCompressed);
+            }
+            else
+            {
+                // Recs data is uncompressed
+                font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));
+                for (int i = 0; i < font.glyphCount; i++)
+                {
+                    memcpy(&font.recs[i], fileDataPtr, sizeof(Rectangle));
+                    fileDataPtr += sizeof(Rectangle);
+                }
+            }
+
+            // Load font glyphs info data
+            int glyphsDataSize = font.glyphCount*16;    // 16 bytes data per glyph
+            int glyphsDataCompressedSize = 0;
+
+            // WARNING: Version 400 adds the compression size parameter
+            if (version >= 400)
+            {
+                // RGS files version 400 support compressed glyphs data
+                memcpy(&glyphsDataCompressedSize, fileDataPtr, sizeof(int));
+                fileDataPtr += sizeof(int);
+            }
+
+            // Allocate required glyphs space to fill with data
+            font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+
+            if ((glyphsDataCompressedSize > 0) && (glyphsDataCompressedSize != glyphsDataSize))
+            {
+                // Glyphs data is compressed, uncompress it
+                unsigned char *glypsDataCompressed = (unsigned char *)RAYGUI_CALLOC(glyphsDataCompressedSize, sizeof(unsigned char));
+
+                memcpy(glypsDataCompressed, fileDataPtr, glyphsDataCompressedSize);
+                fileDataPtr += glyphsDataCompressedSize;
+
+                int glyphsDataUncompSize = 0;
+                unsigned char *glyphsDataUncomp = DecompressData(glypsDataCompressed, glyphsDataCompressedSize, &glyphsDataUncompSize);
+
+                // Security check, data uncompressed size must match the expected original data size
+                if (glyphsDataUncompSize != glyphsDataSize) RAYGUI_LOG("WARNING: Uncompressed font glyphs data could be corrupted");
+
+                unsigned char *glyphsDataUncompPtr = glyphsDataUncomp;
+
+                for (int i = 0; i < font.glyphCount; i++)
+                {
+                    memcpy(&font.glyphs[i].value, glyphsDataUncompPtr, sizeof(int));
+                    memcpy(&font.glyphs[i].offsetX, glyphsDataUncompPtr + 4, sizeof(int));
+                    memcpy(&font.glyphs[i].offsetY, glyphsDataUncompPtr + 8, sizeof(int));
+                    memcpy(&font.glyphs[i].advanceX, glyphsDataUncompPtr + 12, sizeof(int));
+                    glyphsDataUncompPtr += 16;
+                }
+
+                RAYGUI_FREE(glypsDataCompressed);
+                RAYGUI_FREE(glyphsDataUncomp);
+            }
+            else
+            {
+                // Glyphs data is uncompressed
+                for (int i = 0; i < font.glyphCount; i++)
+                {
+                    memcpy(&font.glyphs[i].value, fileDataPtr, sizeof(int));
+                    memcpy(&font.glyphs[i].offsetX, fileDataPtr + 4, sizeof(int));
                     memcpy(&font.glyphs[i].offsetY, fileDataPtr + 8, sizeof(int));
                     memcpy(&font.glyphs[i].advanceX, fileDataPtr + 12, sizeof(int));
                     fileDataPtr += 16;
                 }
             }
 
-#if defined(RAYGUI_FONT_ICONS_BAKING)
-            // Font atlas image icons baking
-            Rectangle updatedWhiteRec = { 0 };
-            guiIconFontOffsetY = GuiFontIconBaking(&imFont, font, &updatedWhiteRec);
-            if (guiIconFontOffsetY > 0) fontWhiteRec = updatedWhiteRec;
-#endif
+            GuiLoadStyleFont(font, fontType, &imFont, fontWhiteRec);
+
+            RAYGUI_FREE(imFont.data);
+        }
+    }
+
+    guiScale = scale;
+    GuiResolveStyle();
+
+    RAYGUI_PROFILE_END("GuiLoadStyleFromMemory");
+}
+
+// Load style file (.rgs) and watch it for changes, NULL to stop watching
+// NOTE: Watched file is checked by GuiBeginFrame(), GuiUpdateStyleWatch() can be called if not used
+bool GuiWatchStyle(const char *fileName)
+{
+    bool result = false;
+
+#if defined(RAYGUI_STYLE_HOT_RELOAD)
+    guiStyleWatchFileName[0] = '\0';
+    guiStyleWatchFontHash = 0;
+
+    if ((fileName != NULL) && (strlen(fileName) < RAYGUI_STYLE_WATCH_PATH_SIZE))
+    {
+        guiStyleWatchModTime = GetFileModTime(fileName);
+        guiStyleWatchPendingTime = guiStyleWatchModTime;
+        guiStyleWatchPendingSize = -1;
+
+        // NOTE: No font data hash available yet, first reload loads the full style
+        if (GuiReloadStyle(fileName) >= 0)
+        {
+            strcpy(guiStyleWatchFileName, fileName);
+            result = true;
+        }
+    }
+#else
+    (void)fileName;
+#endif
+
+    return result;
+}
+
+// Check watched style file, apply changed properties if file was modified
+// NOTE: File could be still being written, it is only reloaded once its modification time and size
+// are the same on two consecutive checks, returns the number of changed properties
+int GuiUpdateStyleWatch(void)
+{
+    int changed = 0;
+
+#if defined(RAYGUI_STYLE_HOT_RELOAD)
+    if (guiStyleWatchFileName[0] != '\0')
+    {
+        long modTime = GetFileModTime(guiStyleWatchFileName);
+
+        if (modTime != guiStyleWatchModTime)
+        {
+            long fileSize = GuiGetStyleFileSize(guiStyleWatchFileName);
+
+            if ((modTime == guiStyleWatchPendingTime) && (fileSize == guiStyleWatchPendingSize) && (fileSize > 0))
+            {
+                // Style file not valid (i.e. truncated) is not reloaded again until modified
+                changed = GuiReloadStyle(guiStyleWatchFileName);
+                guiStyleWatchModTime = modTime;
+                if (changed < 0) changed = 0;
+            }
+            else
+            {
+                guiStyleWatchPendingTime = modTime;
+                guiStyleWatchPendingSize = fileSize;
+            }
+        }
+    }
+#endif
+
+    return changed;
+}
+
+// Load style default over global style
+void GuiLoadStyleDefault(void)
+{
+    RAYGUI_PROFILE_BEGIN("GuiLoadStyleDefault");
+
+    // Setting this flag first to avoid cyclic function calls
+    // when calling GuiSetStyle() and GuiGetStyle()
+    guiStyleLoaded = true;
+
+    // Style properties are loaded unscaled, resolved for gui scale once loaded
+    float scale = guiScale;
+    guiScale = 1.0f;
+
+    // Initialize default LIGHT style property values
+    // WARNING: Default value are applied to all controls on set but
+    // they can be overwritten later on for every custom control
+    GuiSetStyle(DEFAULT, BORDER_COLOR_NORMAL, 0x838383ff);
+    GuiSetStyle(DEFAULT, BASE_COLOR_NORMAL, 0xc9c9c9ff);
+    GuiSetStyle(DEFAULT, TEXT_COLOR_NORMAL, 0x686868ff);
+    GuiSetStyle(DEFAULT, BORDER_COLOR_FOCUSED, 0x5bb2d9ff);
+    GuiSetStyle(DEFAULT, BASE_COLOR_FOCUSED, 0xc9effeff);
+    GuiSetStyle(DEFAULT, TEXT_COLOR_FOCUSED, 0x6c9bbcff);
+    GuiSetStyle(DEFAULT, BORDER_COLOR_PRESSED, 0x0492c7ff);
+    GuiSetStyle(DEFAULT, BASE_COLOR_PRESSED, 0x97e8ffff);
+    GuiSetStyle(DEFAULT, TEXT_COLOR_PRESSED, 0x368bafff);
+    GuiSetStyle(DEFAULT, BORDER_COLOR_DISABLED, 0xb5c1c2ff);
+    GuiSetStyle(DEFAULT, BASE_COLOR_DISABLED, 0xe6e9e9ff);
+    GuiSetStyle(DEFAULT, TEXT_COLOR_DISABLED, 0xaeb7b8ff);
+    GuiSetStyle(DEFAULT, BORDER_WIDTH, 1);
+    GuiSetStyle(DEFAULT, TEXT_PADDING, 0);
+    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+
+    // Initialize default extended property values
+    // NOTE: By default, extended property values are initialized to 0
+    GuiSetStyle(DEFAULT, TEXT_SIZE, 10);                // DEFAULT, shared by all controls
+    GuiSetStyle(DEFAULT, TEXT_SPACING, 1);              // DEFAULT, shared by all controls
+    GuiSetStyle(DEFAULT, LINE_COLOR, 0x90abb5ff);       // DEFAULT specific property
+    GuiSetStyle(DEFAULT, BACKGROUND_COLOR, 0xf5f5f5ff); // DEFAULT specific property
+    GuiSetStyle(DEFAULT, TEXT_LINE_SPACING, 12);        // DEFAULT, pixels between lines, from bottom of first line to top of second
+    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);   // DEFAULT, text aligned vertically to middle of text-bounds
+
+    // Initialize control-specific property values
+    // NOTE: Those properties are in default list but require specific values by control type
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+    GuiSetStyle(BUTTON, BORDER_WIDTH, 2);
+    GuiSetStyle(SLIDER, TEXT_PADDING, 4);
+    GuiSetStyle(PROGRESSBAR, TEXT_PADDING, 4);
+    GuiSetStyle(CHECKBOX, TEXT_PADDING, 4);
+    GuiSetStyle(CHECKBOX, TEXT_ALIGNMENT, TEXT_ALIGN_RIGHT);
+    GuiSetStyle(DROPDOWNBOX, TEXT_PADDING, 0);
+    GuiSetStyle(DROPDOWNBOX, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiSetStyle(TEXTBOX, TEXT_PADDING, 4);
+    GuiSetStyle(TEXTBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+    GuiSetStyle(VALUEBOX, TEXT_PADDING, 0);
+    GuiSetStyle(VALUEBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+    GuiSetStyle(STATUSBAR, TEXT_PADDING, 8);
+    GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+    GuiSetStyle(TABBAR, TAB_ITEMS_WIDTH, 160);
+
+    // Initialize extended property values
+    // NOTE: By default, extended property values are initialized to 0
+    GuiSetStyle(TOGGLE, GROUP_PADDING, 2);
+    GuiSetStyle(SLIDER, SLIDER_WIDTH, 16);
+    GuiSetStyle(SLIDER, SLIDER_PADDING, 1);
+    GuiSetStyle(PROGRESSBAR, PROGRESS_PADDING, 1);
+    GuiSetStyle(CHECKBOX, CHECK_PADDING, 1);
+    GuiSetStyle(COMBOBOX, COMBO_BUTTON_WIDTH, 32);
+    GuiSetStyle(COMBOBOX, COMBO_BUTTON_SPACING, 2);
+    GuiSetStyle(DROPDOWNBOX, ARROW_PADDING, 16);
+    GuiSetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING, 2);
+    GuiSetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH, 24);
+    GuiSetStyle(VALUEBOX, SPINNER_BUTTON_SPACING, 2);
+    GuiSetStyle(SCROLLBAR, BORDER_WIDTH, 0);
+    GuiSetStyle(SCROLLBAR, ARROWS_VISIBLE, 0);
+    GuiSetStyle(SCROLLBAR, ARROWS_SIZE, 6);
+    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING, 0);
+    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, 16);
+    GuiSetStyle(SCROLLBAR, SCROLL_PADDING, 0);
+    GuiSetStyle(SCROLLBAR, SCROLL_SPEED, 12);
+    GuiSetStyle(LISTVIEW, LIST_ITEMS_HEIGHT, 28);
+    GuiSetStyle(LISTVIEW, LIST_ITEMS_SPACING, 2);
+    GuiSetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH, 1);
+    GuiSetStyle(LISTVIEW, SCROLLBAR_WIDTH, 12);
+    GuiSetStyle(LISTVIEW, SCROLLBAR_SIDE, SCROLLBAR_RIGHT_SIDE);
+    GuiSetStyle(COLORPICKER, COLOR_SELECTOR_SIZE, 8);
+    GuiSetStyle(COLORPICKER, HUEBAR_WIDTH, 16);
+    GuiSetStyle(COLORPICKER, HUEBAR_PADDING, 8);
+    GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT, 8);
+    GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW, 2);
+
+    // Text style font is not generated again on scale changes
+    guiStyleFontFile[0] = '\0';
+    guiStyleFontTextureId = 0;
+
+    if (guiFont.texture.id != GetFontDefault().texture.id)
+    {
+        // Unload previous font texture, lazy font unloaded with its glyphs cache
+        if (GuiIsFontLazy()) GuiUnloadFontLazy();
+        else
+        {
+            UnloadTexture(guiFont.texture);
+            RAYGUI_FREE(guiFont.recs);
+            RAYGUI_FREE(guiFont.glyphs);
+        }
+        guiFont.recs = NULL;
+        guiFont.glyphs = NULL;
+
+        // Setup default raylib font
+        guiFont = GetFontDefault();
+        guiFontType = FONT_TYPE_NORMAL;
+
+        // NOTE: Default raylib font character 95 is a white square
+        Rectangle whiteChar = guiFont.recs[95];
+
+        // NOTE: Setting up a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
+        SetShapesTexture(guiFont.texture, RAYGUI_CLITERAL(Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 });
+
+        // Reset baked icons offset in font
+        guiIconFontOffsetY = 0;
+    }
+
+    guiScale = scale;
+    GuiResolveStyle();
+
+    RAYGUI_PROFILE_END("GuiLoadStyleDefault");
+}
+
+// Get text with icon id prepended
+// NOTE: Useful to add icons by name id (enum) instead of
+// a number that can change between ricon versions
+const char *GuiIconText(int iconId, const char *text)
+{
+#if defined(RAYGUI_NO_ICONS)
+    return NULL;
+#else
+    char *buffer = guiContext->iconTextBuffer;
+    char *iconBuffer = guiContext->iconTextIconBuffer;
+
+    if (text != NULL)
+    {
+        memset(buffer, 0, 1024);
+        snprintf(buffer, 1024, "#%03i#", iconId);
+
+        int i = 5;
+        for (; i < 1024; i++)
+        {
+            buffer[i] = text[i - 5];
+            if (text[i - 5] == '\0') break;
+        }
+
+        RAYGUI_STATS_ADD(bufferBytes, 1024 + i);
+
+        return buffer;
+    }
+    else
+    {
+        snprintf(iconBuffer, 16, "#%03i#", iconId);
+        RAYGUI_STATS_ADD(bufferBytes, 6);
+
+        return iconBuffer;
+    }
+#endif
+}
+
+#if !defined(RAYGUI_NO_ICONS)
+// Get full icons data pointer
+unsigned int *GuiGetIcons(void) { return guiIconsPtr; }
+
+// Load raygui icons file (.rgi)
+// WARNING: guiIconsName[]][] memory should be manually freed!
+char **GuiLoadIcons(const char *fileName, bool loadIconsName)
+{
+    FILE *rgiFile = fopen(fileName, "rb");
+    char **guiIconsName = NULL;
+
+    if (rgiFile != NULL)
+    {
+        unsigned char *fileData = NULL;
+        int dataSize = 0;
+
+        fseek(rgiFile, 0, SEEK_END);
+        int size = (int)ftell(rgiFile);
+        fseek(rgiFile, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            fileData = (unsigned char *)RL_CALLOC(size, sizeof(unsigned char));
+            // WARNING: File can be partially loaded but ignoring it for simplicity
+            dataSize = (int)fread(fileData, sizeof(unsigned char), size, rgiFile);
+
+            guiIconsName = GuiLoadIconsFromMemory(fileData, dataSize, loadIconsName);
+        }
+
+        fclose(rgiFile);
+    }
+
+    return guiIconsName;
+}
+
+// Load icons from memory
+// GLOBAL: Updates global variable: guiIconsPtr
+char **GuiLoadIconsFromMemory(const unsigned char *fileData, int dataSize, bool loadIconsName)
+{
+    // Icon File Structure (.rgi)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGI "
+    // 4       | 2       | short      | Version: 100, 500
+    // 6       | 2       | short      | reserved
+
+    // 8       | 2       | short      | Num icons (N)
+    // 10      | 2       | short      | Icons Size (Options: 16, 32, 64)
+
+    // Icons name id (32 bytes per name id)
+    // foreach (icon)
+    // {
+    //   12+32*i  | 32   | char       | Icon NameId
+    // }
+
+    // Icons data: One bit per pixel, stored as unsigned int array (depends on icon size)
+    // Size*Size pixels/32bit per unsigned int = K unsigned int per icon
+    // foreach (icon)
+    // {
+    //   ...   | K       | unsigned int | Icon Data
+    // }
+    // ------------------------------------------------------
+
+    unsigned char *fileDataPtr = (unsigned char *)fileData;
+    char **guiIconsName = NULL;
+
+    char signature[5] = { 0 };
+    short version = 0;
+    short reserved = 0;
+    short iconCount = 0;
+    short iconSize = 0;
+
+    memcpy(signature, fileDataPtr, 4);
+    memcpy(&version, fileDataPtr + 4, sizeof(short));
+    memcpy(&reserved, fileDataPtr + 4 + 2, sizeof(short));
+    memcpy(&iconCount, fileDataPtr + 4 + 2 + 2, sizeof(short));
+    memcpy(&iconSize, fileDataPtr + 4 + 2 + 2 + 2, sizeof(short));
+    fileDataPtr += 12;
+
+    if ((signature[0] == 'r') &&
+        (signature[1] == 'G') &&
+        (signature[2] == 'I') &&
+        (signature[3] == ' '))
+    {
+        if (loadIconsName)
+        {
+            // NOTE: Always allocating RAYGUI_ICON_MAX_ICONS names slots
+            guiIconsName = (char **)RAYGUI_CALLOC(RAYGUI_ICON_MAX_ICONS, sizeof(char *));
+            for (int i = 0; i < iconCount; i++)
+            {
+                guiIconsName[i] = (char *)RAYGUI_CALLOC(RAYGUI_ICON_MAX_NAME_LENGTH, sizeof(char));
+                memcpy(guiIconsName[i], fileDataPtr, RAYGUI_ICON_MAX_NAME_LENGTH);
+                fileDataPtr += RAYGUI_ICON_MAX_NAME_LENGTH;
+            }
+        }
+        else
+        {
+            // Skip icon name data if not required
+            fileDataPtr += iconCount*RAYGUI_ICON_MAX_NAME_LENGTH;
+        }
+
+        int iconDataSize = iconCount*((int)iconSize*(int)iconSize/32)*(int)sizeof(unsigned int);
+        guiIconsPtr = (unsigned int *)RAYGUI_CALLOC(iconDataSize, 1);
+
+        memcpy(guiIconsPtr, fileDataPtr, iconDataSize);
+    }
+
+    return guiIconsName;
+}
+
+// Draw selected icon using rectangles pixel-by-pixel
+void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
+{
+    if (GuiIsCulled(RAYGUI_CLITERAL(Rectangle){ (float)posX, (float)posY, (float)(RAYGUI_ICON_SIZE*pixelSize), (float)(RAYGUI_ICON_SIZE*pixelSize) })) return;
+
+    RAYGUI_PROFILE_BEGIN("GuiDrawIcon");
+
+    if ((guiIconFontOffsetY > 0) && (iconId < RAYGUI_ICON_MAX_FONT_BACKED))
+    {
+        int maxIconsPerLine = guiFont.texture.width/(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING);
+        int x = iconId%maxIconsPerLine;
+        int y = iconId/maxIconsPerLine;
+
+        Rectangle srcRec = { (float)x*(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING) + RAYGUI_ICON_FONT_ATLAS_PADDING,
+            guiIconFontOffsetY + (float)y*(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING) + RAYGUI_ICON_FONT_ATLAS_PADDING,
+            RAYGUI_ICON_SIZE, RAYGUI_ICON_SIZE };
+        Rectangle dstRec = { (float)posX, (float)posY, (float)pixelSize*RAYGUI_ICON_SIZE, (float)pixelSize*RAYGUI_ICON_SIZE };
+
+        GuiCmdDrawTexture(guiFont.texture, srcRec, dstRec, color);
+    }
+    else
+    {
+        #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
+
+        for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
+        {
+            for (int k = 0; k < 32; k++)
+            {
+                if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+                {
+                    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ (float)posX + (k%RAYGUI_ICON_SIZE)*pixelSize,
+                        (float)posY + y*pixelSize, (float)pixelSize, (float)pixelSize }, 0, BLANK, color);
+                    RAYGUI_STATS_ADD(iconPixels, 1);
+                }
+
+                if ((k == 15) || (k == 31)) y++;
+            }
+        }
+    }
+
+    RAYGUI_PROFILE_END("GuiDrawIcon");
+}
+
+// Set icon drawing size
+// NOTE: Scale is already resolved for gui scale, unscaled value is kept for next scale changes
+void GuiSetIconScale(int scale)
+{
+    if (scale >= 1)
+    {
+        guiIconScale = scale;
+        guiIconScaleBase = (float)scale/guiScale;
+    }
+}
+
+// Get text width considering gui style and icon size (if required).
+// For multi-line text (containing '\n'), returns the width of the widest line.
+int GuiGetTextWidth(const char *text)
+{
+    if (text == NULL) return 0;
+
+    int maxWidth = 0;
+    const char *linePtr = text;
+
+    while ((linePtr[0] != '\0') && ((linePtr - text) < MAX_LINE_BUFFER_SIZE))
+    {
+        int lineWidth = GetLineWidth(linePtr);
+        if (lineWidth > maxWidth) maxWidth = lineWidth;
+
+        // Skip to the next '\n' (or end of string/buffer)
+        int lineSize = (int)strcspn(linePtr, "\n");
+        int bufferLeft = MAX_LINE_BUFFER_SIZE - (int)(linePtr - text);
+        linePtr += (lineSize < bufferLeft)? lineSize : bufferLeft;
+
+        // Advance past the '\n' delimiter to the start of the next line
+        if (linePtr[0] == '\n') linePtr++;
+    }
+
+    return maxWidth;
+}
+
+#endif      // !RAYGUI_NO_ICONS
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get text line width (stops at '\n' or '\0')
+// NOTE: Considers icon marker '#NNN#'
+static int GetLineWidth(const char *text)
+{
+#if !defined(RAYGUI_ICON_TEXT_PADDING)
+    #define RAYGUI_ICON_TEXT_PADDING   4
+#endif
+
+    RAYGUI_PROFILE_BEGIN("GetLineWidth");
+
+    Vector2 textSize = { 0 };
+    int textIconOffset = 0;
+
+    if ((text != NULL) && (text[0] != '\0'))
+    {
+        // Icon marker: '#' + 1..3 digits + '#' (matches GetTextIcon())
+        if (text[0] == '#')
+        {
+            int pos = 1;
+            while ((pos < 4) && (text[pos] >= '0') && (text[pos] <= '9')) pos++;
+            if (text[pos] == '#') textIconOffset = pos + 1;
+        }
+
+        text += textIconOffset;
+
+        // Make sure guiFont is set, GuiGetStyle() initializes it lazynessly
+        float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+
+        // Custom MeasureText() implementation -- single line only
+        if ((guiFont.texture.id > 0) && (text != NULL))
+        {
+            RAYGUI_STATS_ADD(textMeasures, 1);
+
+            // Get size in bytes of the line, considering end of line and line break
+            int size = (int)strcspn(text, "\n");
+            if (size > MAX_LINE_BUFFER_SIZE) size = MAX_LINE_BUFFER_SIZE;
+
+            float scaleFactor = fontSize/(float)guiFont.baseSize;
+            float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+            textSize.y = (float)guiFont.baseSize*scaleFactor;
+            float glyphWidth = 0.0f;
+            const int *asciiGlyphs = GetAsciiGlyphs();
+
+            for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
+            {
+                // Measure ASCII span with glyphs indices from table, no decoding required
+                for (int spanEnd = i + GetAsciiLength(&text[i], size - i); i < spanEnd; i++)
+                {
+                    int codepointIndex = asciiGlyphs[(int)text[i]];
+
+                    if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
+                    else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+
+                    textSize.x += (glyphWidth + spacing);
+                }
+
+                if (i >= size) break;
+
+                int codepoint = GetCodepointNext(&text[i], &codepointSize);
+                int codepointIndex = GuiGetGlyphIndex(codepoint);
+
+                if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
+                else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+
+                textSize.x += (glyphWidth + spacing);
+            }
+        }
+
+        if (textIconOffset > 0) textSize.x += (RAYGUI_ICON_SIZE + RAYGUI_ICON_TEXT_PADDING);
+    }
+
+    RAYGUI_PROFILE_END("GetLineWidth");
+
+    return (int)textSize.x;
+}
+
+// Get leading ASCII bytes count (< 0x80), up to provided length
+// NOTE: Bytes are checked 8 at a time (SWAR), loaded with memcpy() so no alignment is required
+static int GetAsciiLength(const char *text, int length)
+{
+    int count = 0;
+
+    for (; (count + 8) <= length; count += 8)
+    {
+        unsigned long long bytes = 0;
+        memcpy(&bytes, text + count, 8);
+        if (bytes & 0x8080808080808080ull) break;
+    }
+
+    while ((count < length) && (((unsigned char)text[count] & 0x80) == 0)) count++;
+
+    return count;
+}
+
+// Get current font glyphs indices for ASCII codepoints
+// NOTE: Table is rebuilt with GetGlyphIndex() when font changes, avoiding the glyphs search per character
+static const int *GetAsciiGlyphs(void)
+{
+    if ((guiGlyphTable.glyphs != guiFont.glyphs) || (guiGlyphTable.glyphCount != guiFont.glyphCount) || (guiGlyphTable.textureId != guiFont.texture.id))
+    {
+        for (int i = 0; i < 128; i++) guiGlyphTable.indices[i] = (guiFont.glyphs != NULL)? GetGlyphIndex(guiFont, i) : 0;
+
+        guiGlyphTable.glyphs = guiFont.glyphs;
+        guiGlyphTable.glyphCount = guiFont.glyphCount;
+        guiGlyphTable.textureId = guiFont.texture.id;
+    }
+
+    return guiGlyphTable.indices;
+}
+
+// Check if current font is a lazy font (glyphs rasterized on first use)
+static bool GuiIsFontLazy(void)
+{
+    return ((guiGlyphCache != NULL) && (guiFont.glyphs == guiGlyphCache->glyphs));
+}
+
+// Get current font glyph index for a codepoint
+// NOTE: Lazy fonts glyphs are rasterized if required, '?' glyph index returned while pending
+static int GuiGetGlyphIndex(int codepoint)
+{
+#if !defined(RAYGUI_STANDALONE)
+    if (GuiIsFontLazy()) return GuiGetCachedGlyph(guiGlyphCache, codepoint);
+#endif
+    return GetGlyphIndex(guiFont, codepoint);
+}
+
+// Get current font to draw a codepoint
+// NOTE: Lazy fonts return a single glyph font view, so backend glyph search is immediate
+static Font GuiGetGlyphFont(int codepoint)
+{
+    Font font = guiFont;
+
+#if !defined(RAYGUI_STANDALONE)
+    if (GuiIsFontLazy())
+    {
+        int index = GuiGetCachedGlyph(guiGlyphCache, codepoint);
+
+        font.glyphs = &guiGlyphCache->glyphs[index];
+        font.recs = &guiGlyphCache->recs[index];
+        font.glyphCount = 1;
+    }
+#else
+    (void)codepoint;
+#endif
+
+    return font;
+}
+
+// Get current font glyphs generation, changes when lazy font glyphs are added
+// NOTE: Required by retained text measures, pending glyphs are measured as '?'
+static unsigned int GuiGetGlyphGeneration(void)
+{
+    return GuiIsFontLazy()? guiGlyphCache->generation : 0;
+}
+
+#if !defined(RAYGUI_STANDALONE)
+// Get lazy font glyph slot for a codepoint, rasterized if required
+// NOTE: Up to RAYGUI_GLYPH_CACHE_FRAME_BUDGET glyphs are rasterized per frame, '?' slot returned while pending,
+// while recording a command list cache is not modified, GuiDrawCommandLists() rasterizes glyphs recorded as '?'
+static int GuiGetCachedGlyph(GuiGlyphCache *cache, int codepoint)
+{
+#if defined(RAYGUI_COMMAND_LISTS)
+    bool recording = (guiCommandList != NULL);
+#else
+    bool recording = false;
+#endif
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        unsigned int probe = ((unsigned int)codepoint*2654435761u) & (RAYGUI_GLYPH_CACHE_MAX_GLYPHS*2 - 1);
+
+        for (; cache->map[probe] != 0; probe = (probe + 1) & (RAYGUI_GLYPH_CACHE_MAX_GLYPHS*2 - 1))
+        {
+            int slot = cache->map[probe] - 1;
+
+            if (cache->glyphs[slot].value == codepoint)
+            {
+                // Pages used by recorded glyphs are stamped when lists are drawn
+                if (!recording) cache->pageFrame[cache->pages[slot]] = cache->frame;
+                return slot;
+            }
+        }
+
+        // Atlas texture is not updated while recording, it could be recorded out of the rendering thread
+        if ((pass > 0) || recording) break;
+
+        // Glyph not resident, rasterized if frame budget allows it
+        if (cache->budgetFrame != cache->frame)
+        {
+            cache->budgetFrame = cache->frame;
+            cache->budgetUsed = 0;
+        }
+
+        if ((cache->frame > 0) && (cache->budgetUsed >= RAYGUI_GLYPH_CACHE_FRAME_BUDGET)) break;
+
+        cache->budgetUsed++;
+        if (!GuiAddGlyphs(cache, &codepoint, 1, false)) break;
+    }
+
+    return (codepoint != '?')? GuiGetCachedGlyph(cache, '?') : 0;
+}
+
+// Rasterize glyphs into lazy font atlas pages
+// NOTE: Codepoints not available in font file are added with no image (not drawn)
+static bool GuiAddGlyphs(GuiGlyphCache *cache, const int *codepoints, int count, bool pinned)
+{
+    int glyphCount = 0;
+    GlyphInfo *glyphs = LoadFontData(cache->fileData, cache->fileDataSize, cache->fontSize, (int *)codepoints, count, 0, &glyphCount);   // FONT_DEFAULT
+    if (glyphs == NULL) return false;
+
+    bool added = true;
+
+    for (int i = 0; (i < glyphCount) && added; i++)
+    {
+        Image image = glyphs[i].image;
+        if (image.data == NULL) image.width = image.height = 0;
+
+        // Get free glyph slot, least recently used page glyphs are released if required
+        int slot = -1;
+        for (int s = 0; (s < RAYGUI_GLYPH_CACHE_MAX_GLYPHS) && (slot == -1); s++) if (cache->pages[s] == -1) slot = s;
+        if ((slot == -1) && GuiEvictGlyphPage(cache)) for (int s = 0; (s < RAYGUI_GLYPH_CACHE_MAX_GLYPHS) && (slot == -1); s++) if (cache->pages[s] == -1) slot = s;
+
+        int x = 0;
+        int y = 0;
+        int width = (image.width > 0)? image.width + 2*RAYGUI_GLYPH_CACHE_PADDING : 0;
+        int height = (image.height > 0)? image.height + 2*RAYGUI_GLYPH_CACHE_PADDING : 0;
+        int page = (slot != -1)? GuiAllocGlyphRect(cache, width, height, &x, &y) : -1;
+
+        if (page == -1)
+        {
+            added = false;
+            break;
+        }
+
+        if ((width > 0) && (height > 0))
+        {
+            // Upload glyph with transparent padding, so previous page contents are cleared
+            unsigned char *pixels = (unsigned char *)RAYGUI_CALLOC(width*height*2, 1);
+
+            if (pixels != NULL)
+            {
+                for (int py = 0; py < image.height; py++)
+                {
+                    for (int px = 0; px < image.width; px++)
+                    {
+                        int index = ((py + RAYGUI_GLYPH_CACHE_PADDING)*width + px + RAYGUI_GLYPH_CACHE_PADDING)*2;
+
+                        pixels[index] = 255;
+                        pixels[index + 1] = ((unsigned char *)image.data)[py*image.width + px];
+                    }
+                }
+
+                UpdateTextureRec(cache->texture, RAYGUI_CLITERAL(Rectangle){ (float)x, (float)y, (float)width, (float)height }, pixels);
+                RAYGUI_FREE(pixels);
+            }
+        }
+
+        cache->glyphs[slot] = glyphs[i];
+        cache->glyphs[slot].image = RAYGUI_CLITERAL(Image){ 0 };
+        cache->recs[slot] = RAYGUI_CLITERAL(Rectangle){ (float)(x + RAYGUI_GLYPH_CACHE_PADDING), (float)(y + RAYGUI_GLYPH_CACHE_PADDING), (float)image.width, (float)image.height };
+        cache->pages[slot] = page;
+        cache->pageFrame[page] = cache->frame;
+        if (pinned) cache->pagePinned[page] = true;
+    }
+
+    UnloadFontData(glyphs, glyphCount);
+
+    cache->added = true;
+    GuiMapGlyphs(cache);
+
+    return added;
+}
+
+// Allocate lazy font atlas rectangle, page filled in rows
+// NOTE: When current page is full, next empty page is used or least recently used page is reused
+static int GuiAllocGlyphRect(GuiGlyphCache *cache, int width, int height, int *x, int *y)
+{
+    const int pageHeight = RAYGUI_GLYPH_CACHE_ATLAS_SIZE/RAYGUI_GLYPH_CACHE_PAGES;
+
+    if ((width > RAYGUI_GLYPH_CACHE_ATLAS_SIZE) || (height > pageHeight)) return -1;
+
+    for (int attempt = 0; attempt <= RAYGUI_GLYPH_CACHE_PAGES; attempt++)
+    {
+        int page = cache->page;
+
+        // Start a new row if glyph does not fit current one
+        if ((cache->pageRowX[page] + width) > RAYGUI_GLYPH_CACHE_ATLAS_SIZE)
+        {
+            cache->pageRowY[page] += cache->pageRowHeight[page];
+            cache->pageRowX[page] = 0;
+            cache->pageRowHeight[page] = 0;
+        }
+
+        if ((cache->pageRowY[page] + height) <= pageHeight)
+        {
+            *x = cache->pageRowX[page];
+            *y = page*pageHeight + cache->pageRowY[page];
+
+            cache->pageRowX[page] += width;
+            if (height > cache->pageRowHeight[page]) cache->pageRowHeight[page] = height;
+
+            return page;
+        }
+
+        // Current page full, move to next empty page or reuse least recently used one
+        int next = -1;
+        for (int p = 0; (p < RAYGUI_GLYPH_CACHE_PAGES) && (next == -1); p++)
+        {
+            if ((cache->pageRowX[p] == 0) && (cache->pageRowY[p] == 0)) next = p;
+        }
+
+        if (next == -1)
+        {
+            if (!GuiEvictGlyphPage(cache)) return -1;
+        }
+        else cache->page = next;
+    }
+
+    return -1;
+}
+
+// Clear least recently used lazy font atlas page for reuse, glyphs on page released
+// NOTE: Pinned pages, pages with no glyphs and pages used on current frame (glyphs could be already recorded) are never reused
+static bool GuiEvictGlyphPage(GuiGlyphCache *cache)
+{
+    int page = -1;
+    int pageGlyphs[RAYGUI_GLYPH_CACHE_PAGES] = { 0 };
+
+    for (int s = 0; s < RAYGUI_GLYPH_CACHE_MAX_GLYPHS; s++) if (cache->pages[s] != -1) pageGlyphs[cache->pages[s]]++;
+
+    for (int p = 0; p < RAYGUI_GLYPH_CACHE_PAGES; p++)
+    {
+        if (cache->pagePinned[p] || (pageGlyphs[p] == 0) || ((cache->frame > 0) && (cache->pageFrame[p] == cache->frame))) continue;
+        if ((page == -1) || ((cache->frame - cache->pageFrame[p]) > (cache->frame - cache->pageFrame[page]))) page = p;
+    }
+
+    if (page == -1) return false;
+
+    for (int s = 0; s < RAYGUI_GLYPH_CACHE_MAX_GLYPHS; s++)
+    {
+        if (cache->pages[s] == page)
+        {
+            cache->pages[s] = -1;
+            cache->glyphs[s] = RAYGUI_CLITERAL(GlyphInfo){ 0 };
+            cache->recs[s] = RAYGUI_CLITERAL(Rectangle){ 0 };
+        }
+    }
+
+    cache->pageRowX[page] = 0;
+    cache->pageRowY[page] = 0;
+    cache->pageRowHeight[page] = 0;
+    cache->page = page;
+
+    GuiMapGlyphs(cache);
+
+    return true;
+}
+
+// Rebuild lazy font codepoints map from resident glyphs
+static void GuiMapGlyphs(GuiGlyphCache *cache)
+{
+    memset(cache->map, 0, sizeof(cache->map));
+
+    for (int s = 0; s < RAYGUI_GLYPH_CACHE_MAX_GLYPHS; s++)
+    {
+        if (cache->pages[s] == -1) continue;
+
+        unsigned int probe = ((unsigned int)cache->glyphs[s].value*2654435761u) & (RAYGUI_GLYPH_CACHE_MAX_GLYPHS*2 - 1);
+        while (cache->map[probe] != 0) probe = (probe + 1) & (RAYGUI_GLYPH_CACHE_MAX_GLYPHS*2 - 1);
+
+        cache->map[probe] = s + 1;
+    }
+}
+
+// Unload lazy font glyphs cache (atlas, glyphs and font data)
+static void GuiUnloadGlyphCache(GuiGlyphCache *cache)
+{
+    if (cache->texture.id > 0) UnloadTexture(cache->texture);
+    RAYGUI_FREE(cache->glyphs);
+    RAYGUI_FREE(cache->recs);
+    UnloadFileData(cache->fileData);
+    RAYGUI_FREE(cache);
+}
+#endif
+
+// Get text bounds considering control bounds
+static Rectangle GetTextBounds(int control, Rectangle bounds)
+{
+    Rectangle textBounds = bounds;
+
+    textBounds.x = bounds.x + GuiGetStyle(control, BORDER_WIDTH);
+    textBounds.y = bounds.y + GuiGetStyle(control, BORDER_WIDTH) + GuiGetStyle(control, TEXT_PADDING);
+    textBounds.width = bounds.width - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);
+    textBounds.height = bounds.height - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);    // NOTE: Text is processed line per line!
+
+    // Depending on control, TEXT_PADDING and TEXT_ALIGNMENT properties could affect the text-bounds
+    switch (control)
+    {
+        case COMBOBOX:
+        case DROPDOWNBOX:
+        case LISTVIEW:
+            // TODO: Special cases (no label): COMBOBOX, DROPDOWNBOX, LISTVIEW
+        case SLIDER:
+        case CHECKBOX:
+        case VALUEBOX:
+        case TABBAR:
+            // TODO: Special cases (label on side): SLIDER, CHECKBOX, VALUEBOX, SPINNER
+        default:
+        {
+            // WARNING: TEXT_ALIGNMENT is already considered in GuiDrawText()
+            if (GuiGetStyle(control, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT) textBounds.x -= GuiGetStyle(control, TEXT_PADDING);
+            else textBounds.x += GuiGetStyle(control, TEXT_PADDING);
+        }
+        break;
+    }
+
+    return textBounds;
+}
+
+// Get text icon if provided and move text cursor
+// NOTE: Up to RAYGUI_ICON_MAX_ICONS supported for iconId
+static const char *GetTextIcon(const char *text, int *iconId)
+{
+#if !defined(RAYGUI_NO_ICONS)
+    *iconId = -1;
+    if (text[0] == '#') // Maybe an icon, if it starts with # but an ending # must be found
+    {
+        char iconValue[4] = { 0 }; // Maximum length for icon value: 3 digits + '\0'
+
+        int pos = 1;
+        while ((pos < 4) && (text[pos] >= '0') && (text[pos] <= '9'))
+        {
+            iconValue[pos - 1] = text[pos];
+            pos++;
+        }
+
+        if (text[pos] == '#')
+        {
+            int rawIconId = TextToInteger(iconValue);
+            if (rawIconId < RAYGUI_ICON_MAX_ICONS)
+            {
+                *iconId = rawIconId;
+
+                // Move text pointer after icon
+                // WARNING: If only icon provided, it could point to EOL character: '\0'
+                if (*iconId >= 0) text += (pos + 1);
+            }
+        }
+    }
+#endif
+
+    return text;
+}
+
+// Get text divided into lines (by line-breaks '\n')
+// WARNING: It returns pointers to new lines but it does not add NULL ('\0') terminator!
+static const char **GetTextLines(const char *text, int *count)
+{
+    const char **lines = guiContext->textLines;
+    for (int i = 0; i < RAYGUI_MAX_TEXT_LINES; i++) lines[i] = NULL;    // Init NULL pointers to substrings
+
+    int textLength = (int)strlen(text);
+
+    lines[0] = text;
+    *count = 1;
+
+    // Find line breaks with memchr(), not a new line if text ends with line break
+    const char *lineBreak = (const char *)memchr(text, '\n', textLength);
+
+    while ((lineBreak != NULL) && ((lineBreak + 1) < (text + textLength)) && (*count < RAYGUI_MAX_TEXT_LINES))
+    {
+        lines[*count] = lineBreak + 1;
+        *count += 1;
+        lineBreak = (const char *)memchr(lineBreak + 1, '\n', textLength - (int)(lineBreak + 1 - text));
+    }
+
+    RAYGUI_STATS_ADD(bufferBytes, RAYGUI_MAX_TEXT_LINES*(int)sizeof(char *));
+
+    return lines;
+}
+
+// Get text width to next space for provided string
+static float GetNextSpaceWidth(const char *text, int *nextSpaceIndex)
+{
+    float width = 0;
+    int codepointByteCount = 0;
+    int codepoint = 0;
+    int index = 0;
+    float glyphWidth = 0;
+    float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
+    const int *asciiGlyphs = GetAsciiGlyphs();
+
+    RAYGUI_STATS_ADD(textMeasures, 1);
+
+    for (int i = 0; text[i] != '\0'; i++)
+    {
+        if (text[i] != ' ')
+        {
+            if (((unsigned char)text[i] & 0x80) == 0) index = asciiGlyphs[(int)text[i]];
+            else
+            {
+                codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+                index = GuiGetGlyphIndex(codepoint);
+            }
+            glyphWidth = (guiFont.glyphs[index].advanceX == 0)? guiFont.recs[index].width*scaleFactor : guiFont.glyphs[index].advanceX*scaleFactor;
+            width += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+        }
+        else
+        {
+            *nextSpaceIndex = i;
+            break;
+        }
+    }
+
+    return width;
+}
+
+// Gui draw text using default font
+static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint)
+{
+    #define TEXT_VALIGN_PIXEL_OFFSET(h)  ((int)h%2)     // Vertical alignment for pixel perfect
+
+    #if !defined(RAYGUI_ICON_TEXT_PADDING)
+        #define RAYGUI_ICON_TEXT_PADDING   4
+    #endif
+
+    if ((text == NULL) || (text[0] == '\0')) return;    // Security check
+
+    RAYGUI_PROFILE_BEGIN("GuiDrawText");
+
+    // PROCEDURE:
+    //   - Text is processed line per line
+    //   - For every line, horizontal alignment is defined
+    //   - For all text, vertical alignment is defined (multiline text only)
+    //   - For every line, wordwrap mode is checked (useful for GuitextBox(), read-only)
+
+    // Get text lines (using '\n' as delimiter) to be processed individually
+    // WARNING: GuiTextSplit() function can't be used now because it can have already been used
+    // before the GuiDrawText() call and its buffer is static, it would be overriden :(
+    int lineCount = 0;
+    const char **lines = GetTextLines(text, &lineCount);
+
+    // Text style variables
+    //int alignment = GuiGetStyle(DEFAULT, TEXT_ALIGNMENT);
+    int alignmentVertical = GuiGetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL);
+    int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);    // Wrap-mode only available in read-only mode, no for text editing
+
+    // TODO: WARNING: This totalHeight is not valid for vertical alignment in case of word-wrap
+    float totalHeight = (float)(lineCount*GuiGetStyle(DEFAULT, TEXT_SIZE) + (lineCount - 1)*GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
+    float posOffsetY = 0.0f;
+
+    // Check text culling before text measuring, considering vertical overflow of aligned lines
+    if (guiClipCount > 0)
+    {
+        Rectangle textArea = textBounds;
+
+        if (totalHeight > textBounds.height)
+        {
+            if (alignmentVertical == TEXT_ALIGN_MIDDLE) textArea.y -= (totalHeight - textBounds.height)/2;
+            else if (alignmentVertical == TEXT_ALIGN_BOTTOM) textArea.y -= (totalHeight - textBounds.height);
+            textArea.height = totalHeight;
+        }
+
+        if (GuiIsCulled(textArea)) lineCount = 0;
+    }
+
+    for (int i = 0; i < lineCount; i++)
+    {
+        int iconId = 0;
+        lines[i] = GetTextIcon(lines[i], &iconId);      // Check text for icon and move cursor
+
+        // Get text position depending on alignment and iconId
+        //---------------------------------------------------------------------------------
+        Vector2 textBoundsPosition = { textBounds.x, textBounds.y };
+        float textBoundsWidthOffset = 0.0f;
+
+        // Get shaped line retained from previous frames, only lines with no wrapping are retained
+        // NOTE: A valid text run replays its glyphs, line is not decoded or measured again
+        bool runValid = false;
+        GuiTextRun *run = NULL;
+        if (wrapMode == TEXT_WRAP_NONE) run = GuiGetTextRun(lines[i], (iconId >= 0), textBounds.width, &runValid);
+
+        // NOTE: Icon was already stripped above by GetTextIcon(); GetLineWidth()
+        // takes no icon path here and returns only the glyph width of this line.
+        int textSizeX = runValid? run->lineWidth : GetLineWidth(lines[i]);
+        if ((run != NULL) && !runValid) run->lineWidth = textSizeX;
+
+        // If text requires an icon, add size to measure
+        if (iconId >= 0)
+        {
+            textSizeX += RAYGUI_ICON_SIZE*guiIconScale;
+
+            // WARNING: If only icon provided, text could be pointing to EOF character: '\0'
+#if !defined(RAYGUI_NO_ICONS)
+            if ((lines[i] != NULL) && (lines[i][0] != '\0')) textSizeX += RAYGUI_ICON_TEXT_PADDING;
+#endif
+        }
+
+        // Check guiTextAlign global variables
+        switch (alignment)
+        {
+            case TEXT_ALIGN_LEFT: textBoundsPosition.x = textBounds.x; break;
+            case TEXT_ALIGN_CENTER: textBoundsPosition.x = textBounds.x +  textBounds.width/2 - textSizeX/2; break;
+            case TEXT_ALIGN_RIGHT: textBoundsPosition.x = textBounds.x + textBounds.width - textSizeX; break;
+            default: break;
+        }
+
+        if (textSizeX > textBounds.width && (lines[i] != NULL) && (lines[i][0] != '\0')) textBoundsPosition.x = textBounds.x;
+
+        switch (alignmentVertical)
+        {
+            // Only valid in case of wordWrap = 0;
+            case TEXT_ALIGN_TOP: textBoundsPosition.y = textBounds.y + posOffsetY; break;
+            case TEXT_ALIGN_MIDDLE: textBoundsPosition.y = textBounds.y + posOffsetY + textBounds.height/2 - totalHeight/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height); break;
+            case TEXT_ALIGN_BOTTOM: textBoundsPosition.y = textBounds.y + posOffsetY + textBounds.height - totalHeight + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height); break;
+            default: break;
+        }
+
+        // NOTE: Make sure getting pixel-perfect coordinates,
+        // In case of decimals, it could result in text positioning artifacts
+        textBoundsPosition.x = (float)((int)textBoundsPosition.x);
+        textBoundsPosition.y = (float)((int)textBoundsPosition.y);
+        //---------------------------------------------------------------------------------
+
+        // Draw text (with icon if available)
+        //---------------------------------------------------------------------------------
+#if !defined(RAYGUI_NO_ICONS)
+        if (iconId >= 0)
+        {
+            // NOTE: Considering icon height, probably different than text size
+            GuiDrawIcon(iconId, (int)textBoundsPosition.x, (int)(textBounds.y + textBounds.height/2 - RAYGUI_ICON_SIZE*guiIconScale/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height)), guiIconScale, tint);
+            textBoundsPosition.x += (float)(RAYGUI_ICON_SIZE*guiIconScale + RAYGUI_ICON_TEXT_PADDING);
+            textBoundsWidthOffset = (float)(RAYGUI_ICON_SIZE*guiIconScale + RAYGUI_ICON_TEXT_PADDING);
+        }
+#endif
+        if (runValid)
+        {
+            // Draw retained glyphs, ellipsis dots included
+            for (int g = 0; g < run->glyphCount; g++)
+            {
+                GuiCmdDrawCodepoint(GuiGetGlyphFont(run->codepoints[g]), run->codepoints[g], RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + run->offsets[g], textBoundsPosition.y }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+            }
+            RAYGUI_STATS_ADD(glyphs, run->glyphCount);
+
+            posOffsetY += (float)(GuiGetStyle(DEFAULT, TEXT_SIZE) + GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
+            continue;
+        }
+
+        // Get size in bytes of text, considering end of line and line break
+        int lineSize = (int)strcspn(lines[i], "\n\r");
+        float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
+        const int *asciiGlyphs = GetAsciiGlyphs();
+
+        int lastSpaceIndex = 0;
+        bool tempWrapCharMode = false;
+
+        int textOffsetY = 0;
+        float textOffsetX = 0.0f;
+        float glyphWidth = 0;
+
+        int ellipsisWidth = GuiGetTextWidth("...");
+        bool textOverflow = false;
+        for (int c = 0, codepointSize = 0; c < lineSize; c += codepointSize)
+        {
+            int codepoint = 0;
+            int index = 0;
+
+            if (((unsigned char)lines[i][c] & 0x80) == 0)
+            {
+                // ASCII codepoint, glyph index from table
+                codepoint = lines[i][c];
+                codepointSize = 1;
+                index = asciiGlyphs[codepoint];
+            }
+            else
+            {
+                codepoint = GetCodepointNext(&lines[i][c], &codepointSize);
+                index = GuiGetGlyphIndex(codepoint);
+            }
+
+            // NOTE: Normally, exiting the decoding sequence as soon as a bad byte is found (and return 0x3f)
+            // but all of the bad bytes need to be drawn using the '?' symbol, moving one byte
+            if (codepoint == 0x3f) codepointSize = 1; // WARNING: Not recognized codepoints size
+
+            // Get glyph width to check if it goes out of bounds
+            if (guiFont.glyphs[index].advanceX == 0) glyphWidth = ((float)guiFont.recs[index].width*scaleFactor);
+            else glyphWidth = (float)guiFont.glyphs[index].advanceX*scaleFactor;
+
+            // Wrap mode text measuring, to validate if
+            // it can be drawn or a new line is required
+            if (wrapMode == TEXT_WRAP_CHAR)
+            {
+                // Jump to next line if current character reach end of the box limits
+                if ((textOffsetX + glyphWidth) > textBounds.width - textBoundsWidthOffset)
+                {
+                    textOffsetX = 0.0f;
+                    textOffsetY += (GuiGetStyle(DEFAULT, TEXT_SIZE) + GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
+
+                    if (tempWrapCharMode) // Wrap at char level when too long words
+                    {
+                        wrapMode = TEXT_WRAP_WORD;
+                        tempWrapCharMode = false;
+                    }
+                }
+            }
+            else if (wrapMode == TEXT_WRAP_WORD)
+            {
+                if (codepoint == 32) lastSpaceIndex = c;
+
+                // Get width to next space in line
+                int nextSpaceIndex = 0;
+                float nextSpaceWidth = GetNextSpaceWidth(lines[i] + c, &nextSpaceIndex);
+
+                int nextSpaceIndex2 = 0;
+                float nextWordSize = GetNextSpaceWidth(lines[i] + lastSpaceIndex + 1, &nextSpaceIndex2);
+
+                if (nextWordSize > textBounds.width - textBoundsWidthOffset)
+                {
+                    // Considering the case the next word is longer than bounds
+                    tempWrapCharMode = true;
+                    wrapMode = TEXT_WRAP_CHAR;
+                }
+                else if ((textOffsetX + nextSpaceWidth) > textBounds.width - textBoundsWidthOffset)
+                {
+                    textOffsetX = 0.0f;
+                    textOffsetY += (GuiGetStyle(DEFAULT, TEXT_SIZE) + GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
+                }
+            }
+
+            if (codepoint == '\n') break; // WARNING: Lines are already processed manually, no need to keep drawing after this codepoint
+            else
+            {
+                // WARNING: There are multiple types of spaces in Unicode,
+                // maybe it's a good idea to add support for more: http://jkorpela.fi/chars/spaces.html
+                if ((codepoint != ' ') && (codepoint != '\t')) // Do not draw codepoints with no glyph
+                {
+                    if (wrapMode == TEXT_WRAP_NONE)
+                    {
+                        // Draw only required text glyphs fitting the textBounds.width
+                        if (textSizeX > textBounds.width)
+                        {
+                            if (textOffsetX <= (textBounds.width - glyphWidth - textBoundsWidthOffset - ellipsisWidth))
+                            {
+                                GuiCmdDrawCodepoint(GuiGetGlyphFont(codepoint), codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                                RAYGUI_STATS_ADD(glyphs, 1);
+                                GuiAddTextRunGlyph(run, codepoint, textOffsetX);
+                            }
+                            else if (!textOverflow)
+                            {
+                                textOverflow = true;
+                                if (run != NULL) run->cutIndex = run->glyphCount;
+
+                                for (int j = 0; j < ellipsisWidth; j += ellipsisWidth/3)
+                                {
+                                    GuiCmdDrawCodepoint(GuiGetGlyphFont('.'), '.', RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX + j, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                                    RAYGUI_STATS_ADD(glyphs, 1);
+                                    GuiAddTextRunGlyph(run, '.', textOffsetX + j);
+                                }
+                            }
+                        }
+                        else
+                        {
+                            GuiCmdDrawCodepoint(GuiGetGlyphFont(codepoint), codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                            RAYGUI_STATS_ADD(glyphs, 1);
+                            GuiAddTextRunGlyph(run, codepoint, textOffsetX);
+                        }
+                    }
+                    else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
+                    {
+                        // Draw only glyphs inside the bounds
+                        if ((textBoundsPosition.y + textOffsetY) <= (textBounds.y + textBounds.height - GuiGetStyle(DEFAULT, TEXT_SIZE)))
+                        {
+                            GuiCmdDrawCodepoint(GuiGetGlyphFont(codepoint), codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                            RAYGUI_STATS_ADD(glyphs, 1);
+                        }
+                    }
+                }
+
+                if (guiFont.glyphs[index].advanceX == 0) textOffsetX += ((float)guiFont.recs[index].width*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                else textOffsetX += ((float)guiFont.glyphs[index].advanceX*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+            }
+        }
+
+        if (run != NULL)
+        {
+            // Line retained, or released if too many glyphs to retain
+            if (!textOverflow) run->cutIndex = run->glyphCount;
+            if (run->glyphCount > RAYGUI_TEXT_RUN_MAX_GLYPHS) run->hash = 0;
+        }
+
+        if (wrapMode == TEXT_WRAP_NONE) posOffsetY += (float)(GuiGetStyle(DEFAULT, TEXT_SIZE) + GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
+        else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
+            posOffsetY += (textOffsetY + GuiGetStyle(DEFAULT, TEXT_SIZE));
+        //---------------------------------------------------------------------------------
+    }
+
+#if defined(RAYGUI_DEBUG_TEXT_BOUNDS)
+    GuiDrawRectangle(textBounds, 0, WHITE, Fade(BLUE, 0.4f));
+#endif
+
+    RAYGUI_PROFILE_END("GuiDrawText");
+}
+
+// Gui draw rectangle using default raygui plain style with borders
+static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color)
+{
+    if (GuiIsCulled(rec)) return;
+
+    if (color.a > 0)
+    {
+        // Draw rectangle filled with color
+        GuiCmdDrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, GuiFade(color, guiAlpha));
+        RAYGUI_STATS_ADD(rectangles, 1);
+    }
+
+    if (borderWidth > 0)
+    {
+        // Draw rectangle border lines with color
+        RAYGUI_STATS_ADD(rectangles, 4);
+        GuiCmdDrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
+        GuiCmdDrawRectangle((int)rec.x, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
+        GuiCmdDrawRectangle((int)rec.x + (int)rec.width - borderWidth, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
+        GuiCmdDrawRectangle((int)rec.x, (int)rec.y + (int)rec.height - borderWidth, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
+    }
+
+#if defined(RAYGUI_DEBUG_RECS_BOUNDS)
+    GuiCmdDrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, Fade(RED, 0.4f));
+#endif
+}
+
+// Gui draw checkerboard pattern, color1 on even cells and color2 on odd cells, only complete cells drawn
+// NOTE: Drawn as two quads tiling the cached pattern texture, independently of bounds size,
+// falls back to one rectangle per cell if pattern texture is not available
+static void GuiDrawCheckerboard(Rectangle bounds, int cellSize, Color color1, Color color2)
+{
+    int cellsX = (int)bounds.width/cellSize;
+    int cellsY = (int)bounds.height/cellSize;
+    Rectangle area = { bounds.x, bounds.y, (float)(cellsX*cellSize), (float)(cellsY*cellSize) };
+
+    if ((cellsX <= 0) || (cellsY <= 0) || GuiIsCulled(area)) return;
+
+#if !defined(RAYGUI_NO_PATTERN_TEXTURE)
+    // Load pattern texture on first use
+    // NOTE: Not loaded while recording a command list, it could be recorded out of the rendering thread
+    if ((guiPatternTexture.id == 0) && !guiPatternFailed
+#if defined(RAYGUI_COMMAND_LISTS)
+        && (guiCommandList == NULL)
+#endif
+        )
+    {
+        static unsigned char patternPixels[2*2*4] = { 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0 };
+
+        Image pattern = { 0 };
+        pattern.data = patternPixels;
+        pattern.width = 2;
+        pattern.height = 2;
+        pattern.mipmaps = 1;
+        pattern.format = 7;         // PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+
+        guiPatternTexture = LoadTextureFromImage(pattern);
+        if (guiPatternTexture.id == 0) guiPatternFailed = true;
+    }
+#endif
+
+    if (guiPatternTexture.id > 0)
+    {
+        // Pattern texel (x%2, y%2) is white for odd cells, source offset by one texel for even cells
+        GuiCmdDrawTexture(guiPatternTexture, RAYGUI_CLITERAL(Rectangle){ 1, 0, (float)cellsX, (float)cellsY }, area, GuiFade(color1, guiAlpha));
+        GuiCmdDrawTexture(guiPatternTexture, RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)cellsX, (float)cellsY }, area, GuiFade(color2, guiAlpha));
+        RAYGUI_STATS_ADD(rectangles, 2);
+    }
+    else
+    {
+        for (int x = 0; x < cellsX; x++)
+        {
+            for (int y = 0; y < cellsY; y++)
+            {
+                Rectangle cell = { bounds.x + x*cellSize, bounds.y + y*cellSize, (float)cellSize, (float)cellSize };
+                GuiDrawRectangle(cell, 0, BLANK, ((x + y)%2)? color2 : color1);
+            }
+        }
+    }
+}
+
+// Draw rectangle, recorded if command list active
+static void GuiCmdDrawRectangle(int x, int y, int width, int height, Color color)
+{
+    if (guiFontShaderActive) GuiSetFontShaderActive(false);
+
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiCommand *command = GuiAddCommand(COMMAND_RECTANGLE);
+        if (command != NULL)
+        {
+            command->bounds = RAYGUI_CLITERAL(Rectangle){ (float)x, (float)y, (float)width, (float)height };
+            command->colors[0] = color;
+        }
+        return;
+    }
+#endif
+    DrawRectangle(x, y, width, height, color);
+}
+
+// Draw rectangles stream, recorded if command list active
+// NOTE: Font shader and command list are checked once for the full stream, list grows once
+static void GuiCmdDrawRectangles(const Rectangle *recs, const Color *colors, int count)
+{
+    if (guiFontShaderActive) GuiSetFontShaderActive(false);
+
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiCommand *commands = GuiAddCommands(COMMAND_RECTANGLE, count);
+        if (commands != NULL)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                commands[i].bounds = recs[i];
+                commands[i].colors[0] = colors[i];
+            }
+        }
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++) DrawRectangle((int)recs[i].x, (int)recs[i].y, (int)recs[i].width, (int)recs[i].height, colors[i]);
+}
+
+// Draw gradient rectangle, recorded if command list active
+static void GuiCmdDrawRectangleGradient(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
+{
+    if (guiFontShaderActive) GuiSetFontShaderActive(false);
+
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiCommand *command = GuiAddCommand(COMMAND_RECTANGLE_GRADIENT);
+        if (command != NULL)
+        {
+            command->bounds = rec;
+            command->colors[0] = col1;
+            command->colors[1] = col2;
+            command->colors[2] = col3;
+            command->colors[3] = col4;
+        }
+        return;
+    }
+#endif
+    DrawRectangleGradientEx(rec, col1, col2, col3, col4);
+}
+
+// Draw texture rectangle, recorded if command list active
+static void GuiCmdDrawTexture(Texture2D texture, Rectangle source, Rectangle dest, Color tint)
+{
+    if (guiFontShaderActive) GuiSetFontShaderActive(false);
+
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiCommand *command = GuiAddCommand(COMMAND_TEXTURE);
+        if (command != NULL)
+        {
+            command->texture = texture;
+            command->source = source;
+            command->bounds = dest;
+            command->colors[0] = tint;
+        }
+        return;
+    }
+#endif
+    DrawTexturePro(texture, source, dest, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, tint);
+}
+
+// Draw codepoint, recorded if command list active
+// NOTE: SDF font glyphs are drawn with font shader, kept active for consecutive glyphs and texts
+static void GuiCmdDrawCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
+{
+    if (guiFontShaderActive != (guiFontType == FONT_TYPE_SDF)) GuiSetFontShaderActive(guiFontType == FONT_TYPE_SDF);
+
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiCommand *command = GuiAddCommand(COMMAND_CODEPOINT);
+        if (command != NULL)
+        {
+            command->font = font;
+            command->codepoint = codepoint;
+            command->bounds = RAYGUI_CLITERAL(Rectangle){ position.x, position.y, 0, 0 };
+            command->fontSize = fontSize;
+            command->colors[0] = tint;
+        }
+        return;
+    }
+#endif
+    DrawTextCodepoint(font, codepoint, position, fontSize, tint);
+}
+
+// Begin scissor area, recorded if command list active
+static void GuiCmdBeginScissor(int x, int y, int width, int height)
+{
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiCommand *command = GuiAddCommand(COMMAND_SCISSOR_BEGIN);
+        if (command != NULL) command->bounds = RAYGUI_CLITERAL(Rectangle){ (float)x, (float)y, (float)width, (float)height };
+        return;
+    }
+#endif
+    BeginScissorMode(x, y, width, height);
+}
+
+// End scissor area, recorded if command list active
+static void GuiCmdEndScissor(void)
+{
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiAddCommand(COMMAND_SCISSOR_END);
+        return;
+    }
+#endif
+    EndScissorMode();
+}
+
+// Set SDF font shader state for next drawing, begun or ended only on changes
+// NOTE: Shader is not ended after every text, but before next non-text drawing, command list end or frame end
+static void GuiSetFontShaderActive(bool active)
+{
+    if (active == guiFontShaderActive) return;
+
+    if (active) GuiCmdBeginFontShader();
+    else GuiCmdEndFontShader();
+
+    guiFontShaderActive = active;
+}
+
+// Begin SDF font shader, recorded if command list active
+static void GuiCmdBeginFontShader(void)
+{
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiAddCommand(COMMAND_FONT_SHADER_BEGIN);
+        return;
+    }
+#endif
+    GuiBeginFontShader();
+}
+
+// End SDF font shader, recorded if command list active
+static void GuiCmdEndFontShader(void)
+{
+#if defined(RAYGUI_COMMAND_LISTS)
+    if (guiCommandList != NULL)
+    {
+        GuiAddCommand(COMMAND_FONT_SHADER_END);
+        return;
+    }
+#endif
+    GuiEndFontShader();
+}
+
+// Begin SDF font shader, using callbacks or default shader
+// NOTE: Default shader is loaded on first use, on drawing thread (command lists are replayed there)
+static void GuiBeginFontShader(void)
+{
+    if ((guiFontShaderBegin != NULL) || (guiFontShaderEnd != NULL))
+    {
+        if (guiFontShaderBegin != NULL) guiFontShaderBegin();
+    }
+#if !defined(RAYGUI_STANDALONE) && !defined(RAYGUI_NO_FONT_SHADER)
+    else
+    {
+        if (guiFontShader.id == 0) guiFontShader = LoadShaderFromMemory(NULL, RAYGUI_FONT_SHADER_FS);
+        BeginShaderMode(guiFontShader);
+    }
+#endif
+}
+
+// End SDF font shader, using callbacks or default shader
+static void GuiEndFontShader(void)
+{
+    if ((guiFontShaderBegin != NULL) || (guiFontShaderEnd != NULL))
+    {
+        if (guiFontShaderEnd != NULL) guiFontShaderEnd();
+    }
+#if !defined(RAYGUI_STANDALONE) && !defined(RAYGUI_NO_FONT_SHADER)
+    else EndShaderMode();
+#endif
+}
+
+#if defined(RAYGUI_COMMAND_LISTS)
+// Add command to recording command list, growing it if required
+// NOTE: Returned command is zero-initialized, NULL if list could not grow
+static GuiCommand *GuiAddCommand(int type)
+{
+    return GuiAddCommands(type, 1);
+}
+
+// Add consecutive commands to recording command list, growing it once if required
+// NOTE: Returned commands are zero-initialized, NULL if list could not grow
+static GuiCommand *GuiAddCommands(int type, int count)
+{
+    GuiCommandList *list = guiCommandList;
+
+    if (count <= 0) return NULL;
+
+    if ((list->count + count) > list->capacity)
+    {
+        int capacity = (list->capacity > 0)? list->capacity*2 : 256;
+        while (capacity < (list->count + count)) capacity *= 2;
+
+        GuiCommand *commands = (GuiCommand *)RAYGUI_MALLOC(capacity*sizeof(GuiCommand));
+
+        if (commands == NULL)
+        {
+            RAYGUI_LOG("WARNING: Failed to grow command list, commands ignored\n");
+            return NULL;
+        }
+
+        if (list->count > 0) memcpy(commands, list->commands, list->count*sizeof(GuiCommand));
+        RAYGUI_FREE(list->commands);
+
+        list->commands = commands;
+        list->capacity = capacity;
+    }
+
+    GuiCommand *command = &list->commands[list->count];
+    list->count += count;
+
+    memset(command, 0, count*sizeof(GuiCommand));
+    for (int i = 0; i < count; i++) command[i].type = type;
+
+    return command;
+}
+#endif
+
+// Draw tooltip using control bounds
+static void GuiTooltip(Rectangle controlRec)
+{
+    if (!guiLocked && guiTooltip && (guiTooltipPtr != NULL) && !guiControlExclusiveMode)
+    {
+        Vector2 textSize = MeasureTextEx(guiFont, guiTooltipPtr, (float)GuiGetStyle(DEFAULT, TEXT_SIZE),
+            (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+        RAYGUI_STATS_ADD(textMeasures, 1);
+
+        if ((controlRec.x + textSize.x + 16) > GetScreenWidth()) controlRec.x -= (textSize.x + 16 - controlRec.width);
+
+        int lineCount = 0;
+        GetTextLines(guiTooltipPtr, &lineCount); // Only using the line count
+        if ((controlRec.y + controlRec.height + textSize.y + 4 + 8*lineCount) > GetScreenHeight())
+            controlRec.y -= (controlRec.height + textSize.y + 4 + 8*lineCount);
+
+        // TODO: Probably TEXT_LINE_SPACING should be considered on panel size instead of hardcoding 8.0f
+        GuiPanel(RAYGUI_CLITERAL(Rectangle){ controlRec.x, controlRec.y + controlRec.height + 4, textSize.x + 16, textSize.y + 8.0f*lineCount }, NULL);
+
+        int textPadding = GuiGetStyle(LABEL, TEXT_PADDING);
+        int textAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
+        GuiSetStyleTemp(LABEL, TEXT_PADDING, 0);
+        GuiSetStyleTemp(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+        GuiLabel(RAYGUI_CLITERAL(Rectangle){ controlRec.x, controlRec.y + controlRec.height + 4, textSize.x + 16, textSize.y + 8.0f*lineCount }, guiTooltipPtr);
+        GuiSetStyleTemp(LABEL, TEXT_ALIGNMENT, textAlignment);
+        GuiSetStyleTemp(LABEL, TEXT_PADDING, textPadding);
+    }
+}
+
+// Scroll bar control (used by GuiScrollPanel())
+static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
+{
+    GuiID id = GuiGetControlID(bounds);
+    GuiState state = guiState;
+
+    // Is the scrollbar horizontal or vertical?
+    bool isVertical = (bounds.width > bounds.height)? false : true;
+
+    // The size (width or height depending on scrollbar type) of the spinner buttons
+    const int spinnerSize = GuiGetStyle(SCROLLBAR, ARROWS_VISIBLE)?
+        (isVertical? (int)bounds.width - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH) :
+            (int)bounds.height - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH)) : 0;
+
+    // Arrow buttons [<] [>] [∧] [∨]
+    Rectangle arrowUpLeft = { 0 };
+    Rectangle arrowDownRight = { 0 };
+
+    // Actual area of the scrollbar excluding the arrow buttons
+    Rectangle scrollbar = { 0 };
+
+    // Slider bar that moves     --[///]-----
+    Rectangle slider = { 0 };
+
+    // Normalize value
+    if (value > maxValue) value = maxValue;
+    if (value < minValue) value = minValue;
+
+    int valueRange = maxValue - minValue;
+    if (valueRange <= 0) valueRange = 1;
+
+    int sliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+    if (sliderSize < 1) sliderSize = 1;  // Consider a minimum slider size of 1 pixel
+
+    // Calculate rectangles for all of the components
+    arrowUpLeft = RAYGUI_CLITERAL(Rectangle){
+        (float)bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH),
+            (float)bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH),
+            (float)spinnerSize, (float)spinnerSize };
+
+    if (isVertical)
+    {
+        arrowDownRight = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)bounds.y + bounds.height - spinnerSize - GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)spinnerSize, (float)spinnerSize };
+        scrollbar = RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING), arrowUpLeft.y + arrowUpLeft.height, bounds.width - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING)), bounds.height - arrowUpLeft.height - arrowDownRight.height - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH) };
+
+        // Make sure the slider won't get outside of the scrollbar
+        sliderSize = (sliderSize >= scrollbar.height)? ((int)scrollbar.height - 2) : sliderSize;
+        slider = RAYGUI_CLITERAL(Rectangle){
+            bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING),
+                scrollbar.y + (int)(((float)(value - minValue)/valueRange)*(scrollbar.height - sliderSize)),
+                bounds.width - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING)),
+                (float)sliderSize };
+    }
+    else    // horizontal
+    {
+        arrowDownRight = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + bounds.width - spinnerSize - GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)spinnerSize, (float)spinnerSize };
+        scrollbar = RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x + arrowUpLeft.width, bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING), bounds.width - arrowUpLeft.width - arrowDownRight.width - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH), bounds.height - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING)) };
+
+        // Make sure the slider won't get outside of the scrollbar
+        sliderSize = (sliderSize >= scrollbar.width)? ((int)scrollbar.width - 2) : sliderSize;
+        slider = RAYGUI_CLITERAL(Rectangle){
+            scrollbar.x + (int)(((float)(value - minValue)/valueRange)*(scrollbar.width - sliderSize)),
+                bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING),
+                (float)sliderSize,
+                bounds.height - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING)) };
+    }
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GUI_POINTER_POSITION;
+
+        if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
+        {
+            if (GUI_BUTTON_DOWN &&
+                !CheckCollisionPointRec(mousePoint, arrowUpLeft) &&
+                !CheckCollisionPointRec(mousePoint, arrowDownRight))
+            {
+                if (id == guiControlExclusiveId)
+                {
+                    state = STATE_PRESSED;
+
+                    if (isVertical) value = (int)(((float)(mousePoint.y - scrollbar.y - slider.height/2)*valueRange)/(scrollbar.height - slider.height) + minValue);
+                    else value = (int)(((float)(mousePoint.x - scrollbar.x - slider.width/2)*valueRange)/(scrollbar.width - slider.width) + minValue);
+                }
+            }
+            else
+            {
+                guiControlExclusiveMode = false;
+                guiControlExclusiveId = 0;
+            }
+        }
+        else if (CheckCollisionPointRec(mousePoint, bounds))
+        {
+            state = STATE_FOCUSED;
+
+            // Handle mouse wheel
+            float scrollDelta = GUI_SCROLL_DELTA;
+            if (scrollDelta != 0) value += (int)scrollDelta;
+
+            // Handle mouse button down
+            if (GUI_BUTTON_PRESSED)
+            {
+                guiControlExclusiveMode = true;
+                guiControlExclusiveId = id; // Store control id when dragging starts
+
+                // Check arrows click
+                if (CheckCollisionPointRec(mousePoint, arrowUpLeft)) value -= valueRange/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                else if (CheckCollisionPointRec(mousePoint, arrowDownRight)) value += valueRange/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                else if (!CheckCollisionPointRec(mousePoint, slider))
+                {
+                    // If click on scrollbar position but not on slider, place slider directly on that position
+                    if (isVertical) value = (int)(((float)(mousePoint.y - scrollbar.y - slider.height/2)*valueRange)/(scrollbar.height - slider.height) + minValue);
+                    else value = (int)(((float)(mousePoint.x - scrollbar.x - slider.width/2)*valueRange)/(scrollbar.width - slider.width) + minValue);
+                }
+
+                state = STATE_PRESSED;
+            }
+
+            // Keyboard control on mouse hover scrollbar
+            /*
+            if (isVertical)
+            {
+            if (GUI_KEY_DOWN(KEY_DOWN)) value += 5;
+            else if (GUI_KEY_DOWN(KEY_UP)) value -= 5;
+            }
+            else
+            {
+            if (GUI_KEY_DOWN(KEY_RIGHT)) value += 5;
+            else if (GUI_KEY_DOWN(KEY_LEFT)) value -= 5;
+            }
+            */
+        }
+
+        // Normalize value
+        if (value > maxValue) value = maxValue;
+        if (value < minValue) value = minValue;
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangle(bounds, GuiGetStyle(SCROLLBAR, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED)));   // Draw the background
+
+    GuiDrawRectangle(scrollbar, 0, BLANK, GetColor(GuiGetStyle(BUTTON, BASE_COLOR_NORMAL)));     // Draw the scrollbar active area background
+    GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BORDER + state*3)));         // Draw the slider bar
+
+    // Draw arrows (using icon if available)
+    if (GuiGetStyle(SCROLLBAR, ARROWS_VISIBLE))
+    {
+#if defined(RAYGUI_NO_ICONS)
+        GuiDrawText(isVertical? "^" : "<",
+            RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x, arrowUpLeft.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
+            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
+        GuiDrawText(isVertical? "v" : ">",
+            RAYGUI_CLITERAL(Rectangle){ arrowDownRight.x, arrowDownRight.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
+            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
+#else
+        GuiDrawText(isVertical? GuiIconText(ICON_ARROW_UP_FILL, NULL) : GuiIconText(ICON_ARROW_LEFT_FILL, NULL),
+            RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x, arrowUpLeft.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
+            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(SCROLLBAR, TEXT + state*3)));   // ICON_ARROW_UP_FILL / ICON_ARROW_LEFT_FILL
+        GuiDrawText(isVertical? GuiIconText(ICON_ARROW_DOWN_FILL, NULL) : GuiIconText(ICON_ARROW_RIGHT_FILL, NULL),
+            RAYGUI_CLITERAL(Rectangle){ arrowDownRight.x, arrowDownRight.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
+            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(SCROLLBAR, TEXT + state*3)));   // ICON_ARROW_DOWN_FILL / ICON_ARROW_RIGHT_FILL
+#endif
+    }
+    //--------------------------------------------------------------------
+
+    return value;
+}
+
+// Scroll bar control for double precision ranges (used by GuiScrollPanelEx())
+// NOTE: Ranges not fitting RAYGUI_MAX_SCROLLBAR_STEPS are mapped to that number of scroll bar steps,
+// value is only updated on scroll bar interaction, so precision is kept when not interacting
+static double GuiScrollBarRange(Rectangle bounds, double value, double minValue, double maxValue)
+{
+    double range = maxValue - minValue;
+
+    if (range <= RAYGUI_MAX_SCROLLBAR_STEPS)
+    {
+        int barValue = (int)value;
+        int newBarValue = GuiScrollBar(bounds, barValue, (int)minValue, (int)maxValue);
+
+        if (newBarValue != barValue) value = (double)newBarValue;
+    }
+    else
+    {
+        int barValue = (int)(((value - minValue)/range)*RAYGUI_MAX_SCROLLBAR_STEPS);
+        int newBarValue = GuiScrollBar(bounds, barValue, 0, RAYGUI_MAX_SCROLLBAR_STEPS);
+
+        if (newBarValue != barValue) value = minValue + ((double)newBarValue/RAYGUI_MAX_SCROLLBAR_STEPS)*range;
+    }
+
+    return value;
+}
+
+// Load text style font from its font and charset files, generated at scale, set as gui font
+// NOTE: Charsets of RAYGUI_GLYPH_CACHE_MIN_CODEPOINTS or more codepoints are loaded as a lazy font,
+// generated font texture is kept so GuiSetScale() only generates the font again while it is gui font
+static bool GuiLoadStyleFontFile(float scale)
+{
+    int fontSize = (int)(guiStyleFontSize*scale + 0.5f);
+    int *codepoints = NULL;
+    int codepointCount = 0;
+    bool loaded = false;
+
+    if (guiStyleFontCharset[0] != '\0')
+    {
+        // Load text data from file
+        // NOTE: Expected an UTF-8 array of codepoints, no separation
+        char *textData = LoadFileText(guiStyleFontCharset);
+        codepoints = LoadCodepoints(textData, &codepointCount);
+        UnloadFileText(textData);
+    }
+
+    // Large charsets are loaded lazily, only glyphs in use are rasterized (raylib only)
+    if (codepointCount >= RAYGUI_GLYPH_CACHE_MIN_CODEPOINTS) loaded = GuiLoadFontLazy(guiStyleFontFile, fontSize);
+
+    if (!loaded)
+    {
+        // NOTE: Default to 95 standard codepoints if no charset
+        Font font = LoadFontEx(guiStyleFontFile, fontSize, (codepointCount > 0)? codepoints : NULL, codepointCount);
+
+        if ((font.texture.id > 0) && (font.glyphCount > 0))
+        {
+            GuiSetFont(font);
+            loaded = true;
+        }
+    }
+
+    UnloadCodepoints(codepoints);
+
+    guiStyleFontTextureId = loaded? guiFont.texture.id : 0;
+
+    return loaded;
+}
+
+// Load style font atlas texture and set it as gui font
+// NOTE: Image data can be updated (icons baking, SDF evaluation) but it is not unloaded
+static void GuiLoadStyleFont(Font font, int fontType, Image *imFont, Rectangle fontWhiteRec)
+{
+#if defined(RAYGUI_FONT_ICONS_BAKING)
+    // Font atlas image icons baking
+    Rectangle updatedWhiteRec = { 0 };
+    guiIconFontOffsetY = GuiFontIconBaking(imFont, font, &updatedWhiteRec);
+    if (guiIconFontOffsetY > 0) fontWhiteRec = updatedWhiteRec;
+#endif
+
+#if !defined(RAYGUI_STANDALONE)
+    #if defined(RAYGUI_NO_FONT_SHADER)
+    // SDF font atlas evaluated into a normal font atlas for current text size, if no shader callbacks set
+    // NOTE: Atlas is baked for loading time text size, later text size changes require style reloading
+    if ((fontType == FONT_TYPE_SDF) && (guiFontShaderBegin == NULL) && (guiFontShaderEnd == NULL))
+    {
+        GuiEvalFontSDF(imFont, (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)font.baseSize);
+        fontType = FONT_TYPE_NORMAL;
+    }
+    #endif
+    // Load texture from image
+    if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
+    font.texture = LoadTextureFromImage(*imFont);
+
+    // Fallback to default raylib texture if font texture loading fails
+    if (font.texture.id != 0)
+    {
+        // Set font texture source rectangle to be used as white texture to draw shapes
+        // NOTE: It makes possible to draw shapes and text (full UI) in a single draw call
+        if ((fontWhiteRec.x > 0) &&
+            (fontWhiteRec.y > 0) &&
+            (fontWhiteRec.width > 0) &&
+            (fontWhiteRec.height > 0)) SetShapesTexture(font.texture, fontWhiteRec);
+    }
+    else
+    {
+        font = GetFontDefault();
+        fontType = FONT_TYPE_NORMAL;
+    }
+
+    // NOTE: SDF font atlas requires bilinear filtering to be sampled at any size
+    if (fontType == FONT_TYPE_SDF) SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+
+    GuiSetFont(font);
+    GuiSetFontType(fontType);
+#else
+    // Font texture loading requires raylib, style font is not set
+    (void)font;
+    (void)fontType;
+    (void)imFont;
+    (void)fontWhiteRec;
+#endif
+}
+
+// Get indexed style data sections, validating checksum
+// NOTE: Unknown section types are skipped, sections out of data bounds are discarded
+static bool GuiGetStyleSections(const unsigned char *fileData, int dataSize, const unsigned char **sections, int *sizes, int *params)
+{
+    #define RGS_SECTION_STYLE       1
+    #define RGS_SECTION_FONT        2
+    #define RGS_SECTION_ATLAS       3
+    #define RGS_SECTION_RECS        4
+    #define RGS_SECTION_GLYPHS      5
+
+    short sectionCount = 0;
+    int fileSize = 0;
+    unsigned int checksum = 0;
+
+    if (dataSize >= 16)
+    {
+        memcpy(&sectionCount, fileData + 6, sizeof(short));
+        memcpy(&fileSize, fileData + 8, sizeof(int));
+        memcpy(&checksum, fileData + 12, sizeof(unsigned int));
+    }
+
+    bool valid = ((sectionCount >= 0) && (fileSize >= (16 + sectionCount*16)) && (fileSize <= dataSize));
+
+    if (valid)
+    {
+        // Security check, checksum must match the data after header
+        if (GuiHashData(2166136261u, fileData + 16, fileSize - 16) != checksum)
+        {
+            RAYGUI_LOG("WARNING: Style data checksum does not match, data could be corrupted\n");
+            valid = false;
+        }
+    }
+    else RAYGUI_LOG("WARNING: Style data size is not valid\n");
+
+    for (int i = 0; valid && (i < sectionCount); i++)
+    {
+        int entry[4] = { 0 };   // Section type, offset, size, param
+        memcpy(entry, fileData + 16 + i*16, sizeof(entry));
+
+        if ((entry[0] < RGS_SECTION_STYLE) || (entry[0] > RGS_SECTION_GLYPHS)) continue;
+
+        if ((entry[1] >= 16) && ((entry[1]%16) == 0) && (entry[2] >= 0) && (entry[2] <= (fileSize - entry[1])))
+        {
+            sections[entry[0]] = fileData + entry[1];
+            sizes[entry[0]] = entry[2];
+            params[entry[0]] = entry[3];
+        }
+        else RAYGUI_LOG("WARNING: Style data section %i out of bounds\n", i);
+    }
+
+    return valid;
+}
+
+// Load indexed style data (.rgs version >= 700)
+// NOTE: Style table is complete and already propagated, so it is copied with no GuiSetStyle() calls,
+// font data is copied from its sections and uncompressed atlas image data is uploaded from file data
+static void GuiLoadStyleIndexed(const unsigned char *fileData, int dataSize)
+{
+    const unsigned char *sections[RGS_SECTION_GLYPHS + 1] = { 0 };
+    int sectionSizes[RGS_SECTION_GLYPHS + 1] = { 0 };
+    int sectionParams[RGS_SECTION_GLYPHS + 1] = { 0 };
+
+    if (GuiGetStyleSections(fileData, dataSize, sections, sectionSizes, sectionParams))
+    {
+        // Load style table
+        // NOTE: Properties per control could differ from current build, overlapping properties are loaded
+        // NOTE: Properties count is bounded by section size, so properties data size can not overflow
+        if ((sections[RGS_SECTION_STYLE] != NULL) && (sectionParams[RGS_SECTION_STYLE] > 0) && (sectionParams[RGS_SECTION_STYLE] <= sectionSizes[RGS_SECTION_STYLE]/4))
+        {
+            int propsCount = sectionParams[RGS_SECTION_STYLE];
+            int controlsCount = sectionSizes[RGS_SECTION_STYLE]/(propsCount*4);
+            unsigned int value = 0;
+
+            for (int control = 0; (control < controlsCount) && (control < RAYGUI_MAX_CONTROLS); control++)
+            {
+                for (int property = 0; (property < propsCount) && (property < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)); property++)
+                {
+                    memcpy(&value, sections[RGS_SECTION_STYLE] + (control*propsCount + property)*4, sizeof(unsigned int));
+
+                    int index = control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property;
+                    guiStyle[index] = value;
+                    guiStyleBase[index] = (float)(int)value;
+                }
+            }
+
+            guiStyleLoaded = true;
+        }
+
+        // Load custom font if available
+        // NOTE: Font texture loading requires raylib
+        if ((sections[RGS_SECTION_FONT] != NULL) && (sectionSizes[RGS_SECTION_FONT] >= 80) &&
+            (sections[RGS_SECTION_ATLAS] != NULL) && (sections[RGS_SECTION_RECS] != NULL) && (sections[RGS_SECTION_GLYPHS] != NULL))
+        {
+            const unsigned char *fontInfo = sections[RGS_SECTION_FONT];
+            Font font = { 0 };
+            int fontType = 0;   // 0-Normal, 1-SDF
+            Rectangle fontWhiteRec = { 0 };
+
+            Image imFont = { 0 };
+            imFont.mipmaps = 1;
+
+            // GLOBAL: Copy font file name into guiFontName
+            memcpy(guiFontName, fontInfo, 32);
+            memcpy(&font.baseSize, fontInfo + 32, sizeof(int));
+            memcpy(&font.glyphCount, fontInfo + 36, sizeof(int));
+            memcpy(&fontType, fontInfo + 40, sizeof(int));
+            memcpy(&imFont.width, fontInfo + 44, sizeof(int));
+            memcpy(&imFont.height, fontInfo + 48, sizeof(int));
+            memcpy(&imFont.format, fontInfo + 52, sizeof(int));
+            memcpy(&fontWhiteRec, fontInfo + 64, sizeof(Rectangle));
+
+            // Security check, atlas image size must match atlas data size (section param) and glyphs
+            // must fit recs and glyphs sections, counts are bounded before computing data sizes
+            int atlasDataSize = sectionParams[RGS_SECTION_ATLAS];
+            int atlasPixelSize = 0;
+            if (imFont.format == 1) atlasPixelSize = 1;         // PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            else if (imFont.format == 2) atlasPixelSize = 2;    // PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+            else if (imFont.format == 7) atlasPixelSize = 4;    // PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+
+            bool fontValid = ((atlasPixelSize > 0) && (atlasDataSize > 0) && (imFont.width > 0) && (imFont.height > 0) &&
+                (imFont.width <= atlasDataSize/atlasPixelSize/imFont.height) && ((imFont.width*imFont.height*atlasPixelSize) == atlasDataSize) &&
+                (font.glyphCount > 0) && (font.glyphCount <= sectionSizes[RGS_SECTION_RECS]/16) && (font.glyphCount <= sectionSizes[RGS_SECTION_GLYPHS]/16));
+
+            if (fontValid)
+            {
+                // Load font atlas image data
+                bool atlasInPlace = false;
+
+                if (sectionSizes[RGS_SECTION_ATLAS] != atlasDataSize)
+                {
+                    // Compressed font atlas image data (DEFLATE), it requires DecompressData()
+                    int dataUncompSize = 0;
+                    imFont.data = DecompressData(sections[RGS_SECTION_ATLAS], sectionSizes[RGS_SECTION_ATLAS], &dataUncompSize);
+
+                    // Security check, dataUncompSize must match the provided atlas data size
+                    if ((imFont.data != NULL) && (dataUncompSize != atlasDataSize))
+                    {
+                        RAYGUI_LOG("WARNING: Uncompressed font atlas image data could be corrupted, font not loaded\n");
+                        RAYGUI_FREE(imFont.data);
+                        imFont.data = NULL;
+                    }
+                }
+                else
+                {
+#if defined(RAYGUI_FONT_ICONS_BAKING) || defined(RAYGUI_NO_FONT_SHADER)
+                    // Font atlas image data can be updated on loading, it requires a copy
+                    imFont.data = (unsigned char *)RAYGUI_CALLOC(atlasDataSize, sizeof(unsigned char));
+                    if (imFont.data != NULL) memcpy(imFont.data, sections[RGS_SECTION_ATLAS], atlasDataSize);
+#else
+                    // Font atlas image data is uploaded from file data, no copy required
+                    imFont.data = (void *)sections[RGS_SECTION_ATLAS];
+                    atlasInPlace = true;
+#endif
+                }
+
+                if (imFont.data != NULL)
+                {
+                    // Load font recs data, stored with Rectangle layout
+                    font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));
+                    memcpy(font.recs, sections[RGS_SECTION_RECS], font.glyphCount*sizeof(Rectangle));
+
+                    // Load font glyphs info data
+                    const unsigned char *glyphsData = sections[RGS_SECTION_GLYPHS];
+                    font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+
+                    for (int i = 0; i < font.glyphCount; i++)
+                    {
+                        memcpy(&font.glyphs[i].value, glyphsData + i*16, sizeof(int));
+                        memcpy(&font.glyphs[i].offsetX, glyphsData + i*16 + 4, sizeof(int));
+                        memcpy(&font.glyphs[i].offsetY, glyphsData + i*16 + 8, sizeof(int));
+                        memcpy(&font.glyphs[i].advanceX, glyphsData + i*16 + 12, sizeof(int));
+                    }
+
+                    GuiLoadStyleFont(font, fontType, &imFont, fontWhiteRec);
+
+                    if (!atlasInPlace) RAYGUI_FREE(imFont.data);
+                }
+            }
+            else RAYGUI_LOG("WARNING: Style font data is not valid, font not loaded\n");
+        }
+    }
+}
+
+#if defined(RAYGUI_STYLE_HOT_RELOAD)
+// Read style data properties into a style table and get font data hash, no style changes applied
+// NOTE: Properties are set over provided table, updated properties are flagged
+static bool GuiReadStyleData(const unsigned char *fileData, int dataSize, unsigned int *style, bool *updated, unsigned int *fontHash)
+{
+    bool valid = false;
+    *fontHash = 2166136261u;
+
+    if ((dataSize >= 12) && (memcmp(fileData, "rGS ", 4) == 0))
+    {
+        short version = 0;
+        memcpy(&version, fileData + 4, sizeof(short));
+
+        if (version >= 700)
+        {
+            // Indexed style data: Full style table, font data hashed from font sections
+            const unsigned char *sections[RGS_SECTION_GLYPHS + 1] = { 0 };
+            int sectionSizes[RGS_SECTION_GLYPHS + 1] = { 0 };
+            int sectionParams[RGS_SECTION_GLYPHS + 1] = { 0 };
+
+            valid = GuiGetStyleSections(fileData, dataSize, sections, sectionSizes, sectionParams);
+
+            if (valid && (sections[RGS_SECTION_STYLE] != NULL) && (sectionParams[RGS_SECTION_STYLE] > 0) && (sectionParams[RGS_SECTION_STYLE] <= sectionSizes[RGS_SECTION_STYLE]/4))
+            {
+                int propsCount = sectionParams[RGS_SECTION_STYLE];
+                int controlsCount = sectionSizes[RGS_SECTION_STYLE]/(propsCount*4);
+                unsigned int value = 0;
+
+                for (int control = 0; (control < controlsCount) && (control < RAYGUI_MAX_CONTROLS); control++)
+                {
+                    for (int property = 0; (property < propsCount) && (property < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)); property++)
+                    {
+                        memcpy(&value, sections[RGS_SECTION_STYLE] + (control*propsCount + property)*4, sizeof(unsigned int));
+
+                        int index = control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property;
+                        style[index] = value;
+                        updated[index] = true;
+                    }
+                }
+            }
+
+            for (int type = RGS_SECTION_FONT; valid && (type <= RGS_SECTION_GLYPHS); type++)
+            {
+                if (sections[type] != NULL) *fontHash = GuiHashData(*fontHash, sections[type], sectionSizes[type]);
+            }
+        }
+        else
+        {
+            // Binary style data: Properties list, font data hashed from properties end
+            int propertyCount = 0;
+            memcpy(&propertyCount, fileData + 8, sizeof(int));
 
-#if !defined(RAYGUI_STANDALONE)
-            // Load texture from image
-            if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
-            font.texture = LoadTextureFromImage(imFont);
+            if ((propertyCount >= 0) && (propertyCount <= (dataSize - 12)/8))
+            {
+                short controlId = 0;
+                short propertyId = 0;
+                unsigned int propertyValue = 0;
+
+                for (int i = 0; i < propertyCount; i++)
+                {
+                    memcpy(&controlId, fileData + 12 + 8*i, sizeof(short));
+                    memcpy(&propertyId, fileData + 12 + 8*i + 2, sizeof(short));
+                    memcpy(&propertyValue, fileData + 12 + 8*i + 4, sizeof(unsigned int));
+
+                    GuiSetStyleTable(style, updated, controlId, propertyId, propertyValue);
+                }
+
+                // Font data must be complete, style file could be truncated
+                int fontDataSize = GuiGetStyleFontDataSize(fileData + 12 + 8*propertyCount, dataSize - 12 - 8*propertyCount, version);
+
+                if (fontDataSize >= 0)
+                {
+                    *fontHash = GuiHashData(*fontHash, fileData + 12 + 8*propertyCount, fontDataSize);
+                    valid = true;
+                }
+            }
+        }
+    }
+    else if ((dataSize > 0) && (fileData[0] == '#') && (fileData[dataSize - 1] == '\n'))
+    {
+        // Text style data: Properties lines, font data hashed from font line
+        // NOTE: Font line references font and charset files, changes on those files are not detected,
+        // every line ends with a line break, so text data not ending with it is considered truncated
+        const char *line = (const char *)fileData;
+        const char *end = line + dataSize;
 
-            // Fallback to default raylib texture if font texture loading fails
-            if (font.texture.id != 0)
+        while (line < end)
+        {
+            const char *next = (const char *)memchr(line, '\n', end - line);
+            int length = (next != NULL)? (int)(next - line) : (int)(end - line);
+
+            if (line[0] == 'p')
             {
-                // Set font texture source rectangle to be used as white texture to draw shapes
-                // NOTE: It makes possible to draw shapes and text (full UI) in a single draw call
-                if ((fontWhiteRec.x > 0) &&
-                    (fontWhiteRec.y > 0) &&
-                    (fontWhiteRec.width > 0) &&
-                    (fontWhiteRec.height > 0)) SetShapesTexture(font.texture, fontWhiteRec);
+                // Style property: p <control_id> <property_id> <property_value> <property_name>
+                char buffer[64] = { 0 };
+                int controlId = 0;
+                int propertyId = 0;
+                unsigned int propertyValue = 0;
+
+                memcpy(buffer, line, (length < 63)? length : 63);
+                if (sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue) == 3) GuiSetStyleTable(style, updated, controlId, propertyId, propertyValue);
             }
-            else font = GetFontDefault();
+            else if (line[0] == 'f') *fontHash = GuiHashData(*fontHash, line, length);
 
-            GuiSetFont(font);
+            line += length + 1;
+        }
+
+        valid = true;
+    }
+
+    return valid;
+}
+
+// Get binary style font data size, font data starting at font data size field
+// NOTE: Returns -1 if font data is truncated (style file could be still being written) or not valid
+static int GuiGetStyleFontDataSize(const unsigned char *fontData, int dataSize, int version)
+{
+    int fontDataSize = 0;
+
+    if (dataSize < 4) return -1;
+    memcpy(&fontDataSize, fontData, sizeof(int));
+    if (fontDataSize <= 0) return 4;
+
+    // Font info: font data size, file name (version >= 600), base size, glyphs count, type, white rectangle, image sizes and image info
+    int nameSize = (version >= 600)? 32 : 0;
+    int infoSize = 4 + nameSize + 12 + 16 + 8 + 12;
+    int glyphCount = 0;
+    int imageUncompSize = 0;
+    int imageCompSize = 0;
+
+    if (dataSize < infoSize) return -1;
+    memcpy(&glyphCount, fontData + 4 + nameSize + 4, sizeof(int));
+    memcpy(&imageUncompSize, fontData + 4 + nameSize + 12 + 16, sizeof(int));
+    memcpy(&imageCompSize, fontData + 4 + nameSize + 12 + 16 + 4, sizeof(int));
+
+    int imageSize = ((imageCompSize > 0) && (imageCompSize != imageUncompSize))? imageCompSize : imageUncompSize;
+    if ((glyphCount <= 0) || (glyphCount > dataSize/16) || (imageSize <= 0) || (imageSize > (dataSize - infoSize))) return -1;
+
+    int size = infoSize + imageSize;
+
+    // Recs and glyphs data, 16 bytes per glyph, could be compressed (version >= 400)
+    for (int k = 0; k < 2; k++)
+    {
+        int compSize = 0;
+        int glyphsDataSize = glyphCount*16;
+
+        if (version >= 400)
+        {
+            if ((dataSize - size) < 4) return -1;
+            memcpy(&compSize, fontData + size, sizeof(int));
+            size += 4;
+        }
+
+        if ((compSize > 0) && (compSize != glyphsDataSize)) glyphsDataSize = compSize;
+        if (glyphsDataSize > (dataSize - size)) return -1;
+        size += glyphsDataSize;
+    }
+
+    return size;
+}
+
+// Set style table property, DEFAULT base properties are propagated to all controls
+static void GuiSetStyleTable(unsigned int *style, bool *updated, int control, int property, unsigned int value)
+{
+    if ((control >= 0) && (control < RAYGUI_MAX_CONTROLS) && (property >= 0) && (property < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)))
+    {
+        int count = ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))? RAYGUI_MAX_CONTROLS : 1;
+
+        for (int i = control; i < (control + count); i++)
+        {
+            style[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+            updated[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = true;
+        }
+    }
+}
+
+// Reload style file, applying only properties changed from current style
+// NOTE: Font is only reloaded (full style loading) if its data hash changed,
+// returns changed properties count, -1 if style file could not be read
+static int GuiReloadStyle(const char *fileName)
+{
+    int changed = -1;
+    int dataSize = 0;
+    unsigned char *fileData = NULL;
+
+    FILE *styleFile = fopen(fileName, "rb");
+
+    if (styleFile != NULL)
+    {
+        fseek(styleFile, 0, SEEK_END);
+        int fileSize = ftell(styleFile);
+        fseek(styleFile, 0, SEEK_SET);
+
+        if (fileSize > 0)
+        {
+            fileData = (unsigned char *)RAYGUI_CALLOC(fileSize, sizeof(unsigned char));
+            if (fileData != NULL) dataSize = (int)fread(fileData, sizeof(unsigned char), fileSize, styleFile);
+        }
+
+        fclose(styleFile);
+    }
+
+    if (fileData != NULL)
+    {
+        if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+        unsigned int style[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
+        bool updated[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
+        unsigned int fontHash = 0;
+
+        if (GuiReadStyleData(fileData, dataSize, style, updated, &fontHash))
+        {
+            changed = 0;
+
+            // Apply properties that differ from current style, metric properties compared unscaled
+            for (int i = 0; i < RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
+            {
+                if (!updated[i]) continue;
+
+                if (GuiIsStyleMetric(i/(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED), i%(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)))
+                {
+                    if ((float)(int)style[i] != guiStyleBase[i])
+                    {
+                        float value = (float)(int)style[i]*guiScale;
+                        guiStyleBase[i] = (float)(int)style[i];
+                        guiStyle[i] = (int)((value >= 0.0f)? value + 0.5f : value - 0.5f);
+                        changed++;
+                    }
+                }
+                else if (style[i] != guiStyle[i])
+                {
+                    guiStyle[i] = style[i];
+                    changed++;
+                }
+            }
+
+            // Font data changed, full style loading required to rebuild font
+            if (fontHash != guiStyleWatchFontHash)
+            {
+                GuiLoadStyle(fileName);
+                guiStyleWatchFontHash = fontHash;
+            }
+        }
+        else RAYGUI_LOG("WARNING: Style file could not be reloaded: %s\n", fileName);
+
+        RAYGUI_FREE(fileData);
+    }
+
+    return changed;
+}
+
+// Get style file size, -1 if file could not be opened
+static long GuiGetStyleFileSize(const char *fileName)
+{
+    long fileSize = -1;
+    FILE *styleFile = fopen(fileName, "rb");
+
+    if (styleFile != NULL)
+    {
+        fseek(styleFile, 0, SEEK_END);
+        fileSize = ftell(styleFile);
+        fclose(styleFile);
+    }
+
+    return fileSize;
+}
 #endif
-            RAYGUI_FREE(imFont.data);
+
+#if defined(RAYGUI_FONT_ICONS_BAKING)
+// Update font image atlas to append raygui icons
+static int GuiFontIconBaking(Image *imFont, Font font, Rectangle *whiteRec)
+{
+    int iconOffsetY = 0;
+
+    // Check max glyph rec y bottom position in the atlas image,
+    // to start drawing icons below that line
+    int maxGlyphRecY = 0;
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if ((font.recs[i].y + font.recs[i].height) > maxGlyphRecY)
+            maxGlyphRecY = (int)font.recs[i].y + (int)font.recs[i].height;
+    }
+
+    int maxIconsPerLine = imFont->width/(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING);
+    int reqIconLines = RAYGUI_ICON_MAX_FONT_BACKED/maxIconsPerLine + RAYGUI_ICON_MAX_FONT_BACKED%maxIconsPerLine + 1; // One extra line
+    int reqHeight = reqIconLines*(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING);
+
+    // Check if image requires scaling and how much
+    if ((maxGlyphRecY + reqHeight) > imFont->height)
+    {
+        int newImHeight = 1;
+        while (newImHeight < (maxGlyphRecY + reqHeight)) newImHeight <<= 1; // Round to next POT
+
+        char *newImData = (char *)RL_CALLOC(imFont->width*newImHeight*2, sizeof(char));
+        memcpy(newImData, imFont->data, imFont->width*imFont->height*2);
+        RL_FREE(imFont->data);
+
+        // Clear imFont bottom-right corner rec
+        for (int y = 0; y < 4; y++)
+            for (int x = 0; x < 4; x++)
+                ((unsigned short *)newImData)[(imFont->height - y - 1)*imFont->width + imFont->width - x - 1] = 0x0000;
+
+        imFont->data = newImData;
+        imFont->height = newImHeight;
+
+        // Set new image white corner and new white rec
+        for (int y = 0; y < 3; y++)
+            for (int x = 0; x < 3; x++)
+                ((unsigned short *)newImData)[(imFont->height - y - 1)*imFont->width + imFont->width - x - 1] = 0xffff;
+
+        *whiteRec = RAYGUI_CLITERAL(Rectangle){ (float)imFont->width - 2, (float)imFont->height - 2, 1, 1 };
+    }
+
+    // Calculate image offset positions to start drawing
+    // NOTE: For Y, look for a multiple of icon size + 2*padding, for better alignment
+    int offsetX = RAYGUI_ICON_FONT_ATLAS_PADDING;
+    int offsetY = ((maxGlyphRecY + (RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING - 1))/
+        (RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING))*(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING) +
+        RAYGUI_ICON_FONT_ATLAS_PADDING;
+
+    iconOffsetY = offsetY - RAYGUI_ICON_FONT_ATLAS_PADDING;
+    unsigned short *pixels = (unsigned short *)imFont->data;
+
+    #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
+
+    for (int iconId = 0; iconId < RAYGUI_ICON_MAX_FONT_BACKED; iconId++)
+    {
+        // Wrap to next line if next icon won't fit
+        if ((offsetX + (RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING)) > imFont->width)
+        {
+            offsetX = RAYGUI_ICON_FONT_ATLAS_PADDING;
+            offsetY += RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING;
+        }
+
+        for (int i = 0, y = 0; i < RAYGUI_ICON_DATA_ELEMENTS; i++)
+        {
+            unsigned int data = guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i];
+
+            for (int k = 0; k < 32; k++)
+            {
+                pixels[(offsetY + y)*imFont->width + offsetX + k%16] = (BIT_CHECK(data, k))? 0xffff : 0x00ff;
+
+                if ((k == 15) || (k == 31)) y++;
+            }
         }
+
+        // Update current icon X position
+        offsetX += (RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING);
     }
+
+    return iconOffsetY;
 }
+#endif
 
-// Load style default over global style
-void GuiLoadStyleDefault(void)
+// Split controls text into multiple strings
+// NOTE: Re-used by GuiToggleSlider(), GuiComboBox(), GuiDropdownBox(), GuiListView(), GuiMessageBox(), GuiInputBox()
+static char **GuiTextSplit(const char *text, char delimiter, int *count)
 {
-    // Setting this flag first to avoid cyclic function calls
-    // when calling GuiSetStyle() and GuiGetStyle()
-    guiStyleLoaded = true;
+    // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
+    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
+    // all used memory is static... it has some limitations:
+    //      1. Maximum number of possible split strings is set by RAYGUI_TEXTSPLIT_MAX_ITEMS
+    //      2. Maximum size of text to split is RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE
+    // NOTE: Those definitions could be externally provided if required
 
-    // Initialize default LIGHT style property values
-    // WARNING: Default value are applied to all controls on set but
-    // they can be overwritten later on for every custom control
-    GuiSetStyle(DEFAULT, BORDER_COLOR_NORMAL, 0x838383ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_NORMAL, 0xc9c9c9ff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_NORMAL, 0x686868ff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_FOCUSED, 0x5bb2d9ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_FOCUSED, 0xc9effeff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_FOCUSED, 0x6c9bbcff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_PRESSED, 0x0492c7ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_PRESSED, 0x97e8ffff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_PRESSED, 0x368bafff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_DISABLED, 0xb5c1c2ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_DISABLED, 0xe6e9e9ff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_DISABLED, 0xaeb7b8ff);
-    GuiSetStyle(DEFAULT, BORDER_WIDTH, 1);
-    GuiSetStyle(DEFAULT, TEXT_PADDING, 0);
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    char **itemPtrs = guiContext->textSplitItems;   // String pointers array (points to buffer data)
+    char *buffer = guiContext->textSplitBuffer;     // Buffer data (text input copy with '\0' added)
+
+    RAYGUI_PROFILE_BEGIN("GuiTextSplit");
+
+    memset(buffer, 0, RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE);
+
+    RAYGUI_STATS_ADD(textSplits, 1);
+    RAYGUI_STATS_ADD(bufferBytes, RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE);
+
+    itemPtrs[0] = buffer;
+    int itemCounter = 1;
+
+    // Count how many substrings text contains and point to every one of them
+    for (int i = 0; i < RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE; i++)
+    {
+        buffer[i] = text[i];
+        if (buffer[i] == '\0') break;
+        else if ((buffer[i] == delimiter) || (buffer[i] == '\n'))
+        {
+            itemPtrs[itemCounter] = buffer + i + 1;
+            buffer[i] = '\0'; // Set terminator for current item
+
+            itemCounter++;
+            if (itemCounter >= RAYGUI_TEXTSPLIT_MAX_ITEMS) break;
+        }
+    }
+
+    *count = itemCounter;
+    RAYGUI_STATS_ADD(bufferBytes, itemCounter*(int)sizeof(char *));
+
+    RAYGUI_PROFILE_END("GuiTextSplit");
+
+    return itemPtrs;
+}
+
+// Convert color data from RGB to HSV
+// NOTE: Color data should be passed normalized
+static Vector3 ConvertRGBtoHSV(Vector3 rgb)
+{
+    Vector3 hsv = { 0 };
+    float min = 0.0f;
+    float max = 0.0f;
+    float delta = 0.0f;
 
-    // Initialize default extended property values
-    // NOTE: By default, extended property values are initialized to 0
-    GuiSetStyle(DEFAULT, TEXT_SIZE, 10);                // DEFAULT, shared by all controls
-    GuiSetStyle(DEFAULT, TEXT_SPACING, 1);              // DEFAULT, shared by all controls
-    GuiSetStyle(DEFAULT, LINE_COLOR, 0x90abb5ff);       // DEFAULT specific property
-    GuiSetStyle(DEFAULT, BACKGROUND_COLOR, 0xf5f5f5ff); // DEFAULT specific property
-    GuiSetStyle(DEFAULT, TEXT_LINE_SPACING, 12);        // DEFAULT, pixels between lines, from bottom of first line to top of second
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);   // DEFAULT, text aligned vertically to middle of text-bounds
+    min = (rgb.x < rgb.y)? rgb.x : rgb.y;
+    min = (min < rgb.z)? min  : rgb.z;
 
-    // Initialize control-specific property values
-    // NOTE: Those properties are in default list but require specific values by control type
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 2);
-    GuiSetStyle(SLIDER, TEXT_PADDING, 4);
-    GuiSetStyle(PROGRESSBAR, TEXT_PADDING, 4);
-    GuiSetStyle(CHECKBOX, TEXT_PADDING, 4);
-    GuiSetStyle(CHECKBOX, TEXT_ALIGNMENT, TEXT_ALIGN_RIGHT);
-    GuiSetStyle(DROPDOWNBOX, TEXT_PADDING, 0);
-    GuiSetStyle(DROPDOWNBOX, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-    GuiSetStyle(TEXTBOX, TEXT_PADDING, 4);
-    GuiSetStyle(TEXTBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiSetStyle(VALUEBOX, TEXT_PADDING, 0);
-    GuiSetStyle(VALUEBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiSetStyle(STATUSBAR, TEXT_PADDING, 8);
-    GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiSetStyle(TABBAR, TAB_ITEMS_WIDTH, 160);
+    max = (rgb.x > rgb.y)? rgb.x : rgb.y;
+    max = (max > rgb.z)? max  : rgb.z;
 
-    // Initialize extended property values
-    // NOTE: By default, extended property values are initialized to 0
-    GuiSetStyle(TOGGLE, GROUP_PADDING, 2);
-    GuiSetStyle(SLIDER, SLIDER_WIDTH, 16);
-    GuiSetStyle(SLIDER, SLIDER_PADDING, 1);
-    GuiSetStyle(PROGRESSBAR, PROGRESS_PADDING, 1);
-    GuiSetStyle(CHECKBOX, CHECK_PADDING, 1);
-    GuiSetStyle(COMBOBOX, COMBO_BUTTON_WIDTH, 32);
-    GuiSetStyle(COMBOBOX, COMBO_BUTTON_SPACING, 2);
-    GuiSetStyle(DROPDOWNBOX, ARROW_PADDING, 16);
-    GuiSetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING, 2);
-    GuiSetStyle(VALUEBOX, SPINNER_BUTTON_WIDTH, 24);
-    GuiSetStyle(VALUEBOX, SPINNER_BUTTON_SPACING, 2);
-    GuiSetStyle(SCROLLBAR, BORDER_WIDTH, 0);
-    GuiSetStyle(SCROLLBAR, ARROWS_VISIBLE, 0);
-    GuiSetStyle(SCROLLBAR, ARROWS_SIZE, 6);
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING, 0);
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, 16);
-    GuiSetStyle(SCROLLBAR, SCROLL_PADDING, 0);
-    GuiSetStyle(SCROLLBAR, SCROLL_SPEED, 12);
-    GuiSetStyle(LISTVIEW, LIST_ITEMS_HEIGHT, 28);
-    GuiSetStyle(LISTVIEW, LIST_ITEMS_SPACING, 2);
-    GuiSetStyle(LISTVIEW, LIST_ITEMS_BORDER_WIDTH, 1);
-    GuiSetStyle(LISTVIEW, SCROLLBAR_WIDTH, 12);
-    GuiSetStyle(LISTVIEW, SCROLLBAR_SIDE, SCROLLBAR_RIGHT_SIDE);
-    GuiSetStyle(COLORPICKER, COLOR_SELECTOR_SIZE, 8);
-    GuiSetStyle(COLORPICKER, HUEBAR_WIDTH, 16);
-    GuiSetStyle(COLORPICKER, HUEBAR_PADDING, 8);
-    GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT, 8);
-    GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW, 2);
+    hsv.z = max;            // Value
+    delta = max - min;
 
-    if (guiFont.texture.id != GetFontDefault().texture.id)
+    if (delta < 0.00001f)
     {
-        // Unload previous font texture
-        UnloadTexture(guiFont.texture);
-        RAYGUI_FREE(guiFont.recs);
-        RAYGUI_FREE(guiFont.glyphs);
-        guiFont.recs = NULL;
-        guiFont.glyphs = NULL;
+        hsv.y = 0.0f;
+        hsv.x = 0.0f;           // Undefined, maybe NAN?
+        return hsv;
+    }
 
-        // Setup default raylib font
-        guiFont = GetFontDefault();
+    if (max > 0.0f)
+    {
+        // NOTE: If max is 0, this divide would cause a crash
+        hsv.y = (delta/max);    // Saturation
+    }
+    else
+    {
+        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
+        hsv.y = 0.0f;
+        hsv.x = 0.0f;           // Undefined, maybe NAN?
+        return hsv;
+    }
 
-        // NOTE: Default raylib font character 95 is a white square
-        Rectangle whiteChar = guiFont.recs[95];
+    // NOTE: Comparing float values could not work properly
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
+    else
+    {
+        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
+        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+    }
 
-        // NOTE: Setting up a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
-        SetShapesTexture(guiFont.texture, RAYGUI_CLITERAL(Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 });
+    hsv.x *= 60.0f;     // Convert to degrees
 
-        // Reset baked icons offset in font
-        guiIconFontOffsetY = 0;
-    }
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
+
+    return hsv;
 }
 
-// Get text with icon id prepended
-// NOTE: Useful to add icons by name id (enum) instead of
-// a number that can change between ricon versions
-const char *GuiIconText(int iconId, const char *text)
+// Convert color data from HSV to RGB
+// NOTE: Color data should be passed normalized
+static Vector3 ConvertHSVtoRGB(Vector3 hsv)
 {
-#if defined(RAYGUI_NO_ICONS)
-    return NULL;
-#else
-    static char buffer[1024] = { 0 };
-    static char iconBuffer[16] = { 0 };
+    Vector3 rgb = { 0 };
+    float hh = 0.0f, p = 0.0f, q = 0.0f, t = 0.0f, ff = 0.0f;
+    long i = 0;
 
-    if (text != NULL)
+    // NOTE: Comparing float values could not work properly
+    if (hsv.y <= 0.0f)
     {
-        memset(buffer, 0, 1024);
-        snprintf(buffer, 1024, "#%03i#", iconId);
+        rgb.x = hsv.z;
+        rgb.y = hsv.z;
+        rgb.z = hsv.z;
+        return rgb;
+    }
 
-        for (int i = 5; i < 1024; i++)
-        {
-            buffer[i] = text[i - 5];
-            if (text[i - 5] == '\0') break;
-        }
+    hh = hsv.x;
+    if (hh >= 360.0f) hh = 0.0f;
+    hh /= 60.0f;
 
-        return buffer;
-    }
-    else
-    {
-        snprintf(iconBuffer, 16, "#%03i#", iconId);
+    i = (long)hh;
+    ff = hh - i;
+    p = hsv.z*(1.0f - hsv.y);
+    q = hsv.z*(1.0f - (hsv.y*ff));
+    t = hsv.z*(1.0f - (hsv.y*(1.0f - ff)));
 
-        return iconBuffer;
+    switch (i)
+    {
+        case 0:
+        {
+            rgb.x = hsv.z;
+            rgb.y = t;
+            rgb.z = p;
+        } break;
+        case 1:
+        {
+            rgb.x = q;
+            rgb.y = hsv.z;
+            rgb.z = p;
+        } break;
+        case 2:
+        {
+            rgb.x = p;
+            rgb.y = hsv.z;
+            rgb.z = t;
+        } break;
+        case 3:
+        {
+            rgb.x = p;
+            rgb.y = q;
+            rgb.z = hsv.z;
+        } break;
+        case 4:
+        {
+            rgb.x = t;
+            rgb.y = p;
+            rgb.z = hsv.z;
+        } break;
+        case 5:
+        default:
+        {
+            rgb.x = hsv.z;
+            rgb.y = p;
+            rgb.z = q;
+        } break;
     }
-#endif
+
+    return rgb;
 }
 
-#if !defined(RAYGUI_NO_ICONS)
-// Get full icons data pointer
-unsigned int *GuiGetIcons(void) { return guiIconsPtr; }
+// Color fade-in or fade-out, alpha goes from 0.0f to 1.0f
+// WARNING: It multiplies current alpha by alpha scale factor,
+// raylib Fade() multiplies alpha by 255.0f
+static Color GuiFade(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
 
-// Load raygui icons file (.rgi)
-// WARNING: guiIconsName[]][] memory should be manually freed!
-char **GuiLoadIcons(const char *fileName, bool loadIconsName)
+    Color result = { color.r, color.g, color.b, (unsigned char)(color.a*alpha) };
+
+    return result;
+}
+
+// Check pointer over control bounds, registering control for hit-testing
+// NOTE: With RAYGUI_HITTEST, only the topmost control (last drawn) under pointer is hovered,
+// control must be registered every frame in same order, once per control
+static bool GuiCheckHover(Vector2 point, Rectangle bounds)
 {
-    FILE *rgiFile = fopen(fileName, "rb");
-    char **guiIconsName = NULL;
+    bool hover = CheckCollisionPointRec(point, bounds);
 
-    if (rgiFile != NULL)
-    {
-        unsigned char *fileData = NULL;
-        int dataSize = 0;
+    // Pointer outside clip region can not hover clipped control parts
+    if (hover && (guiClipCount > 0)) hover = CheckCollisionPointRec(point, GuiGetClip());
 
-        fseek(rgiFile, 0, SEEK_END);
-        int size = (int)ftell(rgiFile);
-        fseek(rgiFile, 0, SEEK_SET);
+#if defined(RAYGUI_HITTEST)
+    if ((guiFrameCounter > 0) && (guiHitTestCount < RAYGUI_HITTEST_MAX_CONTROLS))
+    {
+        int control = guiHitTestCount;
+        guiHitTestCount++;
 
-        if (size > 0)
+        // Register control on grid window cells covered, controls out of grid window are only counted
+        if ((bounds.x <= (guiHitTestWindow.x + guiHitTestWindow.width)) && ((bounds.x + bounds.width) >= guiHitTestWindow.x) &&
+            (bounds.y <= (guiHitTestWindow.y + guiHitTestWindow.height)) && ((bounds.y + bounds.height) >= guiHitTestWindow.y))
         {
-            fileData = (unsigned char *)RL_CALLOC(size, sizeof(unsigned char));
-            // WARNING: File can be partially loaded but ignoring it for simplicity
-            dataSize = (int)fread(fileData, sizeof(unsigned char), size, rgiFile);
+            memcpy(&guiHitTestBounds[control], &bounds, sizeof(Rectangle)); // NOTE: Copied as is, avoiding bounds repacking on every call
 
-            guiIconsName = GuiLoadIconsFromMemory(fileData, dataSize, loadIconsName);
+            float maxCell = (float)(RAYGUI_HITTEST_WINDOW_CELLS - 1);
+            float minCellX = floorf((bounds.x - guiHitTestWindow.x)/RAYGUI_HITTEST_CELL_SIZE);
+            float minCellY = floorf((bounds.y - guiHitTestWindow.y)/RAYGUI_HITTEST_CELL_SIZE);
+            float maxCellX = floorf((bounds.x + bounds.width - guiHitTestWindow.x)/RAYGUI_HITTEST_CELL_SIZE);
+            float maxCellY = floorf((bounds.y + bounds.height - guiHitTestWindow.y)/RAYGUI_HITTEST_CELL_SIZE);
+
+            for (int cellY = (minCellY < 0.0f)? 0 : (int)minCellY; cellY <= ((maxCellY > maxCell)? (int)maxCell : (int)maxCellY); cellY++)
+            {
+                for (int cellX = (minCellX < 0.0f)? 0 : (int)minCellX; cellX <= ((maxCellX > maxCell)? (int)maxCell : (int)maxCellX); cellX++)
+                {
+                    if (guiHitTestEntryCount >= RAYGUI_HITTEST_MAX_ENTRIES) break;
+
+                    int cell = cellY*RAYGUI_HITTEST_WINDOW_CELLS + cellX;
+
+                    guiHitTestEntryControl[guiHitTestEntryCount] = control;
+                    guiHitTestEntryNext[guiHitTestEntryCount] = guiHitTestCells[cell];
+                    guiHitTestEntryCount++;
+                    guiHitTestCells[cell] = guiHitTestEntryCount;
+                }
+            }
         }
 
-        fclose(rgiFile);
+        // Control is hovered if it was resolved as topmost with same bounds
+        // NOTE: Pointer out of previous frame grid window can not be resolved, pointer is checked directly
+        if (guiHitTestResolved) hover = hover && (control == guiHitTestHovered) &&
+            (bounds.x == guiHitTestHoveredBounds.x) && (bounds.y == guiHitTestHoveredBounds.y) &&
+            (bounds.width == guiHitTestHoveredBounds.width) && (bounds.height == guiHitTestHoveredBounds.height);
     }
+#endif
 
-    return guiIconsName;
+    guiHoverLast = hover;
+
+    return hover;
 }
 
-// Load icons from memory
-// GLOBAL: Updates global variable: guiIconsPtr
-char **GuiLoadIconsFromMemory(const unsigned char *fileData, int dataSize, bool loadIconsName)
+// Check if bounds are completely outside current clip region
+// NOTE: Nothing is culled while a control is in exclusive mode (i.e. dragging a slider)
+static bool GuiIsCulled(Rectangle bounds)
 {
-    // Icon File Structure (.rgi)
-    // ------------------------------------------------------
-    // Offset  | Size    | Type       | Description
-    // ------------------------------------------------------
-    // 0       | 4       | char       | Signature: "rGI "
-    // 4       | 2       | short      | Version: 100, 500
-    // 6       | 2       | short      | reserved
+    bool culled = false;
 
-    // 8       | 2       | short      | Num icons (N)
-    // 10      | 2       | short      | Icons Size (Options: 16, 32, 64)
-
-    // Icons name id (32 bytes per name id)
-    // foreach (icon)
-    // {
-    //   12+32*i  | 32   | char       | Icon NameId
-    // }
-
-    // Icons data: One bit per pixel, stored as unsigned int array (depends on icon size)
-    // Size*Size pixels/32bit per unsigned int = K unsigned int per icon
-    // foreach (icon)
-    // {
-    //   ...   | K       | unsigned int | Icon Data
-    // }
-    // ------------------------------------------------------
+    if ((guiClipCount > 0) && !guiControlExclusiveMode)
+    {
+        Rectangle clip = GuiGetClip();
 
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
-    char **guiIconsName = NULL;
+        culled = ((bounds.x >= (clip.x + clip.width)) || ((bounds.x + bounds.width) <= clip.x) ||
+                  (bounds.y >= (clip.y + clip.height)) || ((bounds.y + bounds.height) <= clip.y));
+    }
 
-    char signature[5] = { 0 };
-    short version = 0;
-    short reserved = 0;
-    short iconCount = 0;
-    short iconSize = 0;
+    return culled;
+}
 
-    memcpy(signature, fileDataPtr, 4);
-    memcpy(&version, fileDataPtr + 4, sizeof(short));
-    memcpy(&reserved, fileDataPtr + 4 + 2, sizeof(short));
-    memcpy(&iconCount, fileDataPtr + 4 + 2 + 2, sizeof(short));
-    memcpy(&iconSize, fileDataPtr + 4 + 2 + 2 + 2, sizeof(short));
-    fileDataPtr += 12;
+// Check if bounds and side text are completely outside current clip region
+// NOTE: Side text width is not measured, bounds are extended up to the clip region edge on text sides
+static bool GuiIsCulledText(Rectangle bounds, bool textLeft, bool textRight)
+{
+    bool culled = GuiIsCulled(bounds);
 
-    if ((signature[0] == 'r') &&
-        (signature[1] == 'G') &&
-        (signature[2] == 'I') &&
-        (signature[3] == ' '))
+    if (culled && (textLeft || textRight))
     {
-        if (loadIconsName)
+        Rectangle clip = GuiGetClip();
+        Rectangle extended = bounds;
+        float textSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+
+        // Side text is vertically centered on bounds, it could be taller than the control
+        if (textSize > extended.height)
         {
-            // NOTE: Always allocating RAYGUI_ICON_MAX_ICONS names slots
-            guiIconsName = (char **)RAYGUI_CALLOC(RAYGUI_ICON_MAX_ICONS, sizeof(char *));
-            for (int i = 0; i < iconCount; i++)
-            {
-                guiIconsName[i] = (char *)RAYGUI_CALLOC(RAYGUI_ICON_MAX_NAME_LENGTH, sizeof(char));
-                memcpy(guiIconsName[i], fileDataPtr, RAYGUI_ICON_MAX_NAME_LENGTH);
-                fileDataPtr += RAYGUI_ICON_MAX_NAME_LENGTH;
-            }
+            extended.y -= (textSize - extended.height)/2;
+            extended.height = textSize;
         }
-        else
+
+        if (textLeft && (clip.x < extended.x))
         {
-            // Skip icon name data if not required
-            fileDataPtr += iconCount*RAYGUI_ICON_MAX_NAME_LENGTH;
+            extended.width += (extended.x - clip.x);
+            extended.x = clip.x;
         }
 
-        int iconDataSize = iconCount*((int)iconSize*(int)iconSize/32)*(int)sizeof(unsigned int);
-        guiIconsPtr = (unsigned int *)RAYGUI_CALLOC(iconDataSize, 1);
+        if (textRight && ((clip.x + clip.width) > (extended.x + extended.width))) extended.width = clip.x + clip.width - extended.x;
 
-        memcpy(guiIconsPtr, fileDataPtr, iconDataSize);
+        culled = GuiIsCulled(extended);
     }
 
-    return guiIconsName;
+    return culled;
 }
 
-// Draw selected icon using rectangles pixel-by-pixel
-void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
+// Get data hash for an id scope seed (FNV-1a 64-bit)
+static GuiID GuiHashID(GuiID seed, const void *data, int size)
 {
-    if ((guiIconFontOffsetY > 0) && (iconId < RAYGUI_ICON_MAX_FONT_BACKED))
+    GuiID hash = seed;
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (int i = 0; i < size; i++)
     {
-        int maxIconsPerLine = guiFont.texture.width/(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING);
-        int x = iconId%maxIconsPerLine;
-        int y = iconId/maxIconsPerLine;
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
 
-        Rectangle srcRec = { (float)x*(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING) + RAYGUI_ICON_FONT_ATLAS_PADDING,
-            guiIconFontOffsetY + (float)y*(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING) + RAYGUI_ICON_FONT_ATLAS_PADDING,
-            RAYGUI_ICON_SIZE, RAYGUI_ICON_SIZE };
-        Rectangle dstRec = { (float)posX, (float)posY, (float)pixelSize*RAYGUI_ICON_SIZE, (float)pixelSize*RAYGUI_ICON_SIZE };
+    if (hash == 0) hash = 1;    // Id 0 is reserved for no control
+
+    return hash;
+}
+
+// Get data hash, seed to continue a previous hash (FNV-1a 32-bit)
+static unsigned int GuiHashData(unsigned int seed, const void *data, int size)
+{
+    unsigned int hash = seed;
+    const unsigned char *bytes = (const unsigned char *)data;
 
-        DrawTexturePro(guiFont.texture, srcRec, dstRec, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, color);
+    for (int i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
     }
+
+    return hash;
+}
+
+// Get next control automatic id on current id scope
+// NOTE: Every control takes exactly one id (even if culled), ids are generated from scope seed and
+// controls sequence, restarted on GuiBeginFrame(); if GuiBeginFrame() is not used, controls bounds are
+// hashed instead of sequence, so ids are only stable while bounds do not change
+static GuiID GuiGetControlID(Rectangle bounds)
+{
+    GuiIDScope *scope = &guiIdStack[((guiIdCount < RAYGUI_ID_STACK_SIZE)? guiIdCount : RAYGUI_ID_STACK_SIZE) - 1];
+    GuiID id = 0;
+
+    if (guiFrameCounter > 0) id = GuiHashID(scope->seed, &scope->counter, sizeof(unsigned int));
     else
     {
-        #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
+        int rec[4] = { (int)bounds.x, (int)bounds.y, (int)bounds.width, (int)bounds.height };
+        id = GuiHashID(scope->seed, rec, sizeof(rec));
+    }
 
-        for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
-        {
-            for (int k = 0; k < 32; k++)
-            {
-                if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
-                {
-                    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ (float)posX + (k%RAYGUI_ICON_SIZE)*pixelSize,
-                        (float)posY + y*pixelSize, (float)pixelSize, (float)pixelSize }, 0, BLANK, color);
-                }
+    scope->counter++;
 
-                if ((k == 15) || (k == 31)) y++;
-            }
-        }
+    return id;
+}
+
+// Push control id scope, used by controls containing other controls
+// NOTE: Child controls ids are scoped by parent control id, so parent controls always take one id from
+// parent scope, independently of child controls drawn
+static void GuiPushControlID(GuiID id)
+{
+    if (guiIdCount < RAYGUI_ID_STACK_SIZE)
+    {
+        guiIdStack[guiIdCount].seed = id;
+        guiIdStack[guiIdCount].counter = 0;
     }
+    else RAYGUI_LOG("WARNING: Id stack is full, id scope ignored\n");
+
+    guiIdCount++;
 }
 
-// Set icon drawing size
-void GuiSetIconScale(int scale)
+// Get retained caches clock, used to find least recently used entries
+// NOTE: Frames counter if GuiBeginFrame() is used, otherwise frames can not be detected and
+// every cache use advances the clock, so entries not used recently are still replaced first
+static unsigned int GuiGetCacheClock(void)
 {
-    if (scale >= 1) guiIconScale = scale;
+    if (guiFrameCounter > 0) return guiFrameCounter;
+
+    guiCacheUses++;
+
+    return guiCacheUses;
 }
 
-// Get text width considering gui style and icon size (if required).
-// For multi-line text (containing '\n'), returns the width of the widest line.
-int GuiGetTextWidth(const char *text)
+// Get control retained data, valid if stored with same inputs key
+// NOTE: Entries are found by control id with linear probing, on miss the first empty or expired entry is
+// used (or the least recently used one), returned data must be filled by the control if not valid
+static void *GuiGetControlCache(GuiID id, unsigned int key, bool *valid)
 {
-    if (text == NULL) return 0;
+    *valid = false;
 
-    int maxWidth = 0;
-    const char *linePtr = text;
+    if (guiControlCache == NULL)
+    {
+        guiControlCache = (GuiControlCacheEntry *)RAYGUI_CALLOC(RAYGUI_CONTROL_CACHE_SIZE, sizeof(GuiControlCacheEntry));
 
-    while ((linePtr[0] != '\0') && ((linePtr - text) < MAX_LINE_BUFFER_SIZE))
+        if (guiControlCache == NULL)
+        {
+            RAYGUI_LOG("WARNING: Failed to allocate controls cache\n");
+            return NULL;
+        }
+    }
+
+    unsigned int clock = GuiGetCacheClock();
+    unsigned int expiry = (guiFrameCounter > 0)? RAYGUI_CONTROL_CACHE_FRAMES : RAYGUI_CONTROL_CACHE_SIZE;
+    int index = -1;
+    int replace = -1;
+
+    for (int i = 0; i < RAYGUI_CONTROL_CACHE_PROBES; i++)
     {
-        int lineWidth = GetLineWidth(linePtr);
-        if (lineWidth > maxWidth) maxWidth = lineWidth;
+        int probe = (int)((id + i) & (RAYGUI_CONTROL_CACHE_SIZE - 1));
+        GuiControlCacheEntry *entry = &guiControlCache[probe];
 
-        // Skip to the next '\n' (or end of string/buffer)
-        while ((linePtr[0] != '\0') && (linePtr[0] != '\n') && ((linePtr - text) < MAX_LINE_BUFFER_SIZE))
+        if (entry->id == id)
         {
-            linePtr++;
+            index = probe;
+            break;
         }
-        // Advance past the '\n' delimiter to the start of the next line
-        if (linePtr[0] == '\n') linePtr++;
+
+        bool expired = (entry->id == 0) || ((clock - entry->frame) > expiry);
+
+        if (replace == -1) replace = probe;
+        else if (expired || (entry->frame < guiControlCache[replace].frame)) replace = probe;
+        if (expired) break;
     }
 
-    return maxWidth;
+    *valid = ((index != -1) && (guiControlCache[index].key == key));
+
+    if (index == -1)
+    {
+        index = replace;
+        guiControlCache[index].id = id;
+    }
+
+    guiControlCache[index].key = key;
+    guiControlCache[index].frame = clock;
+
+    return guiControlCache[index].data;
 }
 
-#endif      // !RAYGUI_NO_ICONS
+// Get text hash, including text style and font (FNV-1a)
+static unsigned int GuiHashText(const char *text)
+{
+    unsigned int hash = 2166136261u;
+    int style[7] = { GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), (int)guiIconScale, (int)guiFont.texture.id, guiFont.baseSize, guiFont.glyphCount, (int)GuiGetGlyphGeneration() };
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-// Get text line width (stops at '\n' or '\0')
-// NOTE: Considers icon marker '#NNN#'
-static int GetLineWidth(const char *text)
+    for (int i = 0; text[i] != '\0'; i++) { hash ^= (unsigned char)text[i]; hash *= 16777619u; }
+    for (int i = 0; i < (int)sizeof(style); i++) { hash ^= ((const unsigned char *)style)[i]; hash *= 16777619u; }
+
+    return hash;
+}
+
+// Get text width, retained by control while text and text style do not change
+// NOTE: Slot identifies the text for controls with multiple texts (i.e. slider left/right texts)
+static int GuiGetTextWidthCached(GuiID id, int slot, const char *text)
 {
-#if !defined(RAYGUI_ICON_TEXT_PADDING)
-    #define RAYGUI_ICON_TEXT_PADDING   4
-#endif
+    if (text == NULL) return 0;
 
-    Vector2 textSize = { 0 };
-    int textIconOffset = 0;
+    int width = 0;
+    bool valid = false;
+    void *data = GuiGetControlCache((slot == 0)? id : GuiHashID(id, &slot, sizeof(int)), GuiHashText(text), &valid);
 
-    if ((text != NULL) && (text[0] != '\0'))
+    if (valid) memcpy(&width, data, sizeof(int));
+    else
     {
-        // Icon marker: '#' + 1..3 digits + '#' (matches GetTextIcon())
-        if (text[0] == '#')
+        width = GuiGetTextWidth(text);
+        if (data != NULL) memcpy(data, &width, sizeof(int));
+    }
+
+    return width;
+}
+
+// Get shaped text line, valid if retained with same text, text style, icon and available width
+// NOTE: Line ends at '\n' or '\0', on miss the least recently used entry is returned
+// with no glyphs, to be filled by GuiDrawText() while drawing the line
+static GuiTextRun *GuiGetTextRun(const char *line, bool icon, float width, bool *valid)
+{
+    int length = (int)strcspn(line, "\n");
+
+    int style[4] = { GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), (int)guiIconScale, (int)icon };
+    const void *font[2] = { guiFont.recs, guiFont.glyphs };
+    int fontInfo[4] = { (int)guiFont.texture.id, guiFont.baseSize, guiFont.glyphCount, (int)GuiGetGlyphGeneration() };
+
+    GuiID hash = GuiHashID(14695981039346656037ull, line, length);
+    hash = GuiHashID(hash, style, sizeof(style));
+    hash = GuiHashID(hash, font, sizeof(font));
+    hash = GuiHashID(hash, fontInfo, sizeof(fontInfo));
+    hash = GuiHashID(hash, &width, sizeof(float));
+
+    *valid = false;
+
+    if (guiTextRuns == NULL)
+    {
+        guiTextRuns = (GuiTextRun *)RAYGUI_CALLOC(RAYGUI_TEXT_RUN_CACHE_SIZE, sizeof(GuiTextRun));
+
+        if (guiTextRuns == NULL)
         {
-            int pos = 1;
-            while ((pos < 4) && (text[pos] >= '0') && (text[pos] <= '9')) pos++;
-            if (text[pos] == '#') textIconOffset = pos + 1;
+            RAYGUI_LOG("WARNING: Failed to allocate text runs cache\n");
+            return NULL;
         }
+    }
 
-        text += textIconOffset;
+    int index = -1;
+    int replace = -1;
 
-        // Make sure guiFont is set, GuiGetStyle() initializes it lazynessly
-        float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    for (int i = 0; i < RAYGUI_TEXT_RUN_CACHE_PROBES; i++)
+    {
+        int probe = (int)((hash + i) & (RAYGUI_TEXT_RUN_CACHE_SIZE - 1));
+        GuiTextRun *run = &guiTextRuns[probe];
 
-        // Custom MeasureText() implementation -- single line only
-        if ((guiFont.texture.id > 0) && (text != NULL))
+        if ((run->hash == hash) && (run->length == length))
         {
-            // Get size in bytes of the line, considering end of line and line break
-            int size = 0;
-            for (int i = 0; i < MAX_LINE_BUFFER_SIZE; i++)
-            {
-                if ((text[i] != '\0') && (text[i] != '\n')) size++;
-                else break;
-            }
+            index = probe;
+            break;
+        }
 
-            float scaleFactor = fontSize/(float)guiFont.baseSize;
-            textSize.y = (float)guiFont.baseSize*scaleFactor;
-            float glyphWidth = 0.0f;
+        if (replace == -1) replace = probe;
+        else if ((run->hash == 0) || (run->frame < guiTextRuns[replace].frame)) replace = probe;
+        if (run->hash == 0) break;
+    }
 
-            for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
-            {
-                int codepoint = GetCodepointNext(&text[i], &codepointSize);
-                int codepointIndex = GetGlyphIndex(guiFont, codepoint);
+    *valid = (index != -1);
 
-                if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+    if (index == -1)
+    {
+        index = replace;
+        guiTextRuns[index].hash = hash;
+        guiTextRuns[index].length = length;
+        guiTextRuns[index].glyphCount = 0;
+        guiTextRuns[index].cutIndex = 0;
+    }
 
-                textSize.x += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-            }
-        }
+    guiTextRuns[index].frame = GuiGetCacheClock();
 
-        if (textIconOffset > 0) textSize.x += (RAYGUI_ICON_SIZE + RAYGUI_ICON_TEXT_PADDING);
+    return &guiTextRuns[index];
+}
+
+// Add glyph to shaped text line being retained
+// NOTE: Glyphs count keeps increasing over the limit, so the line can be released once drawn
+static void GuiAddTextRunGlyph(GuiTextRun *run, int codepoint, float offset)
+{
+    if (run == NULL) return;
+
+    if (run->glyphCount < RAYGUI_TEXT_RUN_MAX_GLYPHS)
+    {
+        run->codepoints[run->glyphCount] = codepoint;
+        run->offsets[run->glyphCount] = offset;
     }
 
-    return (int)textSize.x;
+    run->glyphCount++;
 }
 
-// Get text bounds considering control bounds
-static Rectangle GetTextBounds(int control, Rectangle bounds)
+// Get color hsv, retained by control while color is not changed
+// NOTE: Avoids rgb to hsv conversion every frame and keeps hue and saturation for grays
+static Vector3 GuiGetColorHSVCached(GuiID id, Color color)
 {
-    Rectangle textBounds = bounds;
+    Color retainedColor = { 0 };
+    Vector3 hsv = { 0 };
+    bool valid = false;
+    unsigned char *data = (unsigned char *)GuiGetControlCache(id, 1, &valid);
 
-    textBounds.x = bounds.x + GuiGetStyle(control, BORDER_WIDTH);
-    textBounds.y = bounds.y + GuiGetStyle(control, BORDER_WIDTH) + GuiGetStyle(control, TEXT_PADDING);
-    textBounds.width = bounds.width - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);
-    textBounds.height = bounds.height - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);    // NOTE: Text is processed line per line!
+    if (valid) memcpy(&retainedColor, data, sizeof(Color));
 
-    // Depending on control, TEXT_PADDING and TEXT_ALIGNMENT properties could affect the text-bounds
-    switch (control)
+    if (valid && (retainedColor.r == color.r) && (retainedColor.g == color.g) && (retainedColor.b == color.b)) memcpy(&hsv, data + sizeof(Color), sizeof(Vector3));
+    else
     {
-        case COMBOBOX:
-        case DROPDOWNBOX:
-        case LISTVIEW:
-            // TODO: Special cases (no label): COMBOBOX, DROPDOWNBOX, LISTVIEW
-        case SLIDER:
-        case CHECKBOX:
-        case VALUEBOX:
-        case TABBAR:
-            // TODO: Special cases (label on side): SLIDER, CHECKBOX, VALUEBOX, SPINNER
-        default:
+        hsv = ConvertRGBtoHSV(RAYGUI_CLITERAL(Vector3){ color.r/255.0f, color.g/255.0f, color.b/255.0f });
+
+        if (data != NULL)
         {
-            // WARNING: TEXT_ALIGNMENT is already considered in GuiDrawText()
-            if (GuiGetStyle(control, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT) textBounds.x -= GuiGetStyle(control, TEXT_PADDING);
-            else textBounds.x += GuiGetStyle(control, TEXT_PADDING);
+            memcpy(data, &color, sizeof(Color));
+            memcpy(data + sizeof(Color), &hsv, sizeof(Vector3));
         }
-        break;
     }
 
-    return textBounds;
+    return hsv;
 }
 
-// Get text icon if provided and move text cursor
-// NOTE: Up to RAYGUI_ICON_MAX_ICONS supported for iconId
-static const char *GetTextIcon(const char *text, int *iconId)
+// Set color hsv, retained by control
+static void GuiSetColorHSVCached(GuiID id, Color color, Vector3 hsv)
 {
-#if !defined(RAYGUI_NO_ICONS)
-    *iconId = -1;
-    if (text[0] == '#') // Maybe an icon, if it starts with # but an ending # must be found
-    {
-        char iconValue[4] = { 0 }; // Maximum length for icon value: 3 digits + '\0'
+    bool valid = false;
+    unsigned char *data = (unsigned char *)GuiGetControlCache(id, 1, &valid);
+    if (data == NULL) return;
 
-        int pos = 1;
-        while ((pos < 4) && (text[pos] >= '0') && (text[pos] <= '9'))
+    memcpy(data, &color, sizeof(Color));
+    memcpy(data + sizeof(Color), &hsv, sizeof(Vector3));
+}
+
+// Get tab bar tabs measures, retained by control while tabs count, tab bar style, text style and font do not change
+// NOTE: On miss all tabs are measured, the least recently used entry is replaced (reusing its buffers),
+// returns NULL if tabs measures could not be allocated
+static GuiTabBarCacheEntry *GuiGetTabBarCache(GuiID id, char **text, int count)
+{
+    // NOTE: Tabs measures depend on text style, font, rasterized glyphs and gui scale (tabs padding)
+    int tabStyle[8] = { count, GuiGetStyle(TABBAR, TAB_ITEMS_WIDTH), GuiGetStyle(TABBAR, TAB_CLOSE_BUTTON),
+        GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), (int)guiFont.texture.id, guiFont.baseSize, (int)GuiGetGlyphGeneration() };
+    float tabScale = guiScale;
+    unsigned int key = GuiHashData(GuiHashData(2166136261u, tabStyle, sizeof(tabStyle)), &tabScale, sizeof(float));
+
+    GuiTabBarCacheEntry *entry = NULL;
+
+    for (int i = 0; i < RAYGUI_TABBAR_CACHE_SIZE; i++)
+    {
+        if (guiTabBarCache[i].id == id)
         {
-            iconValue[pos - 1] = text[pos];
-            pos++;
+            entry = &guiTabBarCache[i];
+            break;
         }
 
-        if (text[pos] == '#')
+        if ((entry == NULL) || (guiTabBarCache[i].frame < entry->frame) || (guiTabBarCache[i].id == 0)) entry = &guiTabBarCache[i];
+    }
+
+    if (entry->id != id)
+    {
+        entry->id = id;
+        entry->key = key + 1;   // Force tabs measure
+        entry->active = -1;
+        entry->scroll = 0;
+    }
+
+    entry->frame = GuiGetCacheClock();
+
+    if (entry->key != key)
+    {
+        if (count > entry->capacity)
         {
-            int rawIconId = TextToInteger(iconValue);
-            if (rawIconId < RAYGUI_ICON_MAX_ICONS)
-            {
-                *iconId = rawIconId;
+            RAYGUI_FREE(entry->offsets);
+            RAYGUI_FREE(entry->hashes);
 
-                // Move text pointer after icon
-                // WARNING: If only icon provided, it could point to EOL character: '\0'
-                if (*iconId >= 0) text += (pos + 1);
+            entry->offsets = (float *)RAYGUI_MALLOC((count + 1)*sizeof(float));
+            entry->hashes = (unsigned int *)RAYGUI_MALLOC(count*sizeof(unsigned int));
+            entry->capacity = count;
+
+            if ((entry->offsets == NULL) || (entry->hashes == NULL))
+            {
+                RAYGUI_LOG("WARNING: Failed to allocate tab bar tabs measures\n");
+                RAYGUI_FREE(entry->offsets);
+                RAYGUI_FREE(entry->hashes);
+                entry->offsets = NULL;
+                entry->hashes = NULL;
+                entry->capacity = 0;
+                entry->id = 0;
+                return NULL;
             }
         }
+
+        entry->key = key;
+        entry->count = count;
+        entry->offsets[0] = 0.0f;
+
+        for (int i = 0; i < count; i++)
+        {
+            entry->hashes[i] = (text[i] != NULL)? GuiHashText(text[i]) : 0;
+            entry->offsets[i + 1] = entry->offsets[i] + GuiGetTabWidth(text[i]) + RAYGUI_TABBAR_TAB_SPACING*guiScale;
+        }
+    }
+
+    return entry;
+}
+
+// Update tab bar tabs measures for changed tabs text in range [first, last]
+// NOTE: Only visible tabs text is verified, hidden tabs are re-measured when they get visible
+static void GuiUpdateTabBarCache(GuiTabBarCacheEntry *entry, char **text, int first, int last)
+{
+    for (int i = first; (i <= last) && (i < entry->count); i++)
+    {
+        unsigned int hash = (text[i] != NULL)? GuiHashText(text[i]) : 0;
+
+        if (hash != entry->hashes[i])
+        {
+            float delta = GuiGetTabWidth(text[i]) + RAYGUI_TABBAR_TAB_SPACING*guiScale - (entry->offsets[i + 1] - entry->offsets[i]);
+
+            for (int k = i + 1; k <= entry->count; k++) entry->offsets[k] += delta;
+            entry->hashes[i] = hash;
+        }
     }
-#endif
-
-    return text;
 }
 
-// Get text divided into lines (by line-breaks '\n')
-// WARNING: It returns pointers to new lines but it does not add NULL ('\0') terminator!
-static const char **GetTextLines(const char *text, int *count)
+// Get tab index at offset (relative to first tab), binary search over tabs offsets
+// NOTE: Offsets out of tabs are clamped to first/last tab
+static int GuiGetTabBarIndex(const GuiTabBarCacheEntry *entry, float offset)
 {
-    #define RAYGUI_MAX_TEXT_LINES   128
+    int low = 0;
+    int high = entry->count - 1;
 
-    static const char *lines[RAYGUI_MAX_TEXT_LINES] = { 0 };
-    for (int i = 0; i < RAYGUI_MAX_TEXT_LINES; i++) lines[i] = NULL;    // Init NULL pointers to substrings
+    while (low < high)
+    {
+        int mid = (low + high + 1)/2;
 
-    int textLength = (int)strlen(text);
+        if (entry->offsets[mid] <= offset) low = mid;
+        else high = mid - 1;
+    }
 
-    lines[0] = text;
-    *count = 1;
+    return low;
+}
+
+// Get tab width for text, tab items width is used as minimum width
+static float GuiGetTabWidth(const char *text)
+{
+    float width = (float)GuiGetStyle(TABBAR, TAB_ITEMS_WIDTH);
 
-    for (int i = 0; (i < textLength) && (*count < RAYGUI_MAX_TEXT_LINES); i++)
+    if (text != NULL)
     {
-        if ((text[i] == '\n') && ((i + 1) < textLength))
-        {
-            lines[*count] = &text[i + 1];
-            *count += 1;
-        }
+        float textWidth = (float)GuiGetTextWidth(text) + 2*RAYGUI_TABBAR_TAB_PADDING*guiScale;
+        if (GuiGetStyle(TABBAR, TAB_CLOSE_BUTTON)) textWidth += (RAYGUI_TABBAR_CLOSE_SIZE + RAYGUI_TABBAR_CLOSE_MARGIN)*guiScale;
+        if (textWidth > width) width = textWidth;
     }
 
-    return lines;
+    return width;
 }
 
-// Get text width to next space for provided string
-static float GetNextSpaceWidth(const char *text, int *nextSpaceIndex)
+// Get text items count and item text at index, items separated by ';' or '\n' (same as GuiTextSplit())
+// NOTE: Returned item text is not '\0' terminated and points to provided text, NULL if index out of items
+static const char *GuiGetTextItem(const char *text, int index, int *count)
 {
-    float width = 0;
-    int codepointByteCount = 0;
-    int codepoint = 0;
-    int index = 0;
-    float glyphWidth = 0;
-    float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
+    const char *item = (index == 0)? text : NULL;
+    int itemCount = 1;
 
     for (int i = 0; text[i] != '\0'; i++)
     {
-        if (text[i] != ' ')
-        {
-            codepoint = GetCodepoint(&text[i], &codepointByteCount);
-            index = GetGlyphIndex(guiFont, codepoint);
-            glyphWidth = (guiFont.glyphs[index].advanceX == 0)? guiFont.recs[index].width*scaleFactor : guiFont.glyphs[index].advanceX*scaleFactor;
-            width += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-        }
-        else
+        if ((text[i] == ';') || (text[i] == '\n'))
         {
-            *nextSpaceIndex = i;
-            break;
+            if (itemCount == index) item = text + i + 1;
+            itemCount++;
         }
     }
 
-    return width;
+    if (count != NULL) *count = itemCount;
+
+    return item;
 }
 
-// Gui draw text using default font
-static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint)
+// Copy item text (up to separator) into dropdown item text buffer
+// NOTE: Returned string is valid until next call on same context
+static const char *GuiCopyTextItem(const char *item)
 {
-    #define TEXT_VALIGN_PIXEL_OFFSET(h)  ((int)h%2)     // Vertical alignment for pixel perfect
-
-    #if !defined(RAYGUI_ICON_TEXT_PADDING)
-        #define RAYGUI_ICON_TEXT_PADDING   4
-    #endif
+    char *buffer = guiContext->dropdownItemText;
+    int length = 0;
 
-    if ((text == NULL) || (text[0] == '\0')) return;    // Security check
+    if (item != NULL)
+    {
+        while ((length < (RAYGUI_DROPDOWN_MAX_ITEM_TEXT_SIZE - 1)) && (item[length] != '\0') && (item[length] != ';') && (item[length] != '\n')) length++;
+        memcpy(buffer, item, length);
+    }
 
-    // PROCEDURE:
-    //   - Text is processed line per line
-    //   - For every line, horizontal alignment is defined
-    //   - For all text, vertical alignment is defined (multiline text only)
-    //   - For every line, wordwrap mode is checked (useful for GuitextBox(), read-only)
+    buffer[length] = '\0';
 
-    // Get text lines (using '\n' as delimiter) to be processed individually
-    // WARNING: GuiTextSplit() function can't be used now because it can have already been used
-    // before the GuiDrawText() call and its buffer is static, it would be overriden :(
-    int lineCount = 0;
-    const char **lines = GetTextLines(text, &lineCount);
+    return buffer;
+}
 
-    // Text style variables
-    //int alignment = GuiGetStyle(DEFAULT, TEXT_ALIGNMENT);
-    int alignmentVertical = GuiGetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL);
-    int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);    // Wrap-mode only available in read-only mode, no for text editing
+// Update open dropdown box items index, rebuilt when dropdown box or its items text change
+// NOTE: Returns true if dropdown box has just been open, scroll and type-ahead are reset
+static bool GuiUpdateDropdownIndex(GuiID id, const char *text)
+{
+    GuiDropdownIndex *index = &guiDropdownIndex;
 
-    // TODO: WARNING: This totalHeight is not valid for vertical alignment in case of word-wrap
-    float totalHeight = (float)(lineCount*GuiGetStyle(DEFAULT, TEXT_SIZE) + (lineCount - 1)*GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
-    float posOffsetY = 0.0f;
+    int length = (int)strlen(text);
+    unsigned int key = GuiHashData(2166136261u, text, length);
+    bool open = (index->id != id);
 
-    for (int i = 0; i < lineCount; i++)
+    if (open || (index->key != key))
     {
-        int iconId = 0;
-        lines[i] = GetTextIcon(lines[i], &iconId);      // Check text for icon and move cursor
-
-        // Get text position depending on alignment and iconId
-        //---------------------------------------------------------------------------------
-        Vector2 textBoundsPosition = { textBounds.x, textBounds.y };
-        float textBoundsWidthOffset = 0.0f;
-
-        // NOTE: Icon was already stripped above by GetTextIcon(); GetLineWidth()
-        // takes no icon path here and returns only the glyph width of this line.
-        int textSizeX = GetLineWidth(lines[i]);
+        int count = 0;
+        GuiGetTextItem(text, -1, &count);
 
-        // If text requires an icon, add size to measure
-        if (iconId >= 0)
-        {
-            textSizeX += RAYGUI_ICON_SIZE*guiIconScale;
-
-            // WARNING: If only icon provided, text could be pointing to EOF character: '\0'
-#if !defined(RAYGUI_NO_ICONS)
-            if ((lines[i] != NULL) && (lines[i][0] != '\0')) textSizeX += RAYGUI_ICON_TEXT_PADDING;
-#endif
-        }
-
-        // Check guiTextAlign global variables
-        switch (alignment)
+        if (count > index->capacity)
         {
-            case TEXT_ALIGN_LEFT: textBoundsPosition.x = textBounds.x; break;
-            case TEXT_ALIGN_CENTER: textBoundsPosition.x = textBounds.x +  textBounds.width/2 - textSizeX/2; break;
-            case TEXT_ALIGN_RIGHT: textBoundsPosition.x = textBounds.x + textBounds.width - textSizeX; break;
-            default: break;
-        }
+            RAYGUI_FREE(index->offsets);
+            RAYGUI_FREE(index->sorted);
 
-        if (textSizeX > textBounds.width && (lines[i] != NULL) && (lines[i][0] != '\0')) textBoundsPosition.x = textBounds.x;
+            index->offsets = (int *)RAYGUI_MALLOC((count + 1)*sizeof(int));
+            index->sorted = (int *)RAYGUI_MALLOC(2*count*sizeof(int));
+            index->capacity = count;
 
-        switch (alignmentVertical)
-        {
-            // Only valid in case of wordWrap = 0;
-            case TEXT_ALIGN_TOP: textBoundsPosition.y = textBounds.y + posOffsetY; break;
-            case TEXT_ALIGN_MIDDLE: textBoundsPosition.y = textBounds.y + posOffsetY + textBounds.height/2 - totalHeight/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height); break;
-            case TEXT_ALIGN_BOTTOM: textBoundsPosition.y = textBounds.y + posOffsetY + textBounds.height - totalHeight + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height); break;
-            default: break;
+            if ((index->offsets == NULL) || (index->sorted == NULL))
+            {
+                RAYGUI_LOG("WARNING: Failed to allocate dropdown box items index\n");
+                RAYGUI_FREE(index->offsets);
+                RAYGUI_FREE(index->sorted);
+                index->offsets = NULL;
+                index->sorted = NULL;
+                index->capacity = 0;
+                count = 0;
+            }
         }
 
-        // NOTE: Make sure getting pixel-perfect coordinates,
-        // In case of decimals, it could result in text positioning artifacts
-        textBoundsPosition.x = (float)((int)textBoundsPosition.x);
-        textBoundsPosition.y = (float)((int)textBoundsPosition.y);
-        //---------------------------------------------------------------------------------
-
-        // Draw text (with icon if available)
-        //---------------------------------------------------------------------------------
-#if !defined(RAYGUI_NO_ICONS)
-        if (iconId >= 0)
+        if (count > 0)
         {
-            // NOTE: Considering icon height, probably different than text size
-            GuiDrawIcon(iconId, (int)textBoundsPosition.x, (int)(textBounds.y + textBounds.height/2 - RAYGUI_ICON_SIZE*guiIconScale/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height)), guiIconScale, tint);
-            textBoundsPosition.x += (float)(RAYGUI_ICON_SIZE*guiIconScale + RAYGUI_ICON_TEXT_PADDING);
-            textBoundsWidthOffset = (float)(RAYGUI_ICON_SIZE*guiIconScale + RAYGUI_ICON_TEXT_PADDING);
-        }
-#endif
-        // Get size in bytes of text, considering end of line and line break
-        int lineSize = 0;
-        for (int c = 0; (lines[i][c] != '\0') && (lines[i][c] != '\n') && (lines[i][c] != '\r'); c++, lineSize++){ }
-        float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
-
-        int lastSpaceIndex = 0;
-        bool tempWrapCharMode = false;
-
-        int textOffsetY = 0;
-        float textOffsetX = 0.0f;
-        float glyphWidth = 0;
+            // Items offsets, last offset is text end (+1)
+            int item = 1;
+            index->offsets[0] = 0;
 
-        int ellipsisWidth = GuiGetTextWidth("...");
-        bool textOverflow = false;
-        for (int c = 0, codepointSize = 0; c < lineSize; c += codepointSize)
-        {
-            int codepoint = GetCodepointNext(&lines[i][c], &codepointSize);
-            int index = GetGlyphIndex(guiFont, codepoint);
+            for (int i = 0; i <= length; i++)
+            {
+                if ((text[i] == ';') || (text[i] == '\n') || (text[i] == '\0')) index->offsets[item++] = i + 1;
+            }
 
-            // NOTE: Normally, exiting the decoding sequence as soon as a bad byte is found (and return 0x3f)
-            // but all of the bad bytes need to be drawn using the '?' symbol, moving one byte
-            if (codepoint == 0x3f) codepointSize = 1; // WARNING: Not recognized codepoints size
+            // Bottom-up merge sort on items, stable
+            int *src = index->sorted;
+            int *dst = index->sorted + count;
+            int iconId = 0;
 
-            // Get glyph width to check if it goes out of bounds
-            if (guiFont.glyphs[index].advanceX == 0) glyphWidth = ((float)guiFont.recs[index].width*scaleFactor);
-            else glyphWidth = (float)guiFont.glyphs[index].advanceX*scaleFactor;
+            for (int i = 0; i < count; i++) src[i] = i;
 
-            // Wrap mode text measuring, to validate if
-            // it can be drawn or a new line is required
-            if (wrapMode == TEXT_WRAP_CHAR)
+            for (int width = 1; width < count; width *= 2)
             {
-                // Jump to next line if current character reach end of the box limits
-                if ((textOffsetX + glyphWidth) > textBounds.width - textBoundsWidthOffset)
+                for (int start = 0; start < count; start += 2*width)
                 {
-                    textOffsetX = 0.0f;
-                    textOffsetY += (GuiGetStyle(DEFAULT, TEXT_SIZE) + GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
+                    int mid = (start + width < count)? start + width : count;
+                    int end = (start + 2*width < count)? start + 2*width : count;
+                    int i = start, j = mid, k = start;
 
-                    if (tempWrapCharMode) // Wrap at char level when too long words
+                    while ((i < mid) && (j < end))
                     {
-                        wrapMode = TEXT_WRAP_WORD;
-                        tempWrapCharMode = false;
+                        const char *a = GetTextIcon(text + index->offsets[src[i]], &iconId);
+                        const char *b = GetTextIcon(text + index->offsets[src[j]], &iconId);
+
+                        // Take right element only if strictly lower (stability)
+                        if (GuiCompareTextItem(b, a, -1) < 0) dst[k++] = src[j++];
+                        else dst[k++] = src[i++];
                     }
+
+                    while (i < mid) dst[k++] = src[i++];
+                    while (j < end) dst[k++] = src[j++];
                 }
+
+                int *swap = src;
+                src = dst;
+                dst = swap;
             }
-            else if (wrapMode == TEXT_WRAP_WORD)
-            {
-                if (codepoint == 32) lastSpaceIndex = c;
 
-                // Get width to next space in line
-                int nextSpaceIndex = 0;
-                float nextSpaceWidth = GetNextSpaceWidth(lines[i] + c, &nextSpaceIndex);
+            if (src != index->sorted) memcpy(index->sorted, src, count*sizeof(int));
+        }
 
-                int nextSpaceIndex2 = 0;
-                float nextWordSize = GetNextSpaceWidth(lines[i] + lastSpaceIndex + 1, &nextSpaceIndex2);
+        index->id = (count > 0)? id : 0;
+        index->key = key;
+        index->count = count;
+    }
 
-                if (nextWordSize > textBounds.width - textBoundsWidthOffset)
-                {
-                    // Considering the case the next word is longer than bounds
-                    tempWrapCharMode = true;
-                    wrapMode = TEXT_WRAP_CHAR;
-                }
-                else if ((textOffsetX + nextSpaceWidth) > textBounds.width - textBoundsWidthOffset)
-                {
-                    textOffsetX = 0.0f;
-                    textOffsetY += (GuiGetStyle(DEFAULT, TEXT_SIZE) + GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
-                }
-            }
+    if (open)
+    {
+        index->scroll = 0;
+        index->typedItem = -1;
+        index->typedLength = 0;
+        index->frames = 0;
+    }
+    else index->frames++;
 
-            if (codepoint == '\n') break; // WARNING: Lines are already processed manually, no need to keep drawing after this codepoint
-            else
-            {
-                // WARNING: There are multiple types of spaces in Unicode,
-                // maybe it's a good idea to add support for more: http://jkorpela.fi/chars/spaces.html
-                if ((codepoint != ' ') && (codepoint != '\t')) // Do not draw codepoints with no glyph
-                {
-                    if (wrapMode == TEXT_WRAP_NONE)
-                    {
-                        // Draw only required text glyphs fitting the textBounds.width
-                        if (textSizeX > textBounds.width)
-                        {
-                            if (textOffsetX <= (textBounds.width - glyphWidth - textBoundsWidthOffset - ellipsisWidth))
-                            {
-                                DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
-                            }
-                            else if (!textOverflow)
-                            {
-                                textOverflow = true;
+    return open;
+}
 
-                                for (int j = 0; j < ellipsisWidth; j += ellipsisWidth/3)
-                                {
-                                    DrawTextCodepoint(guiFont, '.', RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX + j, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
-                                }
-                            }
-                        }
-                        else
-                        {
-                            DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
-                        }
-                    }
-                    else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
-                    {
-                        // Draw only glyphs inside the bounds
-                        if ((textBoundsPosition.y + textOffsetY) <= (textBounds.y + textBounds.height - GuiGetStyle(DEFAULT, TEXT_SIZE)))
-                        {
-                            DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
-                        }
-                    }
-                }
+// Compare item texts (case-insensitive), up to separator (';', '\n' or '\0') or length characters if length >= 0
+static int GuiCompareTextItem(const char *item, const char *other, int length)
+{
+    for (int i = 0; (length < 0) || (i < length); i++)
+    {
+        int a = ((item[i] == ';') || (item[i] == '\n'))? 0 : (unsigned char)item[i];
+        int b = ((other[i] == ';') || (other[i] == '\n'))? 0 : (unsigned char)other[i];
+
+        if ((a >= 'A') && (a <= 'Z')) a += ('a' - 'A');
+        if ((b >= 'A') && (b <= 'Z')) b += ('a' - 'A');
+
+        if ((a != b) || (a == 0)) return (a - b);
+    }
+
+    return 0;
+}
+
+// Find first item (in sorted order) starting with prefix, binary search over open dropdown box items index
+// NOTE: Prefix is expected lowercase, items icons are ignored
+static int GuiFindDropdownItem(const char *text, const char *prefix, int length)
+{
+    const GuiDropdownIndex *index = &guiDropdownIndex;
+
+    int low = 0;
+    int high = index->count;
+    int iconId = 0;
+
+    while (low < high)
+    {
+        int mid = (low + high)/2;
+
+        if (GuiCompareTextItem(GetTextIcon(text + index->offsets[index->sorted[mid]], &iconId), prefix, length) < 0) low = mid + 1;
+        else high = mid;
+    }
+
+    if ((low < index->count) && (GuiCompareTextItem(GetTextIcon(text + index->offsets[index->sorted[low]], &iconId), prefix, length) == 0)) return index->sorted[low];
+
+    return -1;
+}
+
+// Begin layout container, used by GuiLayoutBegin()/GuiLayoutGridBegin()
+// NOTE: Cache entries are found by inputs hash with linear probing and verified with stored inputs,
+// on miss the oldest inactive entry is replaced; when items cache is full, all inactive entries
+// are evicted and active ones compacted
+static void GuiLayoutContainerBegin(Rectangle bounds, int type, int columns, const GuiLayoutItem *items, int count, float spacing)
+{
+    #define RAYGUI_LAYOUT_CACHE_PROBES  (RAYGUI_LAYOUT_STACK_SIZE + 1)
+
+    if (guiLayoutCount >= RAYGUI_LAYOUT_STACK_SIZE)
+    {
+        RAYGUI_LOG("WARNING: Layout stack is full, layout container ignored\n");
+        guiLayoutCount++;
+        return;
+    }
+
+    if (guiLayoutCache == NULL)
+    {
+        guiLayoutCache = (GuiLayoutCacheEntry *)RAYGUI_CALLOC(RAYGUI_LAYOUT_CACHE_SIZE, sizeof(GuiLayoutCacheEntry));
+        guiLayoutItems = (Rectangle *)RAYGUI_CALLOC(RAYGUI_LAYOUT_CACHE_ITEMS, sizeof(Rectangle));
+        guiLayoutInputs = (GuiLayoutCacheInput *)RAYGUI_CALLOC(RAYGUI_LAYOUT_CACHE_ITEMS, sizeof(GuiLayoutCacheInput));
+
+        if ((guiLayoutCache == NULL) || (guiLayoutItems == NULL) || (guiLayoutInputs == NULL))
+        {
+            RAYGUI_LOG("WARNING: Failed to allocate layout cache, layout container ignored\n");
+            RAYGUI_FREE(guiLayoutCache);
+            RAYGUI_FREE(guiLayoutItems);
+            RAYGUI_FREE(guiLayoutInputs);
+            guiLayoutCache = NULL;
+            guiLayoutItems = NULL;
+            guiLayoutInputs = NULL;
+
+            // Container pushed with no items, so it is ended as usual
+            guiLayoutStack[guiLayoutCount].bounds = bounds;
+            guiLayoutStack[guiLayoutCount].entry = -1;
+            guiLayoutStack[guiLayoutCount].next = 0;
+            guiLayoutCount++;
+            return;
+        }
+    }
+
+    if ((items == NULL) || (count < 0)) count = 0;
+    if (count > RAYGUI_LAYOUT_CACHE_ITEMS/2)
+    {
+        RAYGUI_LOG("WARNING: Layout container items limit reached, items ignored\n");
+        count = RAYGUI_LAYOUT_CACHE_ITEMS/2;
+    }
+
+    GuiLayoutCacheText text = { 0 };
+    unsigned int hash = GuiLayoutHash(type, columns, items, count, spacing, bounds.width, bounds.height, &text);
+    guiLayoutStamp++;
+
+    // Look for cached entry or best entry to be replaced
+    int index = -1;
+    int replace = -1;
+
+    for (int i = 0; i < RAYGUI_LAYOUT_CACHE_PROBES; i++)
+    {
+        int probe = (int)((hash + i) & (RAYGUI_LAYOUT_CACHE_SIZE - 1));
+        GuiLayoutCacheEntry *entry = &guiLayoutCache[probe];
+
+        if ((entry->hash == hash) && GuiLayoutCacheMatch(entry, type, columns, items, count, spacing, bounds.width, bounds.height, &text))
+        {
+            index = probe;
+            break;
+        }
 
-                if (guiFont.glyphs[index].advanceX == 0) textOffsetX += ((float)guiFont.recs[index].width*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-                else textOffsetX += ((float)guiFont.glyphs[index].advanceX*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+        if (!entry->active && ((replace == -1) || (entry->stamp < guiLayoutCache[replace].stamp))) replace = probe;
+    }
+
+    if (index == -1)
+    {
+        // Evict all inactive entries if there is no space for items bounds,
+        // active entries items are compacted to the beginning of the items cache
+        if ((guiLayoutItemsUsed + count) > RAYGUI_LAYOUT_CACHE_ITEMS)
+        {
+            // Active entries (once, could be shared by nested containers) sorted by increasing offset,
+            // so every entry is moved down over already moved (or evicted) entries only
+            int active[RAYGUI_LAYOUT_STACK_SIZE] = { 0 };
+            int activeCount = 0;
+
+            for (int i = 0; i < guiLayoutCount; i++)
+            {
+                int entry = guiLayoutStack[i].entry;
+                if (entry < 0) continue;        // Container ignored, no cache entry
+
+                int k = activeCount;
+                bool shared = false;
+
+                for (int j = 0; j < activeCount; j++) if (active[j] == entry) shared = true;
+                if (shared) continue;
+
+                while ((k > 0) && (guiLayoutCache[active[k - 1]].offset > guiLayoutCache[entry].offset)) { active[k] = active[k - 1]; k--; }
+                active[k] = entry;
+                activeCount++;
+            }
+
+            guiLayoutItemsUsed = 0;
+
+            for (int i = 0; i < activeCount; i++)
+            {
+                GuiLayoutCacheEntry *entry = &guiLayoutCache[active[i]];
+
+                memmove(&guiLayoutItems[guiLayoutItemsUsed], &guiLayoutItems[entry->offset], entry->count*sizeof(Rectangle));
+                memmove(&guiLayoutInputs[guiLayoutItemsUsed], &guiLayoutInputs[entry->offset], entry->count*sizeof(GuiLayoutCacheInput));
+                entry->offset = guiLayoutItemsUsed;
+                guiLayoutItemsUsed += entry->count;
             }
+
+            for (int i = 0; i < RAYGUI_LAYOUT_CACHE_SIZE; i++) if (!guiLayoutCache[i].active) guiLayoutCache[i].hash = 0;
         }
 
-        if (wrapMode == TEXT_WRAP_NONE) posOffsetY += (float)(GuiGetStyle(DEFAULT, TEXT_SIZE) + GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
-        else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
-            posOffsetY += (textOffsetY + GuiGetStyle(DEFAULT, TEXT_SIZE));
-        //---------------------------------------------------------------------------------
+        index = replace;
+        guiLayoutCache[index].hash = hash;
+        guiLayoutCache[index].offset = guiLayoutItemsUsed;
+        guiLayoutCache[index].count = count;
+        guiLayoutItemsUsed += count;
+
+        GuiLayoutCacheStore(&guiLayoutCache[index], type, columns, items, count, spacing, bounds.width, bounds.height, &text);
+        GuiLayoutCompute(bounds, type, columns, items, count, spacing, &guiLayoutItems[guiLayoutCache[index].offset]);
     }
 
-#if defined(RAYGUI_DEBUG_TEXT_BOUNDS)
-    GuiDrawRectangle(textBounds, 0, WHITE, Fade(BLUE, 0.4f));
-#endif
+    guiLayoutCache[index].stamp = guiLayoutStamp;
+    guiLayoutCache[index].active = true;
+
+    guiLayoutStack[guiLayoutCount].bounds = bounds;
+    guiLayoutStack[guiLayoutCount].entry = index;
+    guiLayoutStack[guiLayoutCount].next = 0;
+    guiLayoutCount++;
 }
 
-// Gui draw rectangle using default raygui plain style with borders
-static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color)
+// Get layout inputs hash (FNV-1a), text measure inputs filled if required
+// NOTE: Text style and font are only considered if some item is measured from text
+static unsigned int GuiLayoutHash(int type, int columns, const GuiLayoutItem *items, int count, float spacing, float width, float height, GuiLayoutCacheText *text)
 {
-    if (color.a > 0)
+    #define RAYGUI_LAYOUT_HASH_INT(value) { unsigned int v = (unsigned int)(value); for (int b = 0; b < 4; b++) { hash ^= (v & 0xff); hash *= 16777619u; v >>= 8; } }
+
+    unsigned int hash = 2166136261u;
+    bool measured = false;
+
+    RAYGUI_LAYOUT_HASH_INT(type);
+    RAYGUI_LAYOUT_HASH_INT(columns);
+    RAYGUI_LAYOUT_HASH_INT(count);
+    RAYGUI_LAYOUT_HASH_INT(spacing*64.0f);
+    RAYGUI_LAYOUT_HASH_INT(guiScale*64.0f);
+    RAYGUI_LAYOUT_HASH_INT(width*64.0f);
+    RAYGUI_LAYOUT_HASH_INT(height*64.0f);
+
+    for (int i = 0; i < count; i++)
     {
-        // Draw rectangle filled with color
-        DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, GuiFade(color, guiAlpha));
+        RAYGUI_LAYOUT_HASH_INT(items[i].mode);
+        RAYGUI_LAYOUT_HASH_INT(items[i].size*64.0f);
+
+        if ((items[i].mode == LAYOUT_SIZE_TEXT) && (items[i].text != NULL))
+        {
+            for (const char *c = items[i].text; *c != '\0'; c++) { hash ^= (unsigned char)*c; hash *= 16777619u; }
+            measured = true;
+        }
     }
 
-    if (borderWidth > 0)
+    if (measured)
     {
-        // Draw rectangle border lines with color
-        DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x + (int)rec.width - borderWidth, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x, (int)rec.y + (int)rec.height - borderWidth, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
+        text->textSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+        text->textSpacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+        text->textLineSpacing = GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+        text->iconScale = guiIconScale;
+        text->fontId = guiFont.texture.id;
+        text->fontBaseSize = guiFont.baseSize;
+        text->generation = GuiGetGlyphGeneration();
+
+        RAYGUI_LAYOUT_HASH_INT(text->textSize);
+        RAYGUI_LAYOUT_HASH_INT(text->textSpacing);
+        RAYGUI_LAYOUT_HASH_INT(text->textLineSpacing);
+        RAYGUI_LAYOUT_HASH_INT(text->iconScale);
+        RAYGUI_LAYOUT_HASH_INT(text->fontId);
+        RAYGUI_LAYOUT_HASH_INT(text->fontBaseSize);
+        RAYGUI_LAYOUT_HASH_INT(text->generation);
     }
 
-#if defined(RAYGUI_DEBUG_RECS_BOUNDS)
-    DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, Fade(RED, 0.4f));
-#endif
+    if (hash == 0) hash = 1;    // Hash 0 is reserved for empty cache entries
+
+    return hash;
 }
 
-// Draw tooltip using control bounds
-static void GuiTooltip(Rectangle controlRec)
+// Check layout cache entry stored inputs are equal to provided ones
+// NOTE: Items text is verified by length and hash, text pointers could be reused with different content
+static bool GuiLayoutCacheMatch(const GuiLayoutCacheEntry *entry, int type, int columns, const GuiLayoutItem *items, int count, float spacing, float width, float height, const GuiLayoutCacheText *text)
 {
-    if (!guiLocked && guiTooltip && (guiTooltipPtr != NULL) && !guiControlExclusiveMode)
-    {
-        Vector2 textSize = MeasureTextEx(guiFont, guiTooltipPtr, (float)GuiGetStyle(DEFAULT, TEXT_SIZE),
-            (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+    if ((entry->count != count) || (entry->type != type) || (entry->columns != columns) ||
+        (entry->spacing != spacing) || (entry->width != width) || (entry->height != height) || (entry->scale != guiScale)) return false;
+    if (memcmp(&entry->text, text, sizeof(GuiLayoutCacheText)) != 0) return false;
 
-        if ((controlRec.x + textSize.x + 16) > GetScreenWidth()) controlRec.x -= (textSize.x + 16 - controlRec.width);
+    const GuiLayoutCacheInput *inputs = &guiLayoutInputs[entry->offset];
 
-        int lineCount = 0;
-        GetTextLines(guiTooltipPtr, &lineCount); // Only using the line count
-        if ((controlRec.y + controlRec.height + textSize.y + 4 + 8*lineCount) > GetScreenHeight())
-            controlRec.y -= (controlRec.height + textSize.y + 4 + 8*lineCount);
+    for (int i = 0; i < count; i++)
+    {
+        if ((inputs[i].mode != items[i].mode) || (inputs[i].size != items[i].size)) return false;
 
-        // TODO: Probably TEXT_LINE_SPACING should be considered on panel size instead of hardcoding 8.0f
-        GuiPanel(RAYGUI_CLITERAL(Rectangle){ controlRec.x, controlRec.y + controlRec.height + 4, textSize.x + 16, textSize.y + 8.0f*lineCount }, NULL);
+        if (items[i].mode == LAYOUT_SIZE_TEXT)
+        {
+            int length = (items[i].text != NULL)? (int)strlen(items[i].text) : -1;
 
-        int textPadding = GuiGetStyle(LABEL, TEXT_PADDING);
-        int textAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
-        GuiSetStyle(LABEL, TEXT_PADDING, 0);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-        GuiLabel(RAYGUI_CLITERAL(Rectangle){ controlRec.x, controlRec.y + controlRec.height + 4, textSize.x + 16, textSize.y + 8.0f*lineCount }, guiTooltipPtr);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, textAlignment);
-        GuiSetStyle(LABEL, TEXT_PADDING, textPadding);
+            if (inputs[i].textLength != length) return false;
+            if ((length > 0) && (inputs[i].textHash != GuiHashData(2166136261u, items[i].text, length))) return false;
+        }
     }
+
+    return true;
 }
 
-// Scroll bar control (used by GuiScrollPanel())
-static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
+// Store layout inputs on cache entry, items inputs stored at entry offset
+static void GuiLayoutCacheStore(GuiLayoutCacheEntry *entry, int type, int columns, const GuiLayoutItem *items, int count, float spacing, float width, float height, const GuiLayoutCacheText *text)
 {
-    GuiState state = guiState;
+    entry->type = type;
+    entry->columns = columns;
+    entry->spacing = spacing;
+    entry->width = width;
+    entry->height = height;
+    entry->scale = guiScale;
+    entry->text = *text;
 
-    // Is the scrollbar horizontal or vertical?
-    bool isVertical = (bounds.width > bounds.height)? false : true;
+    GuiLayoutCacheInput *inputs = &guiLayoutInputs[entry->offset];
 
-    // The size (width or height depending on scrollbar type) of the spinner buttons
-    const int spinnerSize = GuiGetStyle(SCROLLBAR, ARROWS_VISIBLE)?
-        (isVertical? (int)bounds.width - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH) :
-            (int)bounds.height - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH)) : 0;
+    for (int i = 0; i < count; i++)
+    {
+        inputs[i].mode = items[i].mode;
+        inputs[i].size = items[i].size;
+        inputs[i].textLength = -1;
+        inputs[i].textHash = 0;
 
-    // Arrow buttons [<] [>] [∧] [∨]
-    Rectangle arrowUpLeft = { 0 };
-    Rectangle arrowDownRight = { 0 };
+        if ((items[i].mode == LAYOUT_SIZE_TEXT) && (items[i].text != NULL))
+        {
+            inputs[i].textLength = (int)strlen(items[i].text);
+            inputs[i].textHash = GuiHashData(2166136261u, items[i].text, inputs[i].textLength);
+        }
+    }
+}
 
-    // Actual area of the scrollbar excluding the arrow buttons
-    Rectangle scrollbar = { 0 };
+// Compute layout items bounds, relative to container position
+// NOTE: Items are placed on integer positions, sizes fill the gaps between them,
+// fixed sizes, text paddings and spacing are unscaled, gui scale is applied
+static void GuiLayoutCompute(Rectangle bounds, int type, int columns, const GuiLayoutItem *items, int count, float spacing, Rectangle *rects)
+{
+    if (count <= 0) return;
 
-    // Slider bar that moves     --[///]-----
-    Rectangle slider = { 0 };
+    spacing *= guiScale;
 
-    // Normalize value
-    if (value > maxValue) value = maxValue;
-    if (value < minValue) value = minValue;
+    if (type == LAYOUT_GRID)
+    {
+        int rows = (count + columns - 1)/columns;
+        float columnWidth = (bounds.width - spacing*(columns - 1))/columns;
+        if (columnWidth < 0.0f) columnWidth = 0.0f;
 
-    int valueRange = maxValue - minValue;
-    if (valueRange <= 0) valueRange = 1;
+        // Get every row size, fill rows stored as negative weight
+        float fixedSize = spacing*(rows - 1);
+        float weights = 0.0f;
 
-    int sliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
-    if (sliderSize < 1) sliderSize = 1;  // Consider a minimum slider size of 1 pixel
+        for (int row = 0; row < rows; row++)
+        {
+            float rowSize = 0.0f;
+            float rowWeight = 0.0f;
 
-    // Calculate rectangles for all of the components
-    arrowUpLeft = RAYGUI_CLITERAL(Rectangle){
-        (float)bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH),
-            (float)bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH),
-            (float)spinnerSize, (float)spinnerSize };
+            for (int i = row*columns; (i < (row + 1)*columns) && (i < count); i++)
+            {
+                float size = GuiLayoutItemSize(items[i], bounds.height, false);
 
-    if (isVertical)
-    {
-        arrowDownRight = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)bounds.y + bounds.height - spinnerSize - GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)spinnerSize, (float)spinnerSize };
-        scrollbar = RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING), arrowUpLeft.y + arrowUpLeft.height, bounds.width - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING)), bounds.height - arrowUpLeft.height - arrowDownRight.height - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH) };
+                if ((size < 0.0f) && (-size > rowWeight)) rowWeight = -size;
+                else if (size > rowSize) rowSize = size;
+            }
 
-        // Make sure the slider won't get outside of the scrollbar
-        sliderSize = (sliderSize >= scrollbar.height)? ((int)scrollbar.height - 2) : sliderSize;
-        slider = RAYGUI_CLITERAL(Rectangle){
-            bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING),
-                scrollbar.y + (int)(((float)(value - minValue)/valueRange)*(scrollbar.height - sliderSize)),
-                bounds.width - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING)),
-                (float)sliderSize };
-    }
-    else    // horizontal
-    {
-        arrowDownRight = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + bounds.width - spinnerSize - GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)spinnerSize, (float)spinnerSize };
-        scrollbar = RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x + arrowUpLeft.width, bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING), bounds.width - arrowUpLeft.width - arrowDownRight.width - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH), bounds.height - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING)) };
+            if (rowWeight > 0.0f) { rects[row*columns].height = -rowWeight; weights += rowWeight; }
+            else { rects[row*columns].height = rowSize; fixedSize += rowSize; }
+        }
 
-        // Make sure the slider won't get outside of the scrollbar
-        sliderSize = (sliderSize >= scrollbar.width)? ((int)scrollbar.width - 2) : sliderSize;
-        slider = RAYGUI_CLITERAL(Rectangle){
-            scrollbar.x + (int)(((float)(value - minValue)/valueRange)*(scrollbar.width - sliderSize)),
-                bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING),
-                (float)sliderSize,
-                bounds.height - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING)) };
-    }
+        float remaining = bounds.height - fixedSize;
+        if (remaining < 0.0f) remaining = 0.0f;
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked)
-    {
-        Vector2 mousePoint = GUI_POINTER_POSITION;
+        float position = 0.0f;
 
-        if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
+        for (int row = 0; row < rows; row++)
         {
-            if (GUI_BUTTON_DOWN &&
-                !CheckCollisionPointRec(mousePoint, arrowUpLeft) &&
-                !CheckCollisionPointRec(mousePoint, arrowDownRight))
-            {
-                if (CHECK_BOUNDS_ID(bounds, guiControlExclusiveRec))
-                {
-                    state = STATE_PRESSED;
+            float rowSize = rects[row*columns].height;
+            if (rowSize < 0.0f) rowSize = (weights > 0.0f)? remaining*(-rowSize/weights) : 0.0f;
 
-                    if (isVertical) value = (int)(((float)(mousePoint.y - scrollbar.y - slider.height/2)*valueRange)/(scrollbar.height - slider.height) + minValue);
-                    else value = (int)(((float)(mousePoint.x - scrollbar.x - slider.width/2)*valueRange)/(scrollbar.width - slider.width) + minValue);
-                }
-            }
-            else
+            for (int i = row*columns; (i < (row + 1)*columns) && (i < count); i++)
             {
-                guiControlExclusiveMode = false;
-                guiControlExclusiveRec = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
+                int column = i - row*columns;
+                float x = column*(columnWidth + spacing);
+
+                rects[i].x = (float)(int)x;
+                rects[i].y = (float)(int)position;
+                rects[i].width = (float)((int)(x + columnWidth) - (int)x);
+                rects[i].height = (float)((int)(position + rowSize) - (int)position);
             }
-        }
-        else if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            state = STATE_FOCUSED;
 
-            // Handle mouse wheel
-            float scrollDelta = GUI_SCROLL_DELTA;
-            if (scrollDelta != 0) value += (int)scrollDelta;
+            position += rowSize + spacing;
+        }
+    }
+    else
+    {
+        bool horizontal = (type == LAYOUT_ROW);
+        float available = horizontal? bounds.width : bounds.height;
 
-            // Handle mouse button down
-            if (GUI_BUTTON_PRESSED)
-            {
-                guiControlExclusiveMode = true;
-                guiControlExclusiveRec = bounds; // Store bounds as an identifier when dragging starts
+        // Get every item size, fill items stored as negative weight
+        float fixedSize = spacing*(count - 1);
+        float weights = 0.0f;
 
-                // Check arrows click
-                if (CheckCollisionPointRec(mousePoint, arrowUpLeft)) value -= valueRange/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                else if (CheckCollisionPointRec(mousePoint, arrowDownRight)) value += valueRange/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                else if (!CheckCollisionPointRec(mousePoint, slider))
-                {
-                    // If click on scrollbar position but not on slider, place slider directly on that position
-                    if (isVertical) value = (int)(((float)(mousePoint.y - scrollbar.y - slider.height/2)*valueRange)/(scrollbar.height - slider.height) + minValue);
-                    else value = (int)(((float)(mousePoint.x - scrollbar.x - slider.width/2)*valueRange)/(scrollbar.width - slider.width) + minValue);
-                }
+        for (int i = 0; i < count; i++)
+        {
+            float size = GuiLayoutItemSize(items[i], available, horizontal);
 
-                state = STATE_PRESSED;
-            }
+            if (size < 0.0f) weights += -size;
+            else fixedSize += size;
 
-            // Keyboard control on mouse hover scrollbar
-            /*
-            if (isVertical)
-            {
-            if (GUI_KEY_DOWN(KEY_DOWN)) value += 5;
-            else if (GUI_KEY_DOWN(KEY_UP)) value -= 5;
-            }
-            else
-            {
-            if (GUI_KEY_DOWN(KEY_RIGHT)) value += 5;
-            else if (GUI_KEY_DOWN(KEY_LEFT)) value -= 5;
-            }
-            */
+            rects[i].width = size;
         }
 
-        // Normalize value
-        if (value > maxValue) value = maxValue;
-        if (value < minValue) value = minValue;
-    }
-    //--------------------------------------------------------------------
+        float remaining = available - fixedSize;
+        if (remaining < 0.0f) remaining = 0.0f;
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SCROLLBAR, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED)));   // Draw the background
+        float position = 0.0f;
 
-    GuiDrawRectangle(scrollbar, 0, BLANK, GetColor(GuiGetStyle(BUTTON, BASE_COLOR_NORMAL)));     // Draw the scrollbar active area background
-    GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BORDER + state*3)));         // Draw the slider bar
+        for (int i = 0; i < count; i++)
+        {
+            float size = rects[i].width;
+            if (size < 0.0f) size = (weights > 0.0f)? remaining*(-size/weights) : 0.0f;
 
-    // Draw arrows (using icon if available)
-    if (GuiGetStyle(SCROLLBAR, ARROWS_VISIBLE))
-    {
-#if defined(RAYGUI_NO_ICONS)
-        GuiDrawText(isVertical? "^" : "<",
-            RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x, arrowUpLeft.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
-        GuiDrawText(isVertical? "v" : ">",
-            RAYGUI_CLITERAL(Rectangle){ arrowDownRight.x, arrowDownRight.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
-#else
-        GuiDrawText(isVertical? GuiIconText(ICON_ARROW_UP_FILL, NULL) : GuiIconText(ICON_ARROW_LEFT_FILL, NULL),
-            RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x, arrowUpLeft.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(SCROLLBAR, TEXT + state*3)));   // ICON_ARROW_UP_FILL / ICON_ARROW_LEFT_FILL
-        GuiDrawText(isVertical? GuiIconText(ICON_ARROW_DOWN_FILL, NULL) : GuiIconText(ICON_ARROW_RIGHT_FILL, NULL),
-            RAYGUI_CLITERAL(Rectangle){ arrowDownRight.x, arrowDownRight.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(SCROLLBAR, TEXT + state*3)));   // ICON_ARROW_DOWN_FILL / ICON_ARROW_RIGHT_FILL
-#endif
-    }
-    //--------------------------------------------------------------------
+            float start = (float)(int)position;
+            float end = (float)(int)(position + size);
 
-    return value;
+            if (horizontal) rects[i] = RAYGUI_CLITERAL(Rectangle){ start, 0, end - start, bounds.height };
+            else rects[i] = RAYGUI_CLITERAL(Rectangle){ 0, start, bounds.width, end - start };
+
+            position += size + spacing;
+        }
+    }
 }
 
-// Update font image atlas to append raygui icons
-static int GuiFontIconBaking(Image *imFont, Font font, Rectangle *whiteRec)
+// Get layout item size in pixels along one axis, negative weight for fill items
+static float GuiLayoutItemSize(GuiLayoutItem item, float available, bool horizontal)
 {
-    int iconOffsetY = 0;
+    float size = 0.0f;
 
-    // Check max glyph rec y bottom position in the atlas image,
-    // to start drawing icons below that line
-    int maxGlyphRecY = 0;
-    for (int i = 0; i < font.glyphCount; i++)
+    switch (item.mode)
     {
-        if ((font.recs[i].y + font.recs[i].height) > maxGlyphRecY)
-            maxGlyphRecY = (int)font.recs[i].y + (int)font.recs[i].height;
-    }
+        case LAYOUT_SIZE_FIXED: size = item.size*guiScale; break;
+        case LAYOUT_SIZE_PERCENT: size = available*item.size/100.0f; break;
+        case LAYOUT_SIZE_FILL: size = (item.size > 0.0f)? -item.size : -1.0f; break;
+        case LAYOUT_SIZE_TEXT:
+        {
+            if (horizontal) size = (float)GuiGetTextWidth(item.text) + item.size*guiScale;
+            else
+            {
+                int lines = 1;
+                if (item.text != NULL) for (const char *c = item.text; *c != '\0'; c++) if (*c == '\n') lines++;
 
-    int maxIconsPerLine = imFont->width/(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING);
-    int reqIconLines = RAYGUI_ICON_MAX_FONT_BACKED/maxIconsPerLine + RAYGUI_ICON_MAX_FONT_BACKED%maxIconsPerLine + 1; // One extra line
-    int reqHeight = reqIconLines*(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING);
+                size = (float)GuiGetStyle(DEFAULT, TEXT_SIZE) + (lines - 1)*(float)GuiGetStyle(DEFAULT, TEXT_LINE_SPACING) + item.size*guiScale;
+            }
+        } break;
+        default: break;
+    }
 
-    // Check if image requires scaling and how much
-    if ((maxGlyphRecY + reqHeight) > imFont->height)
-    {
-        int newImHeight = 1;
-        while (newImHeight < (maxGlyphRecY + reqHeight)) newImHeight <<= 1; // Round to next POT
+    if ((item.mode != LAYOUT_SIZE_FILL) && (size < 0.0f)) size = 0.0f;
 
-        char *newImData = (char *)RL_CALLOC(imFont->width*newImHeight*2, sizeof(char));
-        memcpy(newImData, imFont->data, imFont->width*imFont->height*2);
-        RL_FREE(imFont->data);
+    return size;
+}
 
-        // Clear imFont bottom-right corner rec
-        for (int y = 0; y < 4; y++)
-            for (int x = 0; x < 4; x++)
-                ((unsigned short *)newImData)[(imFont->height - y - 1)*imFont->width + imFont->width - x - 1] = 0x0000;
+// Check if style property is a metric (size in pixels), resolved for gui scale
+// NOTE: Custom properties on unused EXTENDED slots are not considered metrics
+static bool GuiIsStyleMetric(int control, int property)
+{
+    // Metric EXTENDED properties per control, one bit per property (bit 0: property 16)
+    static const unsigned char metricProps[RAYGUI_MAX_CONTROLS] = {
+        0x13,   // DEFAULT: TEXT_SIZE, TEXT_SPACING, TEXT_LINE_SPACING
+        0x00,   // LABEL
+        0x00,   // BUTTON
+        0x01,   // TOGGLE: GROUP_PADDING
+        0x03,   // SLIDER: SLIDER_WIDTH, SLIDER_PADDING
+        0x01,   // PROGRESSBAR: PROGRESS_PADDING
+        0x01,   // CHECKBOX: CHECK_PADDING
+        0x03,   // COMBOBOX: COMBO_BUTTON_WIDTH, COMBO_BUTTON_SPACING
+        0x03,   // DROPDOWNBOX: ARROW_PADDING, DROPDOWN_ITEMS_SPACING
+        0x00,   // TEXTBOX
+        0x03,   // VALUEBOX: SPINNER_BUTTON_WIDTH, SPINNER_BUTTON_SPACING
+        0x01,   // TABBAR: TAB_ITEMS_WIDTH
+        0x27,   // LISTVIEW: LIST_ITEMS_HEIGHT, LIST_ITEMS_SPACING, SCROLLBAR_WIDTH, LIST_ITEMS_BORDER_WIDTH
+        0x1f,   // COLORPICKER: COLOR_SELECTOR_SIZE, HUEBAR_WIDTH, HUEBAR_PADDING, HUEBAR_SELECTOR_HEIGHT, HUEBAR_SELECTOR_OVERFLOW
+        0x3d,   // SCROLLBAR: ARROWS_SIZE, SCROLL_SLIDER_PADDING, SCROLL_SLIDER_SIZE, SCROLL_PADDING, SCROLL_SPEED
+        0x00    // STATUSBAR
+    };
 
-        imFont->data = newImData;
-        imFont->height = newImHeight;
+    if ((control < 0) || (control >= RAYGUI_MAX_CONTROLS)) return false;
+    if ((property == BORDER_WIDTH) || (property == TEXT_PADDING)) return true;
+    if ((property < RAYGUI_MAX_PROPS_BASE) || (property >= (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED))) return false;
 
-        // Set new image white corner and new white rec
-        for (int y = 0; y < 3; y++)
-            for (int x = 0; x < 3; x++)
-                ((unsigned short *)newImData)[(imFont->height - y - 1)*imFont->width + imFont->width - x - 1] = 0xffff;
+    return ((metricProps[control] >> (property - RAYGUI_MAX_PROPS_BASE)) & 1) != 0;
+}
 
-        *whiteRec = RAYGUI_CLITERAL(Rectangle){ (float)imFont->width - 2, (float)imFont->height - 2, 1, 1 };
-    }
+// Set control style property value temporarily, unscaled value is kept
+// NOTE: Used by controls to set and restore properties while drawing, restored values
+// are the resolved ones, so unscaled values never drift with fractional scales
+static void GuiSetStyleTemp(int control, int property, int value)
+{
+    guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
 
-    // Calculate image offset positions to start drawing
-    // NOTE: For Y, look for a multiple of icon size + 2*padding, for better alignment
-    int offsetX = RAYGUI_ICON_FONT_ATLAS_PADDING;
-    int offsetY = ((maxGlyphRecY + (RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING - 1))/
-        (RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING))*(RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING) +
-        RAYGUI_ICON_FONT_ATLAS_PADDING;
+    // Default properties are propagated to all controls
+    if ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))
+    {
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) guiStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+    }
+}
 
-    iconOffsetY = offsetY - RAYGUI_ICON_FONT_ATLAS_PADDING;
-    unsigned short *pixels = (unsigned short *)imFont->data;
+// Set control style property resolved and unscaled values
+static void GuiSetStyleResolved(int control, int property, int value, float base)
+{
+    int index = control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property;
 
-    #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
+    guiStyle[index] = value;
+    guiStyleBase[index] = base;
 
-    for (int iconId = 0; iconId < RAYGUI_ICON_MAX_FONT_BACKED; iconId++)
+    // Default properties are propagated to all controls
+    if ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))
     {
-        // Wrap to next line if next icon won't fit
-        if ((offsetX + (RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING)) > imFont->width)
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
         {
-            offsetX = RAYGUI_ICON_FONT_ATLAS_PADDING;
-            offsetY += RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING;
+            guiStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+            guiStyleBase[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = base;
         }
+    }
+}
 
-        for (int i = 0, y = 0; i < RAYGUI_ICON_DATA_ELEMENTS; i++)
+// Resolve metric style properties and icon scale for gui scale, from unscaled values
+// NOTE: Called on scale change and after style loading, never while drawing controls
+static void GuiResolveStyle(void)
+{
+    for (int control = 0; control < RAYGUI_MAX_CONTROLS; control++)
+    {
+        for (int property = 0; property < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); property++)
         {
-            unsigned int data = guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i];
-
-            for (int k = 0; k < 32; k++)
+            if (GuiIsStyleMetric(control, property))
             {
-                pixels[(offsetY + y)*imFont->width + offsetX + k%16] = (BIT_CHECK(data, k))? 0xffff : 0x00ff;
+                int index = control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property;
+                float value = guiStyleBase[index]*guiScale;
 
-                if ((k == 15) || (k == 31)) y++;
+                guiStyle[index] = (int)((value >= 0.0f)? value + 0.5f : value - 0.5f);
             }
         }
+    }
 
-        // Update current icon X position
-        offsetX += (RAYGUI_ICON_SIZE + 2*RAYGUI_ICON_FONT_ATLAS_PADDING);
+    guiIconScale = (unsigned int)(guiIconScaleBase*guiScale + 0.5f);
+    if (guiIconScale < 1) guiIconScale = 1;
+}
+
+#if defined(RAYGUI_INPUT_STATE)
+// Get input state key flag for a backend key code
+// NOTE: Keys not tracked on input state return 0 (never down/pressed)
+static unsigned int GuiGetInputKeyFlag(int key)
+{
+    unsigned int flag = 0;
+
+    switch (key)
+    {
+        case KEY_ENTER: flag = INPUT_KEY_ENTER; break;
+        case KEY_KP_ENTER: flag = INPUT_KEY_KP_ENTER; break;
+        case KEY_BACKSPACE: flag = INPUT_KEY_BACKSPACE; break;
+        case KEY_DELETE: flag = INPUT_KEY_DELETE; break;
+        case KEY_RIGHT: flag = INPUT_KEY_RIGHT; break;
+        case KEY_LEFT: flag = INPUT_KEY_LEFT; break;
+        case KEY_DOWN: flag = INPUT_KEY_DOWN; break;
+        case KEY_UP: flag = INPUT_KEY_UP; break;
+        case KEY_HOME: flag = INPUT_KEY_HOME; break;
+        case KEY_END: flag = INPUT_KEY_END; break;
+        case KEY_MINUS: flag = INPUT_KEY_MINUS; break;
+        case KEY_V: flag = INPUT_KEY_V; break;
+        case KEY_LEFT_SHIFT: flag = INPUT_KEY_LEFT_SHIFT; break;
+        case KEY_LEFT_CONTROL: flag = INPUT_KEY_LEFT_CONTROL; break;
+        case KEY_RIGHT_CONTROL: flag = INPUT_KEY_RIGHT_CONTROL; break;
+        default: break;
     }
 
-    return iconOffsetY;
+    return flag;
 }
 
-// Split controls text into multiple strings
-// NOTE: Re-used by GuiToggleSlider(), GuiComboBox(), GuiDropdownBox(), GuiListView(), GuiMessageBox(), GuiInputBox()
-static char **GuiTextSplit(const char *text, char delimiter, int *count)
+// Get clipboard text, recorded or replayed along input state
+// NOTE: While replaying, only clipboard text read on the recorded frame is available,
+// while recording, recorded text (could be truncated) is returned so replay gets same text
+static const char *GuiGetInputClipboardText(void)
 {
-    // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
-    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
-    //      1. Maximum number of possible split strings is set by RAYGUI_TEXTSPLIT_MAX_ITEMS
-    //      2. Maximum size of text to split is RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE
-    // NOTE: Those definitions could be externally provided if required
+    const char *text = NULL;
 
-    #if !defined(RAYGUI_TEXTSPLIT_MAX_ITEMS)
-        #define RAYGUI_TEXTSPLIT_MAX_ITEMS          128
-    #endif
-    #if !defined(RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE)
-        #define RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE     1024     // WARNING: Max expected size for all concat items
-    #endif
+    if (guiInputReplayFile != NULL)
+    {
+        if (guiInputClipboardSize >= 0) text = guiInputClipboard;
+    }
+    else
+    {
+        text = GetClipboardText();
 
-    static char *itemPtrs[RAYGUI_TEXTSPLIT_MAX_ITEMS] = { 0 }; // String pointers array (points to buffer data)
-    static char buffer[RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE] = { 0 }; // Buffer data (text input copy with '\0' added)
-    memset(buffer, 0, RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE);
+        if ((guiInputRecordFile != NULL) && (text != NULL))
+        {
+            int size = (int)strlen(text);
+            if (size > (RAYGUI_INPUT_MAX_CLIPBOARD_SIZE - 1)) size = RAYGUI_INPUT_MAX_CLIPBOARD_SIZE - 1;
 
-    itemPtrs[0] = buffer;
-    int itemCounter = 1;
+            memcpy(guiInputClipboard, text, size);
+            guiInputClipboard[size] = '\0';
+            guiInputClipboardSize = size;
 
-    // Count how many substrings text contains and point to every one of them
-    for (int i = 0; i < RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE; i++)
+            text = guiInputClipboard;
+        }
+    }
+
+    return text;
+}
+
+// Write pending input record frame (delta encoded)
+static void GuiWriteInputFrame(void)
+{
+    GuiInputState *frame = &guiInputRecordFrame;
+    GuiInputState *prev = &guiInputRecordPrev;
+    unsigned char flags = 0;
+
+    // Pointer delta is stored as integer if possible (common case), absolute position otherwise
+    float deltaX = frame->pointer.x - prev->pointer.x;
+    float deltaY = frame->pointer.y - prev->pointer.y;
+    short delta[2] = { 0 };
+
+    if ((deltaX != 0.0f) || (deltaY != 0.0f))
     {
-        buffer[i] = text[i];
-        if (buffer[i] == '\0') break;
-        else if ((buffer[i] == delimiter) || (buffer[i] == '\n'))
+        flags |= 0x80;
+
+        if ((deltaX >= -32768.0f) && (deltaX <= 32767.0f) && (deltaY >= -32768.0f) && (deltaY <= 32767.0f))
         {
-            itemPtrs[itemCounter] = buffer + i + 1;
-            buffer[i] = '\0'; // Set terminator for current item
+            delta[0] = (short)deltaX;
+            delta[1] = (short)deltaY;
 
-            itemCounter++;
-            if (itemCounter >= RAYGUI_TEXTSPLIT_MAX_ITEMS) break;
+            // Integer delta must reproduce exactly the same position on replay
+            if (((prev->pointer.x + (float)delta[0]) == frame->pointer.x) &&
+                ((prev->pointer.y + (float)delta[1]) == frame->pointer.y)) flags = 0x01;
         }
     }
 
-    *count = itemCounter;
-    return itemPtrs;
+    unsigned char buttons = (frame->buttonDown? 0x01 : 0) | (frame->buttonDownAlt? 0x02 : 0) | (frame->buttonPressed? 0x04 : 0) |
+        (frame->buttonPressedMid? 0x08 : 0) | (frame->buttonReleased? 0x10 : 0);
+    unsigned char prevButtons = (prev->buttonDown? 0x01 : 0) | (prev->buttonDownAlt? 0x02 : 0) | (prev->buttonPressed? 0x04 : 0) |
+        (prev->buttonPressedMid? 0x08 : 0) | (prev->buttonReleased? 0x10 : 0);
+    unsigned short keysDown = (unsigned short)frame->keysDown;
+    unsigned short keysPressed = (unsigned short)frame->keysPressed;
+    unsigned char charCount = (unsigned char)frame->charCount;
+
+    if (frame->scrollDelta != prev->scrollDelta) flags |= 0x02;
+    if (buttons != prevButtons) flags |= 0x04;
+    if (frame->keysDown != prev->keysDown) flags |= 0x08;
+    if (frame->keysPressed != prev->keysPressed) flags |= 0x10;
+    if (frame->charCount > 0) flags |= 0x20;
+    if (guiInputClipboardSize >= 0) flags |= 0x40;
+
+    unsigned int pointer[2] = { 0 };
+    unsigned int scrollDelta = 0;
+    memcpy(pointer, &frame->pointer, sizeof(pointer));
+    memcpy(&scrollDelta, &frame->scrollDelta, sizeof(float));
+
+    GuiWriteInputValue(flags, 1);
+
+    if (flags & 0x01) { GuiWriteInputValue((unsigned short)delta[0], 2); GuiWriteInputValue((unsigned short)delta[1], 2); }
+    if (flags & 0x80) { GuiWriteInputValue(pointer[0], 4); GuiWriteInputValue(pointer[1], 4); }
+    if (flags & 0x02) GuiWriteInputValue(scrollDelta, 4);
+    if (flags & 0x04) GuiWriteInputValue(buttons, 1);
+    if (flags & 0x08) GuiWriteInputValue(keysDown, 2);
+    if (flags & 0x10) GuiWriteInputValue(keysPressed, 2);
+    if (flags & 0x20)
+    {
+        GuiWriteInputValue(charCount, 1);
+        for (int i = 0; i < charCount; i++) GuiWriteInputValue((unsigned int)frame->chars[i], 4);
+    }
+    if (flags & 0x40)
+    {
+        GuiWriteInputValue((unsigned int)guiInputClipboardSize, 2);
+        fwrite(guiInputClipboard, 1, guiInputClipboardSize, guiInputRecordFile);
+    }
+
+    *prev = *frame;
+    guiInputRecordPending = false;
 }
 
-// Convert color data from RGB to HSV
-// NOTE: Color data should be passed normalized
-static Vector3 ConvertRGBtoHSV(Vector3 rgb)
+// Read next input replay frame (delta encoded)
+// NOTE: Returns false when no more frames are available
+static bool GuiReadInputFrame(GuiInputState *state)
 {
-    Vector3 hsv = { 0 };
-    float min = 0.0f;
-    float max = 0.0f;
-    float delta = 0.0f;
+    GuiInputState frame = guiInputState;
+    unsigned int flags = 0;
+    unsigned int value[2] = { 0 };
 
-    min = (rgb.x < rgb.y)? rgb.x : rgb.y;
-    min = (min < rgb.z)? min  : rgb.z;
+    if (!GuiReadInputValue(&flags, 1)) return false;
 
-    max = (rgb.x > rgb.y)? rgb.x : rgb.y;
-    max = (max > rgb.z)? max  : rgb.z;
+    // Events are not persistent between frames
+    frame.charCount = 0;
+    guiInputClipboardSize = -1;
 
-    hsv.z = max;            // Value
-    delta = max - min;
+    // NOTE: Any short read (truncated file) ends replay, partial frame is not applied
+    if (flags & 0x01)
+    {
+        if (!GuiReadInputValue(&value[0], 2) || !GuiReadInputValue(&value[1], 2)) return false;
 
-    if (delta < 0.00001f)
+        frame.pointer.x += (float)(short)value[0];
+        frame.pointer.y += (float)(short)value[1];
+    }
+    if (flags & 0x80)
     {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;           // Undefined, maybe NAN?
-        return hsv;
+        if (!GuiReadInputValue(&value[0], 4) || !GuiReadInputValue(&value[1], 4)) return false;
+
+        memcpy(&frame.pointer.x, &value[0], sizeof(float));
+        memcpy(&frame.pointer.y, &value[1], sizeof(float));
     }
+    if (flags & 0x02)
+    {
+        if (!GuiReadInputValue(&value[0], 4)) return false;
 
-    if (max > 0.0f)
+        memcpy(&frame.scrollDelta, &value[0], sizeof(float));
+    }
+    if (flags & 0x04)
     {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max);    // Saturation
+        if (!GuiReadInputValue(&value[0], 1)) return false;
+
+        frame.buttonDown = ((value[0] & 0x01) != 0);
+        frame.buttonDownAlt = ((value[0] & 0x02) != 0);
+        frame.buttonPressed = ((value[0] & 0x04) != 0);
+        frame.buttonPressedMid = ((value[0] & 0x08) != 0);
+        frame.buttonReleased = ((value[0] & 0x10) != 0);
     }
-    else
+    if (flags & 0x08)
     {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;           // Undefined, maybe NAN?
-        return hsv;
+        if (!GuiReadInputValue(&value[0], 2)) return false;
+
+        frame.keysDown = value[0];
     }
+    if (flags & 0x10)
+    {
+        if (!GuiReadInputValue(&value[0], 2)) return false;
 
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
-    else
+        frame.keysPressed = value[0];
+    }
+    if (flags & 0x20)
     {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+        unsigned int charCount = 0;
+
+        if (!GuiReadInputValue(&charCount, 1) || (charCount > RAYGUI_INPUT_MAX_CHARS)) return false;
+
+        for (unsigned int i = 0; i < charCount; i++)
+        {
+            if (!GuiReadInputValue(&value[0], 4)) return false;
+
+            frame.chars[i] = (int)value[0];
+        }
+
+        frame.charCount = (int)charCount;
     }
+    if (flags & 0x40)
+    {
+        unsigned int size = 0;
 
-    hsv.x *= 60.0f;     // Convert to degrees
+        if (!GuiReadInputValue(&size, 2) || (size > (RAYGUI_INPUT_MAX_CLIPBOARD_SIZE - 1))) return false;
+        if (fread(guiInputClipboard, 1, size, guiInputReplayFile) != size) return false;
 
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+        guiInputClipboard[size] = '\0';
+        guiInputClipboardSize = (int)size;
+    }
 
-    return hsv;
+    *state = frame;
+
+    return true;
 }
 
-// Convert color data from HSV to RGB
-// NOTE: Color data should be passed normalized
-static Vector3 ConvertHSVtoRGB(Vector3 hsv)
+// Write input record value, little-endian, so recorded files replay on any machine
+static void GuiWriteInputValue(unsigned int value, int size)
 {
-    Vector3 rgb = { 0 };
-    float hh = 0.0f, p = 0.0f, q = 0.0f, t = 0.0f, ff = 0.0f;
-    long i = 0;
+    unsigned char bytes[4] = { 0 };
 
-    // NOTE: Comparing float values could not work properly
-    if (hsv.y <= 0.0f)
-    {
-        rgb.x = hsv.z;
-        rgb.y = hsv.z;
-        rgb.z = hsv.z;
-        return rgb;
-    }
+    for (int i = 0; i < size; i++) bytes[i] = (unsigned char)((value >> (8*i)) & 0xff);
 
-    hh = hsv.x;
-    if (hh >= 360.0f) hh = 0.0f;
-    hh /= 60.0f;
+    fwrite(bytes, 1, size, guiInputRecordFile);
+}
 
-    i = (long)hh;
-    ff = hh - i;
-    p = hsv.z*(1.0f - hsv.y);
-    q = hsv.z*(1.0f - (hsv.y*ff));
-    t = hsv.z*(1.0f - (hsv.y*(1.0f - ff)));
+// Read input replay value, little-endian
+// NOTE: Returns false on short read (truncated file)
+static bool GuiReadInputValue(unsigned int *value, int size)
+{
+    unsigned char bytes[4] = { 0 };
 
-    switch (i)
-    {
-        case 0:
-        {
-            rgb.x = hsv.z;
-            rgb.y = t;
-            rgb.z = p;
-        } break;
-        case 1:
-        {
-            rgb.x = q;
-            rgb.y = hsv.z;
-            rgb.z = p;
-        } break;
-        case 2:
-        {
-            rgb.x = p;
-            rgb.y = hsv.z;
-            rgb.z = t;
-        } break;
-        case 3:
-        {
-            rgb.x = p;
-            rgb.y = q;
-            rgb.z = hsv.z;
-        } break;
-        case 4:
-        {
-            rgb.x = t;
-            rgb.y = p;
-            rgb.z = hsv.z;
-        } break;
-        case 5:
-        default:
-        {
-            rgb.x = hsv.z;
-            rgb.y = p;
-            rgb.z = q;
-        } break;
-    }
+    if (fread(bytes, 1, size, guiInputReplayFile) != (size_t)size) return false;
 
-    return rgb;
+    *value = 0;
+    for (int i = 0; i < size; i++) *value |= ((unsigned int)bytes[i] << (8*i));
+
+    return true;
 }
+#endif
 
-// Color fade-in or fade-out, alpha goes from 0.0f to 1.0f
-// WARNING: It multiplies current alpha by alpha scale factor,
-// raylib Fade() multiplies alpha by 255.0f
-static Color GuiFade(Color color, float alpha)
+#if defined(RAYGUI_PROFILE)
+// Write trace begin event
+// NOTE: Timestamps are written in microseconds since GuiTraceBegin()
+static void GuiTraceScopeBegin(const char *name, void *userData)
 {
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    FILE *traceFile = (FILE *)userData;
 
-    Color result = { color.r, color.g, color.b, (unsigned char)(color.a*alpha) };
+    fprintf(traceFile, "%s{\"name\":\"%s\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":1,\"tid\":1}",
+        (guiTraceEventCount > 0)? ",\n" : "", name, (GetTime() - guiTraceStartTime)*1000000.0);
 
-    return result;
+    guiTraceEventCount++;
 }
 
+// Write trace end event
+static void GuiTraceScopeEnd(const char *name, void *userData)
+{
+    FILE *traceFile = (FILE *)userData;
+
+    fprintf(traceFile, "%s{\"name\":\"%s\",\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":1}",
+        (guiTraceEventCount > 0)? ",\n" : "", name, (GetTime() - guiTraceStartTime)*1000000.0);
+
+    guiTraceEventCount++;
+}
+#endif
+
 #if defined(RAYGUI_STANDALONE)
 // Returns a Color struct from hexadecimal value
 static Color GetColor(int hexValue)
@@ -6311,12 +12272,9 @@ static bool CheckCollisionPointRec(Vector2 point, Rectangle rec)
 // Formatting of text with variables to 'embed'
 static const char *TextFormat(const char *text, ...)
 {
-    #if !defined(RAYGUI_TEXTFORMAT_MAX_SIZE)
-        #define RAYGUI_TEXTFORMAT_MAX_SIZE   256
-    #endif
-
-    static char buffer[RAYGUI_TEXTFORMAT_MAX_SIZE] = { 0 };
+    char *buffer = guiContext->textFormatBuffer;
     memset(buffer, 0, RAYGUI_TEXTFORMAT_MAX_SIZE);
+    RAYGUI_STATS_ADD(bufferBytes, RAYGUI_TEXTFORMAT_MAX_SIZE);
 
     va_list args;
     va_start(args, text);
@@ -6378,7 +12336,7 @@ static float TextToFloat(const char *text)
 // Encode codepoint into UTF-8 text (char array size returned as parameter)
 static const char *CodepointToUTF8(int codepoint, int *byteSize)
 {
-    static char utf8[6] = { 0 };
+    char *utf8 = guiContext->utf8Buffer;
     int size = 0;
 
     if (codepoint <= 0x7f)
@@ -6455,6 +12413,48 @@ static int GetCodepointNext(const char *text, int *codepointSize)
 
     return codepoint;
 }
+
+// Get previous codepoint in a byte sequence and bytes processed
+static int GetCodepointPrevious(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    int cpSize = 0;
+    *codepointSize = 0;
+
+    // Move to previous codepoint
+    do ptr--;
+    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+
+    codepoint = GetCodepointNext(ptr, &cpSize);
+
+    if (codepoint != 0) *codepointSize = cpSize;
+
+    return codepoint;
+}
+
+// Get glyph index position in font for a codepoint (unicode character)
+// NOTE: If codepoint is not found in the font it fallbacks to '?'
+static int GetGlyphIndex(Font font, int codepoint)
+{
+    int index = 0;
+    int fallbackIndex = 0;
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if (font.glyphs[i].value == 0x3f) fallbackIndex = i;
+
+        if (font.glyphs[i].value == codepoint)
+        {
+            index = i;
+            break;
+        }
+    }
+
+    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+
+    return index;
+}
 #endif      // RAYGUI_STANDALONE
 
 #endif      // RAYGUI_IMPLEMENTATION